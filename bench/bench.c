@@ -0,0 +1,284 @@
+#include "markdown.h"
+#include "html.h"
+#include "buffer.h"
+#include "timer.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#define READ_UNIT 1024
+#define OUTPUT_UNIT 64
+
+#define DEFAULT_EXTENSIONS (MKDEXT_NO_INTRA_EMPHASIS | MKDEXT_TABLES | \
+	MKDEXT_FENCED_CODE | MKDEXT_AUTOLINK | MKDEXT_STRIKETHROUGH | \
+	MKDEXT_SUPERSCRIPT | MKDEXT_LAX_SPACING)
+
+struct bench_options {
+	unsigned int extensions;
+	unsigned int runs;
+	uint64_t run_ns;		/* target duration of a single run */
+	const char *baseline;
+	double threshold;		/* tolerated slowdown, in percent */
+};
+
+struct bench_result {
+	char name[128];
+	size_t bytes;
+	size_t iterations;
+	double ns_per_byte;
+	double mb_per_s;
+	size_t allocs_cold;
+	size_t allocs;
+	size_t pool_bytes;
+};
+
+static struct buf *
+read_file(const char *path)
+{
+	struct buf *ib;
+	size_t ret;
+	FILE *in;
+
+	in = fopen(path, "rb");
+	if (!in) {
+		fprintf(stderr, "Unable to open input file \"%s\": %s\n", path, strerror(errno));
+		return NULL;
+	}
+
+	ib = bufnew(READ_UNIT);
+	bufgrow(ib, READ_UNIT);
+	while ((ret = fread(ib->data + ib->size, 1, ib->asize - ib->size, in)) > 0) {
+		ib->size += ret;
+		bufgrow(ib, ib->size + READ_UNIT);
+	}
+
+	fclose(in);
+	return ib;
+}
+
+/* result_name • basename of the path, without its extension */
+static void
+result_name(char *name, size_t size, const char *path)
+{
+	const char *base = strrchr(path, '/');
+	size_t len;
+
+	base = base ? base + 1 : path;
+	len = strcspn(base, ".");
+	if (len >= size)
+		len = size - 1;
+
+	memcpy(name, base, len);
+	name[len] = '\0';
+}
+
+/* bench_file • renders one document repeatedly, keeping the fastest run */
+static int
+bench_file(struct bench_result *res, const char *path, const struct bench_options *opt)
+{
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_markdown *markdown;
+	struct sd_render_stats stats;
+	struct buf *ib, *ob;
+	uint64_t start, elapsed, best = 0;
+	size_t i;
+	unsigned int run;
+
+	ib = read_file(path);
+	if (!ib)
+		return -1;
+
+	memset(res, 0x0, sizeof(*res));
+	result_name(res->name, sizeof(res->name), path);
+	res->bytes = ib->size;
+
+	ob = bufnew(OUTPUT_UNIT);
+	sdhtml_renderer(&callbacks, &options, 0);
+	markdown = sd_markdown_new(opt->extensions, 16, &callbacks, &options);
+
+	/* a cold render, then a warm one, for the allocation counts */
+	sd_markdown_set_stats(markdown, &stats);
+
+	start = sd_timer_ns();
+	sd_markdown_render(ob, ib->data, ib->size, markdown);
+	elapsed = sd_timer_ns() - start;
+	res->allocs_cold = stats.allocs;
+
+	ob->size = 0;
+	sd_markdown_render(ob, ib->data, ib->size, markdown);
+	res->allocs = stats.allocs;
+	res->pool_bytes = stats.pool_bytes;
+
+	sd_markdown_set_stats(markdown, NULL);
+
+	res->iterations = elapsed ? (size_t)(opt->run_ns / elapsed) : 1000;
+	if (res->iterations == 0)
+		res->iterations = 1;
+
+	for (run = 0; run < opt->runs; ++run) {
+		start = sd_timer_ns();
+		for (i = 0; i < res->iterations; ++i) {
+			ob->size = 0;
+			sd_markdown_render(ob, ib->data, ib->size, markdown);
+		}
+		elapsed = sd_timer_ns() - start;
+
+		if (run == 0 || elapsed < best)
+			best = elapsed;
+	}
+
+	if (res->bytes && best) {
+		double ns = (double)best / res->iterations;
+
+		res->ns_per_byte = ns / res->bytes;
+		res->mb_per_s = res->bytes / ns * 1e3;
+	}
+
+	sd_markdown_free(markdown);
+	bufrelease(ib);
+	bufrelease(ob);
+	return 0;
+}
+
+/* baseline_find • throughput of `name` in a previous JSON report, or 0 */
+static double
+baseline_find(const struct buf *baseline, const char *name)
+{
+	char key[160];
+	const char *p, *end;
+	double mbps = 0.0;
+
+	if (!baseline)
+		return 0.0;
+
+	snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+
+	p = strstr((const char *)baseline->data, key);
+	if (!p)
+		return 0.0;
+
+	end = strchr(p, '}');
+	p = strstr(p, "\"mb_per_s\": ");
+	if (!p || (end && p > end))
+		return 0.0;
+
+	sscanf(p + strlen("\"mb_per_s\": "), "%lf", &mbps);
+	return mbps;
+}
+
+static void
+usage(const char *name)
+{
+	fprintf(stderr,
+		"Usage: %s [options] file.md...\n\n"
+		"  -e flags     markdown extensions (default: %u)\n"
+		"  -r runs      timed runs per document, the fastest is kept (default: 5)\n"
+		"  -t ms        target duration of each run (default: 100)\n"
+		"  -b file      compare against a previous JSON report\n"
+		"  -T percent   tolerated slowdown against the baseline (default: 5)\n",
+		name, (unsigned int)DEFAULT_EXTENSIONS);
+}
+
+/* main • renders every document and prints a JSON report on stdout.
+ * Exits with 2 when a document is slower than the baseline allows */
+int
+main(int argc, char **argv)
+{
+	struct bench_options opt;
+	struct bench_result res;
+	struct buf *baseline = NULL;
+	struct rusage usage_info;
+	int i, first = 1, regressed = 0;
+
+	opt.extensions = DEFAULT_EXTENSIONS;
+	opt.runs = 5;
+	opt.run_ns = 100 * 1000000ULL;
+	opt.baseline = NULL;
+	opt.threshold = 5.0;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; ++i) {
+		if (i + 1 >= argc) {
+			usage(argv[0]);
+			return 1;
+		}
+
+		if (strcmp(argv[i], "-e") == 0)
+			opt.extensions = strtoul(argv[++i], NULL, 0);
+		else if (strcmp(argv[i], "-r") == 0)
+			opt.runs = strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-t") == 0)
+			opt.run_ns = strtoull(argv[++i], NULL, 10) * 1000000ULL;
+		else if (strcmp(argv[i], "-b") == 0)
+			opt.baseline = argv[++i];
+		else if (strcmp(argv[i], "-T") == 0)
+			opt.threshold = strtod(argv[++i], NULL);
+		else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (i >= argc || opt.runs == 0) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	if (opt.baseline) {
+		baseline = read_file(opt.baseline);
+		if (!baseline)
+			return 1;
+
+		/* NUL-terminate for the string searches */
+		bufputc(baseline, '\0');
+	}
+
+	printf("{\n  \"suite\": \"sundown\",\n  \"version\": \"%d.%d.%d\",\n  \"extensions\": %u,\n  \"results\": [\n",
+		SUNDOWN_VER_MAJOR, SUNDOWN_VER_MINOR, SUNDOWN_VER_REVISION, opt.extensions);
+
+	for (; i < argc; ++i) {
+		double base_mbps, change;
+
+		if (bench_file(&res, argv[i], &opt) < 0)
+			continue;
+
+		printf("%s    { \"name\": \"%s\", \"bytes\": %lu, \"iterations\": %lu, "
+			"\"ns_per_byte\": %.4f, \"mb_per_s\": %.2f, \"allocs_cold\": %lu, "
+			"\"allocs\": %lu, \"pool_bytes\": %lu",
+			first ? "" : ",\n", res.name, (unsigned long)res.bytes,
+			(unsigned long)res.iterations, res.ns_per_byte, res.mb_per_s,
+			(unsigned long)res.allocs_cold, (unsigned long)res.allocs,
+			(unsigned long)res.pool_bytes);
+
+		base_mbps = baseline_find(baseline, res.name);
+		if (base_mbps > 0.0) {
+			change = (res.mb_per_s - base_mbps) / base_mbps * 100.0;
+			printf(", \"baseline_mb_per_s\": %.2f, \"change_pct\": %.2f, \"regressed\": %s",
+				base_mbps, change, change < -opt.threshold ? "true" : "false");
+
+			if (change < -opt.threshold) {
+				fprintf(stderr, "%s: %.2f MB/s, %.1f%% slower than the baseline\n",
+					res.name, res.mb_per_s, -change);
+				regressed = 1;
+			}
+		}
+
+		printf(" }");
+		fflush(stdout);
+		first = 0;
+	}
+
+	/* ru_maxrss is in kilobytes on Linux and the BSDs */
+	getrusage(RUSAGE_SELF, &usage_info);
+	printf("\n  ],\n  \"peak_rss_kb\": %ld\n}\n", (long)usage_info.ru_maxrss);
+
+	if (baseline)
+		bufrelease(baseline);
+
+	return regressed ? 2 : 0;
+}
+
+/* vim: set filetype=c: */
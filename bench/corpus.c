@@ -0,0 +1,554 @@
+#include "corpus.h"
+
+#include <string.h>
+
+static const char *words[] = {
+	"the", "parser", "renders", "a", "document", "with", "inline", "spans",
+	"and", "block", "elements", "into", "html", "output", "buffer", "while",
+	"keeping", "memory", "usage", "low", "every", "callback", "receives",
+	"its", "text", "from", "source", "markdown", "line", "list", "item",
+	"table", "cell", "header", "code", "quote", "link", "image", "of",
+	"to", "is", "for", "on", "in", "we", "it", "this", "that", "release",
+	"build", "install", "configure", "option", "value", "default", "fast",
+};
+
+#define WORD_COUNT (sizeof(words) / sizeof(words[0]))
+
+static const char *langs[] = { "c", "python", "ruby", "sh", "js", "" };
+
+/* rng • xorshift32, so corpora are identical on every platform */
+struct rng {
+	uint32_t state;
+};
+
+static uint32_t
+rng_next(struct rng *r)
+{
+	uint32_t x = r->state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return r->state = x;
+}
+
+static unsigned int
+rng_below(struct rng *r, unsigned int n)
+{
+	return rng_next(r) % n;
+}
+
+static void
+rng_init(struct rng *r, uint32_t seed)
+{
+	r->state = seed ? seed : 0x9e3779b9;
+	rng_next(r);
+}
+
+static void
+put_word(struct buf *ob, struct rng *r)
+{
+	bufputs(ob, words[rng_below(r, WORD_COUNT)]);
+}
+
+/* put_sentence • plain words, optionally decorated with inline markup */
+static void
+put_sentence(struct buf *ob, struct rng *r, int markup)
+{
+	unsigned int i, n = 4 + rng_below(r, 12);
+
+	for (i = 0; i < n; ++i) {
+		if (i)
+			bufputc(ob, ' ');
+
+		switch (markup ? rng_below(r, 24) : 23) {
+		case 0:
+			bufputc(ob, '*');
+			put_word(ob, r);
+			bufputc(ob, '*');
+			break;
+		case 1:
+			BUFPUTSL(ob, "**");
+			put_word(ob, r);
+			BUFPUTSL(ob, "**");
+			break;
+		case 2:
+			bufputc(ob, '`');
+			put_word(ob, r);
+			BUFPUTSL(ob, "()`");
+			break;
+		case 3:
+			bufputc(ob, '[');
+			put_word(ob, r);
+			BUFPUTSL(ob, "](http://example.com/");
+			put_word(ob, r);
+			bufputc(ob, ')');
+			break;
+		case 4:
+			BUFPUTSL(ob, "http://www.example.org/");
+			put_word(ob, r);
+			break;
+		case 5:
+			BUFPUTSL(ob, "&amp; ");
+			put_word(ob, r);
+			break;
+		case 6:
+			BUFPUTSL(ob, "_");
+			put_word(ob, r);
+			BUFPUTSL(ob, "_");
+			break;
+		default:
+			put_word(ob, r);
+			break;
+		}
+	}
+
+	bufputc(ob, rng_below(r, 5) ? '.' : '?');
+}
+
+static void
+put_paragraph(struct buf *ob, struct rng *r, int markup)
+{
+	unsigned int i, n = 1 + rng_below(r, 5);
+
+	for (i = 0; i < n; ++i) {
+		put_sentence(ob, r, markup);
+		bufputc(ob, rng_below(r, 3) ? ' ' : '\n');
+	}
+
+	BUFPUTSL(ob, "\n\n");
+}
+
+static void
+put_fence(struct buf *ob, struct rng *r, unsigned int lines)
+{
+	unsigned int i;
+
+	bufprintf(ob, "```%s\n", langs[rng_below(r, sizeof(langs) / sizeof(langs[0]))]);
+	for (i = 0; i < lines; ++i) {
+		bufprintf(ob, "%*s", (int)(rng_below(r, 4) * 4), "");
+		put_word(ob, r);
+		bufputc(ob, '(');
+		put_word(ob, r);
+		BUFPUTSL(ob, ", 0x");
+		bufprintf(ob, "%x", rng_next(r) & 0xffff);
+		BUFPUTSL(ob, ");\n");
+	}
+	BUFPUTSL(ob, "```\n\n");
+}
+
+static void
+put_list(struct buf *ob, struct rng *r, int depth, int max_depth)
+{
+	unsigned int i, n = 2 + rng_below(r, 4);
+	int ordered = rng_below(r, 3) == 0;
+
+	for (i = 0; i < n; ++i) {
+		bufprintf(ob, "%*s", depth * 4, "");
+		if (ordered)
+			bufprintf(ob, "%u. ", i + 1);
+		else
+			BUFPUTSL(ob, "* ");
+
+		put_sentence(ob, r, 1);
+		bufputc(ob, '\n');
+
+		if (depth + 1 < max_depth && rng_below(r, 3) == 0)
+			put_list(ob, r, depth + 1, max_depth);
+	}
+
+	if (depth == 0)
+		bufputc(ob, '\n');
+}
+
+static void
+put_table(struct buf *ob, struct rng *r, unsigned int cols, unsigned int rows)
+{
+	static const char *align[] = { "---", ":--", "--:", ":-:" };
+	unsigned int i, j;
+
+	for (j = 0; j < cols; ++j) {
+		BUFPUTSL(ob, "| ");
+		put_word(ob, r);
+		bufputc(ob, ' ');
+	}
+	BUFPUTSL(ob, "|\n");
+
+	for (j = 0; j < cols; ++j)
+		bufprintf(ob, "|%s", align[rng_below(r, 4)]);
+	BUFPUTSL(ob, "|\n");
+
+	for (i = 0; i < rows; ++i) {
+		for (j = 0; j < cols; ++j) {
+			BUFPUTSL(ob, "| ");
+			if (rng_below(r, 4) == 0)
+				bufprintf(ob, "`%u`", rng_next(r) % 1000);
+			else
+				put_word(ob, r);
+			bufputc(ob, ' ');
+		}
+		BUFPUTSL(ob, "|\n");
+	}
+
+	bufputc(ob, '\n');
+}
+
+/*************************
+ * REALISTIC DOCUMENTS *
+ *************************/
+
+static void
+gen_readme(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	BUFPUTSL(ob, "# Project\n\n[![build](https://ci.example.com/badge.svg)](https://ci.example.com)\n\n");
+
+	while (ob->size - start < size) {
+		BUFPUTSL(ob, "## ");
+		put_word(ob, &r);
+		bufputc(ob, ' ');
+		put_word(ob, &r);
+		BUFPUTSL(ob, "\n\n");
+
+		put_paragraph(ob, &r, 1);
+
+		switch (rng_below(&r, 3)) {
+		case 0: put_fence(ob, &r, 2 + rng_below(&r, 6)); break;
+		case 1: put_list(ob, &r, 0, 2); break;
+		default: put_paragraph(ob, &r, 1); break;
+		}
+	}
+}
+
+static void
+gen_apidocs(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		BUFPUTSL(ob, "### `");
+		put_word(ob, &r);
+		BUFPUTSL(ob, "_");
+		put_word(ob, &r);
+		BUFPUTSL(ob, "(struct buf *ob, size_t size)`\n\n");
+
+		put_paragraph(ob, &r, 1);
+		BUFPUTSL(ob, "**Parameters**\n\n");
+		put_table(ob, &r, 3, 2 + rng_below(&r, 3));
+		BUFPUTSL(ob, "**Example**\n\n");
+		put_fence(ob, &r, 3 + rng_below(&r, 5));
+		BUFPUTSL(ob, "* * *\n\n");
+	}
+}
+
+static void
+gen_comments(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		bufprintf(ob, "**@user%u** wrote:\n\n", rng_below(&r, 500));
+
+		if (rng_below(&r, 3) == 0) {
+			BUFPUTSL(ob, "> ");
+			put_sentence(ob, &r, 1);
+			BUFPUTSL(ob, "\n>\n> ");
+			put_sentence(ob, &r, 0);
+			BUFPUTSL(ob, "\n\n");
+		}
+
+		put_sentence(ob, &r, 1);
+		if (rng_below(&r, 4) == 0)
+			BUFPUTSL(ob, " <br> see https://example.com/issues/42  \n");
+		BUFPUTSL(ob, "\n\n");
+
+		if (rng_below(&r, 2) == 0)
+			put_paragraph(ob, &r, 1);
+
+		BUFPUTSL(ob, "---\n\n");
+	}
+}
+
+static void
+gen_tables(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		put_sentence(ob, &r, 0);
+		BUFPUTSL(ob, "\n\n");
+		put_table(ob, &r, 2 + rng_below(&r, 6), 4 + rng_below(&r, 20));
+	}
+}
+
+static void
+gen_nested_lists(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		put_list(ob, &r, 0, 6);
+		put_paragraph(ob, &r, 0);
+	}
+}
+
+static void
+gen_code_heavy(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	unsigned int i, n;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		put_sentence(ob, &r, 1);
+		BUFPUTSL(ob, "\n\n");
+		put_fence(ob, &r, 10 + rng_below(&r, 30));
+
+		n = 3 + rng_below(&r, 10);
+		for (i = 0; i < n; ++i) {
+			BUFPUTSL(ob, "    ");
+			put_word(ob, &r);
+			BUFPUTSL(ob, " = ");
+			put_word(ob, &r);
+			BUFPUTSL(ob, "(&ob, \"<tag>\");\n");
+		}
+		bufputc(ob, '\n');
+	}
+}
+
+/***************************
+ * ADVERSARIAL DOCUMENTS *
+ ***************************/
+
+/* emphasis openers which never close, all in one paragraph */
+static void
+gen_emphasis_bomb(struct buf *ob, size_t size, uint32_t seed)
+{
+	static const char *openers[] = { "*", "**", "_", "__", "***", "~~" };
+	size_t start = ob->size;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		bufputs(ob, openers[rng_below(&r, 6)]);
+		put_word(ob, &r);
+		bufputc(ob, ' ');
+	}
+
+	bufputc(ob, '\n');
+}
+
+/* deeply nested and unbalanced brackets */
+static void
+gen_bracket_nest(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	unsigned int i, depth;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		depth = 1 + rng_below(&r, 64);
+
+		for (i = 0; i < depth; ++i)
+			bufputc(ob, rng_below(&r, 4) ? '[' : '!');
+
+		put_word(ob, &r);
+
+		for (i = 0; i < depth / 2; ++i)
+			BUFPUTSL(ob, "](");
+
+		bufputc(ob, ' ');
+	}
+
+	bufputc(ob, '\n');
+}
+
+/* backtick runs of mismatched lengths */
+static void
+gen_backtick_runs(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	unsigned int i, n;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		n = 1 + rng_below(&r, 16);
+		for (i = 0; i < n; ++i)
+			bufputc(ob, '`');
+
+		put_word(ob, &r);
+		bufputc(ob, ' ');
+	}
+
+	bufputc(ob, '\n');
+}
+
+/* block-level html openers which are never closed */
+static void
+gen_unclosed_html(struct buf *ob, size_t size, uint32_t seed)
+{
+	static const char *tags[] = { "div", "table", "pre", "p", "blockquote", "ins" };
+	size_t start = ob->size;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		bufprintf(ob, "<%s>\n", tags[rng_below(&r, 6)]);
+		put_sentence(ob, &r, 0);
+		BUFPUTSL(ob, "\n\n");
+	}
+}
+
+/* one list, nested as deep as the parser allows, without blank lines */
+static void
+gen_list_nest(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	unsigned int depth;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		depth = rng_below(&r, 24);
+		bufprintf(ob, "%*s%s ", depth * 2, "", rng_below(&r, 2) ? "*" : "1.");
+		put_sentence(ob, &r, 1);
+		bufputc(ob, '\n');
+	}
+}
+
+/* one blockquote with varying nesting, continued lazily */
+static void
+gen_quote_nest(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	unsigned int i, depth;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		depth = rng_below(&r, 32);
+
+		for (i = 0; i < depth; ++i)
+			BUFPUTSL(ob, "> ");
+
+		put_sentence(ob, &r, 1);
+		bufputc(ob, '\n');
+	}
+}
+
+/* one table with wide rows, escaped and code-spanned pipes */
+static void
+gen_table_wide(struct buf *ob, size_t size, uint32_t seed)
+{
+	size_t start = ob->size;
+	unsigned int j, cols;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	cols = 32;
+	for (j = 0; j < cols; ++j)
+		BUFPUTSL(ob, "| h ");
+	BUFPUTSL(ob, "|\n");
+	for (j = 0; j < cols; ++j)
+		BUFPUTSL(ob, "|:-:");
+	BUFPUTSL(ob, "|\n");
+
+	while (ob->size - start < size) {
+		for (j = 0; j < cols + rng_below(&r, 8); ++j) {
+			switch (rng_below(&r, 4)) {
+			case 0: BUFPUTSL(ob, "| `a|b` "); break;
+			case 1: BUFPUTSL(ob, "| \\| "); break;
+			default: BUFPUTSL(ob, "| "); put_word(ob, &r); bufputc(ob, ' '); break;
+			}
+		}
+		BUFPUTSL(ob, "|\n");
+	}
+}
+
+/* autolink triggers which mostly fail, all in one paragraph */
+static void
+gen_autolink_runs(struct buf *ob, size_t size, uint32_t seed)
+{
+	static const char *triggers[] = {
+		"http:", "://", "www.", "www.www.", "a@", "@b", "a.b@c", "ftp://x/(((",
+	};
+	size_t start = ob->size;
+	struct rng r;
+
+	rng_init(&r, seed);
+
+	while (ob->size - start < size) {
+		put_word(ob, &r);
+		bufputs(ob, triggers[rng_below(&r, 8)]);
+		put_word(ob, &r);
+		bufputc(ob, rng_below(&r, 2) ? ' ' : '.');
+	}
+
+	bufputc(ob, '\n');
+}
+
+const struct corpus_family corpus_families[] = {
+	{ "readme",		0, 256 * 1024, gen_readme },
+	{ "apidocs",		0, 256 * 1024, gen_apidocs },
+	{ "comments",		0, 256 * 1024, gen_comments },
+	{ "tables",		0, 256 * 1024, gen_tables },
+	{ "nested_lists",	0, 256 * 1024, gen_nested_lists },
+	{ "code_heavy",		0, 256 * 1024, gen_code_heavy },
+	{ "emphasis_bomb",	1, 32 * 1024, gen_emphasis_bomb },
+	{ "bracket_nest",	1, 32 * 1024, gen_bracket_nest },
+	{ "backtick_runs",	1, 32 * 1024, gen_backtick_runs },
+	{ "unclosed_html",	1, 32 * 1024, gen_unclosed_html },
+	{ "list_nest",		1, 32 * 1024, gen_list_nest },
+	{ "quote_nest",		1, 32 * 1024, gen_quote_nest },
+	{ "table_wide",		1, 32 * 1024, gen_table_wide },
+	{ "autolink_runs",	1, 32 * 1024, gen_autolink_runs },
+};
+
+const size_t corpus_family_count = sizeof(corpus_families) / sizeof(corpus_families[0]);
+
+const struct corpus_family *
+corpus_find(const char *name)
+{
+	size_t i;
+
+	for (i = 0; i < corpus_family_count; ++i) {
+		if (strcmp(corpus_families[i].name, name) == 0)
+			return &corpus_families[i];
+	}
+
+	return NULL;
+}
+
+void
+corpus_generate(struct buf *ob, const struct corpus_family *family, size_t size, uint32_t seed)
+{
+	family->generate(ob, size, seed);
+}
+
+/* vim: set filetype=c: */
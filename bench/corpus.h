@@ -0,0 +1,30 @@
+#ifndef SUNDOWN_BENCH_CORPUS_H
+#define SUNDOWN_BENCH_CORPUS_H
+
+#include "buffer.h"
+
+#include <stdint.h>
+
+/* corpus_family • one kind of generated document */
+struct corpus_family {
+	const char *name;
+	int adversarial;
+	size_t default_size;	/* bytes */
+	void (*generate)(struct buf *ob, size_t size, uint32_t seed);
+};
+
+extern const struct corpus_family corpus_families[];
+extern const size_t corpus_family_count;
+
+/* corpus_find • looks up a family by name, NULL when unknown */
+extern const struct corpus_family *
+corpus_find(const char *name);
+
+/* corpus_generate • appends about `size` bytes of the family to `ob`.
+ * The output only depends on the family, size and seed */
+extern void
+corpus_generate(struct buf *ob, const struct corpus_family *family, size_t size, uint32_t seed);
+
+#endif
+
+/* vim: set filetype=c: */
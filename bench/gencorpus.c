@@ -0,0 +1,97 @@
+#include "corpus.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static void
+usage(const char *name)
+{
+	size_t i;
+
+	fprintf(stderr, "Usage: %s [-s bytes] [-S seed] outdir [family...]\n\nFamilies:\n", name);
+	for (i = 0; i < corpus_family_count; ++i)
+		fprintf(stderr, "  %-16s%s, %lu bytes\n", corpus_families[i].name,
+			corpus_families[i].adversarial ? "adversarial" : "realistic",
+			(unsigned long)corpus_families[i].default_size);
+}
+
+static int
+write_family(const char *dir, const struct corpus_family *family, size_t size, uint32_t seed)
+{
+	char path[1024];
+	struct buf *ob;
+	FILE *out;
+	int ret = 0;
+
+	snprintf(path, sizeof(path), "%s/%s.md", dir, family->name);
+
+	out = fopen(path, "wb");
+	if (!out) {
+		fprintf(stderr, "Unable to open output file \"%s\": %s\n", path, strerror(errno));
+		return 1;
+	}
+
+	ob = bufnew(64 * 1024);
+	corpus_generate(ob, family, size ? size : family->default_size, seed);
+
+	if (fwrite(ob->data, 1, ob->size, out) != ob->size)
+		ret = 1;
+
+	fclose(out);
+	bufrelease(ob);
+	return ret;
+}
+
+/* main • writes one markdown file per family into the output directory */
+int
+main(int argc, char **argv)
+{
+	size_t size = 0;
+	uint32_t seed = 1;
+	const char *dir;
+	int i, ret = 0;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; ++i) {
+		if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			size = strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-S") == 0 && i + 1 < argc)
+			seed = strtoul(argv[++i], NULL, 10);
+		else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (i >= argc) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	dir = argv[i++];
+
+	if (i == argc) {
+		size_t f;
+
+		for (f = 0; f < corpus_family_count; ++f)
+			ret |= write_family(dir, &corpus_families[f], size, seed);
+
+		return ret;
+	}
+
+	for (; i < argc; ++i) {
+		const struct corpus_family *family = corpus_find(argv[i]);
+
+		if (!family) {
+			fprintf(stderr, "Unknown family \"%s\"\n", argv[i]);
+			return 1;
+		}
+
+		ret |= write_family(dir, family, size, seed);
+	}
+
+	return ret;
+}
+
+/* vim: set filetype=c: */
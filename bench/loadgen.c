@@ -0,0 +1,459 @@
+#include "markdown.h"
+#include "html.h"
+#include "buffer.h"
+#include "timer.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#define READ_UNIT 1024
+#define OUTPUT_UNIT 64
+#define MAX_DOCS 4096
+#define MAX_THREADS 256
+
+#define ALL_EXTENSIONS (MKDEXT_NO_INTRA_EMPHASIS | MKDEXT_TABLES | \
+	MKDEXT_FENCED_CODE | MKDEXT_AUTOLINK | MKDEXT_STRIKETHROUGH | \
+	MKDEXT_SUPERSCRIPT | MKDEXT_LAX_SPACING)
+
+/* latency histogram: 16 linear sub-buckets per power of two, which keeps
+ * the error of every percentile under 6.25% */
+#define HIST_SUB_BITS 4
+#define HIST_SUB (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS (64 * HIST_SUB)
+
+enum loadgen_mode {
+	MODE_PER_THREAD,	/* one sd_markdown per thread */
+	MODE_SHARED,		/* one sd_markdown behind a mutex */
+};
+
+struct loadgen {
+	enum loadgen_mode mode;
+	unsigned int threads;
+	uint64_t duration_ns;
+	size_t iterations;	/* per thread, when no duration is set */
+	unsigned int extensions;
+
+	struct buf *docs[MAX_DOCS];
+	size_t doc_count;
+
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+
+	/* shared mode */
+	struct sd_markdown *shared;
+	struct sd_render_stats shared_stats;
+	pthread_mutex_t lock;
+
+	uint64_t start;
+};
+
+struct worker {
+	struct loadgen *lg;
+	unsigned int id;
+
+	size_t renders;
+	size_t bytes;
+	size_t allocs;
+	size_t pool_bytes;	/* retained by the thread's parser */
+	uint64_t busy_ns;
+	uint64_t wait_ns;	/* waiting for the shared parser */
+	uint64_t hist[HIST_BUCKETS];
+};
+
+static size_t
+hist_index(uint64_t v)
+{
+	unsigned int msb = 0;
+
+	if (v < HIST_SUB)
+		return (size_t)v;
+
+	while ((v >> msb) > 1)
+		msb++;
+
+	return (size_t)(msb - HIST_SUB_BITS + 1) * HIST_SUB +
+		(size_t)((v >> (msb - HIST_SUB_BITS)) & (HIST_SUB - 1));
+}
+
+/* hist_value • upper bound of a bucket */
+static uint64_t
+hist_value(size_t idx)
+{
+	uint64_t sub, shift;
+
+	if (idx < HIST_SUB)
+		return idx;
+
+	shift = idx / HIST_SUB - 1;
+	sub = idx % HIST_SUB;
+
+	return ((HIST_SUB + sub + 1) << shift) - 1;
+}
+
+static uint64_t
+hist_percentile(const uint64_t *hist, uint64_t total, double pct)
+{
+	uint64_t rank = (uint64_t)(total * pct / 100.0), seen = 0;
+	size_t i;
+
+	if (rank >= total)
+		rank = total - 1;
+
+	for (i = 0; i < HIST_BUCKETS; ++i) {
+		seen += hist[i];
+		if (seen > rank)
+			return hist_value(i);
+	}
+
+	return 0;
+}
+
+/* current_rss_kb • resident set size right now, or the peak when unknown */
+static long
+current_rss_kb(void)
+{
+	struct rusage usage_info;
+	long pages = 0;
+	FILE *statm;
+
+	statm = fopen("/proc/self/statm", "r");
+	if (statm) {
+		int ok = (fscanf(statm, "%*d %ld", &pages) == 1);
+		fclose(statm);
+
+		if (ok)
+			return pages * (sysconf(_SC_PAGESIZE) / 1024);
+	}
+
+	getrusage(RUSAGE_SELF, &usage_info);
+	return (long)usage_info.ru_maxrss;
+}
+
+static struct buf *
+read_file(const char *path)
+{
+	struct buf *ib;
+	size_t ret;
+	FILE *in;
+
+	in = fopen(path, "rb");
+	if (!in)
+		return NULL;
+
+	ib = bufnew(READ_UNIT);
+	bufgrow(ib, READ_UNIT);
+	while ((ret = fread(ib->data + ib->size, 1, ib->asize - ib->size, in)) > 0) {
+		ib->size += ret;
+		bufgrow(ib, ib->size + READ_UNIT);
+	}
+
+	fclose(in);
+	return ib;
+}
+
+/* load_corpus • reads every .md file of a directory */
+static int
+load_corpus(struct loadgen *lg, const char *dir)
+{
+	struct dirent *entry;
+	char path[1024];
+	DIR *d;
+
+	d = opendir(dir);
+	if (!d) {
+		fprintf(stderr, "Unable to open corpus directory \"%s\": %s\n", dir, strerror(errno));
+		return -1;
+	}
+
+	while ((entry = readdir(d)) != NULL && lg->doc_count < MAX_DOCS) {
+		size_t len = strlen(entry->d_name);
+		struct buf *doc;
+
+		if (len < 4 || strcmp(entry->d_name + len - 3, ".md") != 0)
+			continue;
+
+		snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name);
+		doc = read_file(path);
+		if (doc)
+			lg->docs[lg->doc_count++] = doc;
+	}
+
+	closedir(d);
+
+	if (lg->doc_count == 0) {
+		fprintf(stderr, "No .md files in \"%s\"\n", dir);
+		return -1;
+	}
+
+	return 0;
+}
+
+static void *
+worker_run(void *arg)
+{
+	struct worker *w = arg;
+	struct loadgen *lg = w->lg;
+	struct sd_markdown *md = NULL;
+	struct sd_render_stats stats;
+	struct buf *ob;
+	size_t n, doc = w->id % lg->doc_count;
+	uint64_t t0, t1, t2;
+
+	ob = bufnew(OUTPUT_UNIT);
+
+	if (lg->mode == MODE_PER_THREAD) {
+		md = sd_markdown_new(lg->extensions, 16, &lg->callbacks, &lg->options);
+		sd_markdown_set_stats(md, &stats);
+	}
+
+	for (n = 0; ; ++n) {
+		const struct buf *in = lg->docs[doc];
+
+		if (lg->duration_ns) {
+			if (sd_timer_ns() - lg->start >= lg->duration_ns)
+				break;
+		} else if (n >= lg->iterations) {
+			break;
+		}
+
+		ob->size = 0;
+		t0 = sd_timer_ns();
+
+		if (lg->mode == MODE_SHARED) {
+			pthread_mutex_lock(&lg->lock);
+			t1 = sd_timer_ns();
+			sd_markdown_render(ob, in->data, in->size, lg->shared);
+			w->allocs += lg->shared_stats.allocs;
+			pthread_mutex_unlock(&lg->lock);
+		} else {
+			t1 = t0;
+			sd_markdown_render(ob, in->data, in->size, md);
+			w->allocs += stats.allocs;
+		}
+
+		t2 = sd_timer_ns();
+
+		w->hist[hist_index(t2 - t0)]++;
+		w->wait_ns += t1 - t0;
+		w->busy_ns += t2 - t0;
+		w->renders++;
+		w->bytes += in->size;
+
+		doc = (doc + 1) % lg->doc_count;
+	}
+
+	if (md) {
+		w->pool_bytes = stats.pool_bytes;
+		sd_markdown_free(md);
+	}
+
+	bufrelease(ob);
+	return NULL;
+}
+
+static void
+usage(const char *name)
+{
+	fprintf(stderr,
+		"Usage: %s [options] corpus-dir\n\n"
+		"  -t threads   worker threads (default: 4)\n"
+		"  -d seconds   run for a fixed duration (default: 10)\n"
+		"  -n renders   run a fixed number of renders per thread instead\n"
+		"  -m mode      'thread': one parser per thread (default)\n"
+		"               'shared': one parser shared behind a mutex\n"
+		"  -e flags     markdown extensions (default: %u)\n"
+		"  -j           print JSON instead of text\n", name, (unsigned int)ALL_EXTENSIONS);
+}
+
+/* main • renders the corpus from many threads and reports latencies */
+int
+main(int argc, char **argv)
+{
+	static struct loadgen lg;
+	static struct worker workers[MAX_THREADS];
+	static uint64_t hist[HIST_BUCKETS];
+	static const double pcts[] = { 50.0, 90.0, 99.0, 99.9 };
+	static const char *pct_names[] = { "p50", "p90", "p99", "p999" };
+
+	pthread_t tids[MAX_THREADS];
+	uint64_t elapsed, renders = 0, bytes = 0, wait = 0, busy = 0, allocs = 0;
+	double seconds, best_rate = 0.0, worst_rate = 0.0;
+	long rss_before, rss_after;
+	unsigned int t;
+	size_t i, p;
+	int json = 0;
+
+	lg.mode = MODE_PER_THREAD;
+	lg.threads = 4;
+	lg.duration_ns = 10 * 1000000000ULL;
+	lg.extensions = ALL_EXTENSIONS;
+
+	for (i = 1; i < (size_t)argc && argv[i][0] == '-'; ++i) {
+		if (strcmp(argv[i], "-j") == 0) {
+			json = 1;
+			continue;
+		}
+
+		if (i + 1 >= (size_t)argc) {
+			usage(argv[0]);
+			return 1;
+		}
+
+		if (strcmp(argv[i], "-t") == 0)
+			lg.threads = strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-d") == 0)
+			lg.duration_ns = (uint64_t)(strtod(argv[++i], NULL) * 1e9);
+		else if (strcmp(argv[i], "-n") == 0) {
+			lg.iterations = strtoul(argv[++i], NULL, 10);
+			lg.duration_ns = 0;
+		} else if (strcmp(argv[i], "-e") == 0)
+			lg.extensions = strtoul(argv[++i], NULL, 0);
+		else if (strcmp(argv[i], "-m") == 0) {
+			++i;
+			if (strcmp(argv[i], "shared") == 0)
+				lg.mode = MODE_SHARED;
+			else if (strcmp(argv[i], "thread") == 0)
+				lg.mode = MODE_PER_THREAD;
+			else {
+				usage(argv[0]);
+				return 1;
+			}
+		} else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (i + 1 != (size_t)argc || lg.threads == 0 || lg.threads > MAX_THREADS ||
+		(lg.duration_ns == 0 && lg.iterations == 0)) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	if (load_corpus(&lg, argv[i]) < 0)
+		return 1;
+
+	sdhtml_renderer(&lg.callbacks, &lg.options, 0);
+
+	if (lg.mode == MODE_SHARED) {
+		lg.shared = sd_markdown_new(lg.extensions, 16, &lg.callbacks, &lg.options);
+		sd_markdown_set_stats(lg.shared, &lg.shared_stats);
+		pthread_mutex_init(&lg.lock, NULL);
+	}
+
+	rss_before = current_rss_kb();
+	lg.start = sd_timer_ns();
+
+	for (t = 0; t < lg.threads; ++t) {
+		workers[t].lg = &lg;
+		workers[t].id = t;
+
+		if (pthread_create(&tids[t], NULL, worker_run, &workers[t]) != 0) {
+			fprintf(stderr, "Unable to start thread %u\n", t);
+			return 1;
+		}
+	}
+
+	/* the parsers are still alive: their work buffers count towards it */
+	for (t = 0; t < lg.threads; ++t)
+		pthread_join(tids[t], NULL);
+
+	elapsed = sd_timer_ns() - lg.start;
+	rss_after = current_rss_kb();
+	seconds = elapsed / 1e9;
+
+	for (t = 0; t < lg.threads; ++t) {
+		struct worker *w = &workers[t];
+		double rate = w->busy_ns ? w->renders / (w->busy_ns / 1e9) : 0.0;
+
+		for (p = 0; p < HIST_BUCKETS; ++p)
+			hist[p] += w->hist[p];
+
+		renders += w->renders;
+		bytes += w->bytes;
+		wait += w->wait_ns;
+		busy += w->busy_ns;
+		allocs += w->allocs;
+
+		if (t == 0 || rate > best_rate)
+			best_rate = rate;
+		if (t == 0 || rate < worst_rate)
+			worst_rate = rate;
+	}
+
+	if (renders == 0) {
+		fprintf(stderr, "No render completed\n");
+		return 1;
+	}
+
+	if (json) {
+		printf("{\n  \"mode\": \"%s\",\n  \"threads\": %u,\n  \"documents\": %lu,\n",
+			lg.mode == MODE_SHARED ? "shared" : "thread", lg.threads, (unsigned long)lg.doc_count);
+		printf("  \"seconds\": %.3f,\n  \"renders\": %llu,\n  \"renders_per_s\": %.1f,\n  \"mb_per_s\": %.2f,\n",
+			seconds, (unsigned long long)renders, renders / seconds, bytes / seconds / 1e6);
+		printf("  \"latency_ns\": { ");
+		for (p = 0; p < 4; ++p)
+			printf("%s\"%s\": %llu", p ? ", " : "", pct_names[p],
+				(unsigned long long)hist_percentile(hist, renders, pcts[p]));
+		printf(" },\n");
+		printf("  \"lock_wait_pct\": %.2f,\n  \"allocs_per_render\": %.3f,\n",
+			busy ? 100.0 * wait / busy : 0.0, (double)allocs / renders);
+		printf("  \"rss_kb\": { \"before\": %ld, \"after\": %ld, \"growth\": %ld },\n",
+			rss_before, rss_after, rss_after - rss_before);
+		if (lg.mode == MODE_SHARED)
+			printf("  \"pool_bytes\": %lu,\n", (unsigned long)lg.shared_stats.pool_bytes);
+		printf("  \"workers\": [\n");
+		for (t = 0; t < lg.threads; ++t) {
+			struct worker *w = &workers[t];
+
+			printf("    { \"id\": %u, \"renders\": %lu, \"renders_per_s\": %.1f, \"lock_wait_ns\": %llu",
+				t, (unsigned long)w->renders,
+				w->busy_ns ? w->renders / (w->busy_ns / 1e9) : 0.0,
+				(unsigned long long)w->wait_ns);
+			if (lg.mode == MODE_PER_THREAD)
+				printf(", \"pool_bytes\": %lu", (unsigned long)w->pool_bytes);
+			printf(" }%s\n", t + 1 < lg.threads ? "," : "");
+		}
+		printf("  ]\n}\n");
+	} else {
+		printf("%s mode, %u threads, %lu documents, %.2f s\n\n",
+			lg.mode == MODE_SHARED ? "shared" : "per-thread", lg.threads,
+			(unsigned long)lg.doc_count, seconds);
+		printf("throughput   %.1f renders/s, %.2f MB/s\n", renders / seconds, bytes / seconds / 1e6);
+		printf("latency     ");
+		for (p = 0; p < 4; ++p)
+			printf(" %s %.1f us", pct_names[p], hist_percentile(hist, renders, pcts[p]) / 1e3);
+		printf("\n");
+		printf("per thread   %.1f to %.1f renders/s\n", worst_rate, best_rate);
+		printf("contention   %.2f%% of render time waiting for the parser lock, %.3f allocs per render\n",
+			busy ? 100.0 * wait / busy : 0.0, (double)allocs / renders);
+		printf("memory       RSS %ld KB -> %ld KB (%+ld KB)", rss_before, rss_after, rss_after - rss_before);
+		if (lg.mode == MODE_PER_THREAD) {
+			size_t pool = 0;
+
+			for (t = 0; t < lg.threads; ++t)
+				pool += workers[t].pool_bytes;
+
+			printf(", %lu KB retained per parser", (unsigned long)(pool / lg.threads / 1024));
+		}
+		printf("\n");
+	}
+
+	if (lg.shared) {
+		sd_markdown_free(lg.shared);
+		pthread_mutex_destroy(&lg.lock);
+	}
+
+	for (i = 0; i < lg.doc_count; ++i)
+		bufrelease(lg.docs[i]);
+
+	return 0;
+}
+
+/* vim: set filetype=c: */
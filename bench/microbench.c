@@ -0,0 +1,596 @@
+/* The parser kernels are static: the translation unit is included whole,
+ * so this file must be linked without src/markdown.o */
+#include "../src/markdown.c"
+
+#include "html.h"
+#include "houdini.h"
+#include "autolink.h"
+#include "corpus.h"
+
+#include <stdio.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/********************
+ * COUNTERS         *
+ ********************/
+
+enum counter_id {
+	CNT_CYCLES,
+	CNT_INSTRUCTIONS,
+	CNT_BRANCH_MISSES,
+	CNT_CACHE_MISSES,
+	CNT_COUNT
+};
+
+struct counters {
+	int fd[CNT_COUNT];
+	int available;
+	uint64_t value[CNT_COUNT];
+};
+
+#ifdef __linux__
+static int
+counter_open(uint64_t config, int group)
+{
+	struct perf_event_attr attr;
+
+	memset(&attr, 0x0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.config = config;
+	attr.disabled = (group < 0);
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP;
+
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group, 0);
+}
+#endif
+
+/* counters_init • opens the hardware counters as one group, so that they
+ * are scheduled together; leaves them unavailable on failure */
+static void
+counters_init(struct counters *c)
+{
+	size_t i;
+
+	memset(c, 0x0, sizeof(*c));
+	for (i = 0; i < CNT_COUNT; ++i)
+		c->fd[i] = -1;
+
+#ifdef __linux__
+	{
+		static const uint64_t config[CNT_COUNT] = {
+			PERF_COUNT_HW_CPU_CYCLES,
+			PERF_COUNT_HW_INSTRUCTIONS,
+			PERF_COUNT_HW_BRANCH_MISSES,
+			PERF_COUNT_HW_CACHE_MISSES,
+		};
+
+		for (i = 0; i < CNT_COUNT; ++i) {
+			c->fd[i] = counter_open(config[i], i ? c->fd[0] : -1);
+			if (c->fd[i] < 0)
+				break;
+		}
+
+		if (i == CNT_COUNT) {
+			c->available = 1;
+			return;
+		}
+
+		while (i-- > 0)
+			close(c->fd[i]);
+
+		for (i = 0; i < CNT_COUNT; ++i)
+			c->fd[i] = -1;
+	}
+#endif
+}
+
+static void
+counters_start(struct counters *c)
+{
+#ifdef __linux__
+	if (c->available) {
+		ioctl(c->fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(c->fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+#endif
+}
+
+static void
+counters_stop(struct counters *c)
+{
+#ifdef __linux__
+	uint64_t data[1 + CNT_COUNT];
+	size_t i;
+
+	if (!c->available)
+		return;
+
+	ioctl(c->fd[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+	if (read(c->fd[0], data, sizeof(data)) != (ssize_t)sizeof(data) || data[0] != CNT_COUNT) {
+		c->available = 0;
+		return;
+	}
+
+	for (i = 0; i < CNT_COUNT; ++i)
+		c->value[i] = data[1 + i];
+#endif
+}
+
+static void
+counters_free(struct counters *c)
+{
+#ifdef __linux__
+	size_t i;
+
+	for (i = 0; i < CNT_COUNT; ++i) {
+		if (c->fd[i] >= 0)
+			close(c->fd[i]);
+	}
+#endif
+}
+
+/********************
+ * KERNELS          *
+ ********************/
+
+struct kernel_ctx {
+	struct sd_markdown *md;
+	struct buf *ob;
+	struct buf *link;
+	struct sdhtml_smartypants_stream *smartypants;
+
+	struct buf *prose;	/* generated markdown */
+	struct buf *tabbed;	/* code with tab indentation */
+	struct buf *refs;	/* reference definitions mixed with prose */
+	struct buf *urls;	/* link targets, one per line */
+	struct buf *links;	/* prose dense with autolinks */
+	struct buf *html;	/* rendered prose, for smartypants */
+};
+
+struct kernel {
+	const char *name;
+	struct buf *(*input)(struct kernel_ctx *ctx);
+	void (*run)(struct kernel_ctx *ctx, struct buf *in);
+};
+
+static struct buf *in_prose(struct kernel_ctx *ctx) { return ctx->prose; }
+static struct buf *in_tabbed(struct kernel_ctx *ctx) { return ctx->tabbed; }
+static struct buf *in_refs(struct kernel_ctx *ctx) { return ctx->refs; }
+static struct buf *in_urls(struct kernel_ctx *ctx) { return ctx->urls; }
+static struct buf *in_links(struct kernel_ctx *ctx) { return ctx->links; }
+static struct buf *in_html(struct kernel_ctx *ctx) { return ctx->html; }
+
+/* paragraph_end • end of the block starting at `beg` */
+static size_t
+paragraph_end(const struct buf *in, size_t beg)
+{
+	size_t i = beg;
+
+	while (i + 1 < in->size && !(in->data[i] == '\n' && in->data[i + 1] == '\n'))
+		i++;
+
+	return i + 1 < in->size ? i + 1 : in->size;
+}
+
+static void
+run_parse_inline(struct kernel_ctx *ctx, struct buf *in)
+{
+	size_t beg = 0, end;
+
+	while (beg < in->size) {
+		end = paragraph_end(in, beg);
+		ctx->ob->size = 0;
+		parse_inline(ctx->ob, ctx->md, in->data + beg, end - beg);
+		beg = end + 1;
+	}
+}
+
+static void
+run_find_emph_char(struct kernel_ctx *ctx, struct buf *in)
+{
+	size_t beg = 0, end, i;
+
+	while (beg < in->size) {
+		end = paragraph_end(in, beg);
+
+		for (i = beg; i < end; ++i) {
+			uint8_t c = in->data[i];
+
+			if (c == '*' || c == '_' || c == '~')
+				find_emph_char(in->data + i + 1, end - i - 1, c);
+		}
+
+		beg = end + 1;
+	}
+}
+
+static void
+run_is_ref(struct kernel_ctx *ctx, struct buf *in)
+{
+	struct link_ref *refs[REF_TABLE_SIZE];
+	size_t beg = 0, end;
+
+	memset(refs, 0x0, sizeof(refs));
+
+	while (beg < in->size) {
+		if (is_ref(in->data, beg, in->size, &end, refs)) {
+			beg = end;
+		} else {
+			while (beg < in->size && in->data[beg] != '\n')
+				beg++;
+			beg++;
+		}
+	}
+
+	free_link_refs(refs);
+}
+
+static void
+run_expand_tabs(struct kernel_ctx *ctx, struct buf *in)
+{
+	size_t beg = 0, end;
+
+	ctx->ob->size = 0;
+
+	while (beg < in->size) {
+		end = beg;
+		while (end < in->size && in->data[end] != '\n')
+			end++;
+
+		expand_tabs(ctx->ob, in->data + beg, end - beg, NULL, 0);
+		bufputc(ctx->ob, '\n');
+		beg = end + 1;
+	}
+}
+
+static void
+run_escape_html(struct kernel_ctx *ctx, struct buf *in)
+{
+	ctx->ob->size = 0;
+	houdini_escape_html0(ctx->ob, in->data, in->size, 0);
+}
+
+static void
+run_escape_href(struct kernel_ctx *ctx, struct buf *in)
+{
+	size_t beg = 0, end;
+
+	ctx->ob->size = 0;
+
+	while (beg < in->size) {
+		end = beg;
+		while (end < in->size && in->data[end] != '\n')
+			end++;
+
+		houdini_escape_href(ctx->ob, in->data + beg, end - beg);
+		beg = end + 1;
+	}
+}
+
+static void
+run_smartypants(struct kernel_ctx *ctx, struct buf *in)
+{
+	ctx->ob->size = 0;
+	sdhtml_smartypants(ctx->ob, in->data, in->size);
+}
+
+/* the same input in the 64k reads of examples/smartypants.c */
+static void
+run_smartypants_feed(struct kernel_ctx *ctx, struct buf *in)
+{
+	size_t i, n;
+
+	ctx->ob->size = 0;
+
+	for (i = 0; i < in->size; i += n) {
+		n = in->size - i < 65536 ? in->size - i : 65536;
+		sdhtml_smartypants_feed(ctx->ob, ctx->smartypants, in->data + i, n);
+	}
+
+	sdhtml_smartypants_finish(ctx->ob, ctx->smartypants);
+}
+
+/* the autolink scanners are called at their trigger characters, with the
+ * offset bounded by the start of the buffer as in char_autolink_* */
+static void
+run_autolink(struct kernel_ctx *ctx, struct buf *in, uint8_t trigger,
+	size_t (*scan)(size_t *, struct buf *, uint8_t *, size_t, size_t, unsigned int))
+{
+	size_t i, rewind;
+
+	for (i = 0; i < in->size; ++i) {
+		if (in->data[i] != trigger)
+			continue;
+
+		ctx->link->size = 0;
+		scan(&rewind, ctx->link, in->data + i, i, in->size - i, 0);
+	}
+}
+
+static void
+run_autolink_url(struct kernel_ctx *ctx, struct buf *in)
+{
+	run_autolink(ctx, in, ':', sd_autolink__url);
+}
+
+static void
+run_autolink_www(struct kernel_ctx *ctx, struct buf *in)
+{
+	run_autolink(ctx, in, 'w', sd_autolink__www);
+}
+
+static void
+run_autolink_email(struct kernel_ctx *ctx, struct buf *in)
+{
+	run_autolink(ctx, in, '@', sd_autolink__email);
+}
+
+static const struct kernel kernels[] = {
+	{ "parse_inline",		in_prose,	run_parse_inline },
+	{ "find_emph_char",		in_prose,	run_find_emph_char },
+	{ "is_ref",			in_refs,	run_is_ref },
+	{ "expand_tabs",		in_tabbed,	run_expand_tabs },
+	{ "houdini_escape_html0",	in_prose,	run_escape_html },
+	{ "houdini_escape_href",	in_urls,	run_escape_href },
+	{ "sdhtml_smartypants",		in_html,	run_smartypants },
+	{ "sdhtml_smartypants_feed",	in_html,	run_smartypants_feed },
+	{ "sd_autolink__url",		in_links,	run_autolink_url },
+	{ "sd_autolink__www",		in_links,	run_autolink_www },
+	{ "sd_autolink__email",		in_links,	run_autolink_email },
+};
+
+#define KERNEL_COUNT (sizeof(kernels) / sizeof(kernels[0]))
+
+/********************
+ * INPUTS           *
+ ********************/
+
+static void
+ctx_init(struct kernel_ctx *ctx, size_t size, uint32_t seed)
+{
+	static struct sd_callbacks callbacks;
+	static struct html_renderopt options;
+	struct buf *code;
+	size_t i;
+
+	ctx->ob = bufnew(64 * 1024);
+	ctx->link = bufnew(256);
+	ctx->smartypants = sdhtml_smartypants_new();
+
+	ctx->prose = bufnew(size);
+	corpus_generate(ctx->prose, corpus_find("readme"), size, seed);
+
+	/* code blocks, re-indented with tabs */
+	code = bufnew(size);
+	corpus_generate(code, corpus_find("code_heavy"), size, seed);
+	ctx->tabbed = bufnew(size);
+	for (i = 0; i < code->size; ++i) {
+		if (i + 4 <= code->size && memcmp(code->data + i, "    ", 4) == 0) {
+			bufputc(ctx->tabbed, '\t');
+			i += 3;
+		} else {
+			bufputc(ctx->tabbed, code->data[i]);
+		}
+	}
+	bufrelease(code);
+
+	ctx->refs = bufnew(size);
+	for (i = 0; ctx->refs->size < size; ++i) {
+		bufprintf(ctx->refs, "[ref%lu]: http://example.com/docs/%lu \"Title %lu\"\n",
+			(unsigned long)i, (unsigned long)i, (unsigned long)i);
+		if (i % 8 == 7)
+			BUFPUTSL(ctx->refs, "Some prose between [ref1] definitions.\n\n");
+	}
+
+	ctx->urls = bufnew(size);
+	for (i = 0; ctx->urls->size < size; ++i)
+		bufprintf(ctx->urls, "http://example.com/path/%lu/page?q=a b&x=<%lu>#frag\n",
+			(unsigned long)i, (unsigned long)(i * 7));
+
+	ctx->links = bufnew(size);
+	for (i = 0; ctx->links->size < size; ++i) {
+		switch (i % 3) {
+		case 0: bufprintf(ctx->links, "see http://example.com/issues/%lu?tab=1. ", (unsigned long)i); break;
+		case 1: bufprintf(ctx->links, "or www.example.org/wiki/Page_%lu, ", (unsigned long)i); break;
+		default: bufprintf(ctx->links, "mail user%lu@example.net now\n", (unsigned long)i); break;
+		}
+	}
+
+	sdhtml_renderer(&callbacks, &options, 0);
+	ctx->md = sd_markdown_new(MKDEXT_AUTOLINK | MKDEXT_STRIKETHROUGH | MKDEXT_SUPERSCRIPT,
+		16, &callbacks, &options);
+
+	/* a full render sets up the per-render state parse_inline relies on */
+	ctx->html = bufnew(size * 2);
+	sd_markdown_render(ctx->html, ctx->prose->data, ctx->prose->size, ctx->md);
+}
+
+static void
+ctx_free(struct kernel_ctx *ctx)
+{
+	sd_markdown_free(ctx->md);
+	bufrelease(ctx->ob);
+	bufrelease(ctx->link);
+	sdhtml_smartypants_free(ctx->smartypants);
+	bufrelease(ctx->prose);
+	bufrelease(ctx->tabbed);
+	bufrelease(ctx->refs);
+	bufrelease(ctx->urls);
+	bufrelease(ctx->links);
+	bufrelease(ctx->html);
+}
+
+/********************
+ * DRIVER           *
+ ********************/
+
+struct measure {
+	size_t passes;
+	size_t bytes;
+	uint64_t ns;
+	int counted;
+	uint64_t value[CNT_COUNT];
+};
+
+/* measure_kernel • calibrates the number of passes to `run_ns`, then
+ * keeps the fastest of `runs` timed runs */
+static void
+measure_kernel(struct measure *m, const struct kernel *k, struct kernel_ctx *ctx,
+	struct counters *cnt, unsigned int runs, uint64_t run_ns)
+{
+	struct buf *in = k->input(ctx);
+	uint64_t start, elapsed;
+	unsigned int run;
+	size_t i;
+
+	memset(m, 0x0, sizeof(*m));
+	m->bytes = in->size;
+
+	start = sd_timer_ns();
+	k->run(ctx, in);
+	elapsed = sd_timer_ns() - start;
+
+	m->passes = elapsed ? (size_t)(run_ns / elapsed) : 1000;
+	if (m->passes == 0)
+		m->passes = 1;
+
+	for (run = 0; run < runs; ++run) {
+		counters_start(cnt);
+		start = sd_timer_ns();
+
+		for (i = 0; i < m->passes; ++i)
+			k->run(ctx, in);
+
+		elapsed = sd_timer_ns() - start;
+		counters_stop(cnt);
+
+		if (run == 0 || elapsed < m->ns) {
+			m->ns = elapsed;
+			m->counted = cnt->available;
+			memcpy(m->value, cnt->value, sizeof(m->value));
+		}
+	}
+}
+
+static void
+usage(const char *name)
+{
+	size_t i;
+
+	fprintf(stderr,
+		"Usage: %s [-j] [-s bytes] [-r runs] [-t ms] [kernel...]\n\n"
+		"  -j        print JSON instead of a table\n"
+		"  -s bytes  size of the generated inputs (default: 65536)\n"
+		"  -r runs   timed runs per kernel, the fastest is kept (default: 5)\n"
+		"  -t ms     target duration of each run (default: 50)\n\nKernels:\n", name);
+
+	for (i = 0; i < KERNEL_COUNT; ++i)
+		fprintf(stderr, "  %s\n", kernels[i].name);
+}
+
+/* main • runs the selected kernels and reports per-byte costs */
+int
+main(int argc, char **argv)
+{
+	struct kernel_ctx ctx;
+	struct counters cnt;
+	struct measure m;
+	size_t size = 64 * 1024, k;
+	unsigned int runs = 5;
+	uint64_t run_ns = 50 * 1000000ULL;
+	int i, json = 0, first = 1;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; ++i) {
+		if (strcmp(argv[i], "-j") == 0)
+			json = 1;
+		else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+			size = strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+			runs = strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+			run_ns = strtoull(argv[++i], NULL, 10) * 1000000ULL;
+		else {
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (runs == 0 || size == 0) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	counters_init(&cnt);
+	ctx_init(&ctx, size, 1);
+
+	if (json)
+		printf("{\n  \"counters\": %s,\n  \"kernels\": [\n", cnt.available ? "true" : "false");
+	else if (cnt.available)
+		printf("%-22s %10s %10s %8s %6s %12s %12s\n", "kernel", "bytes", "ns/byte",
+			"cyc/byte", "IPC", "br-miss/KB", "$-miss/KB");
+	else
+		printf("%-22s %10s %10s %10s   (hardware counters unavailable)\n",
+			"kernel", "bytes", "ns/byte", "MB/s");
+
+	for (k = 0; k < KERNEL_COUNT; ++k) {
+		const struct kernel *kern = &kernels[k];
+		double total, kb;
+		int j, selected = (i == argc);
+
+		for (j = i; j < argc; ++j)
+			selected |= (strcmp(argv[j], kern->name) == 0);
+
+		if (!selected)
+			continue;
+
+		measure_kernel(&m, kern, &ctx, &cnt, runs, run_ns);
+
+		total = (double)m.bytes * m.passes;
+		kb = total / 1024.0;
+
+		if (json) {
+			printf("%s    { \"name\": \"%s\", \"bytes\": %lu, \"passes\": %lu, \"ns_per_byte\": %.4f",
+				first ? "" : ",\n", kern->name, (unsigned long)m.bytes,
+				(unsigned long)m.passes, m.ns / total);
+
+			if (m.counted)
+				printf(", \"cycles\": %llu, \"instructions\": %llu, \"branch_misses\": %llu, \"cache_misses\": %llu",
+					(unsigned long long)m.value[CNT_CYCLES],
+					(unsigned long long)m.value[CNT_INSTRUCTIONS],
+					(unsigned long long)m.value[CNT_BRANCH_MISSES],
+					(unsigned long long)m.value[CNT_CACHE_MISSES]);
+
+			printf(" }");
+			first = 0;
+		} else if (m.counted) {
+			printf("%-22s %10lu %10.3f %8.2f %6.2f %12.2f %12.2f\n", kern->name,
+				(unsigned long)m.bytes, m.ns / total,
+				m.value[CNT_CYCLES] / total,
+				m.value[CNT_CYCLES] ? (double)m.value[CNT_INSTRUCTIONS] / m.value[CNT_CYCLES] : 0.0,
+				m.value[CNT_BRANCH_MISSES] / kb,
+				m.value[CNT_CACHE_MISSES] / kb);
+		} else {
+			printf("%-22s %10lu %10.3f %10.2f\n", kern->name,
+				(unsigned long)m.bytes, m.ns / total, total / m.ns * 1e3);
+		}
+	}
+
+	if (json)
+		printf("\n  ]\n}\n");
+
+	ctx_free(&ctx);
+	counters_free(&cnt);
+	return 0;
+}
+
+/* vim: set filetype=c: */
@@ -0,0 +1,239 @@
+#include "markdown.h"
+#include "html.h"
+#include "buffer.h"
+#include "timer.h"
+#include "corpus.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_STEPS 16
+#define MAX_LIMITS 32
+
+/* points faster than this are dominated by noise and left out of the fit */
+#define MIN_FIT_NS (200 * 1000ULL)
+
+#define ALL_EXTENSIONS (MKDEXT_NO_INTRA_EMPHASIS | MKDEXT_TABLES | \
+	MKDEXT_FENCED_CODE | MKDEXT_AUTOLINK | MKDEXT_STRIKETHROUGH | \
+	MKDEXT_SUPERSCRIPT | MKDEXT_LAX_SPACING)
+
+struct scaling_options {
+	size_t base;		/* size of the first step */
+	unsigned int steps;	/* sizes base, 2 base, 4 base... */
+	unsigned int reps;	/* renders per step, the fastest is kept */
+	uint64_t cap_ns;	/* stop growing once a render takes this long */
+	double exponent;	/* highest tolerated growth exponent */
+	int all;		/* include the realistic families */
+};
+
+/* per-family exponent, overriding the default */
+struct scaling_limit {
+	const char *family;
+	double exponent;
+};
+
+struct scaling_point {
+	size_t bytes;
+	uint64_t ns;
+};
+
+/* render_ns • fastest of `reps` renders of the document */
+static uint64_t
+render_ns(struct sd_markdown *md, struct buf *ob, const struct buf *doc, unsigned int reps)
+{
+	uint64_t start, elapsed, best = 0;
+	unsigned int i;
+
+	for (i = 0; i < reps; ++i) {
+		ob->size = 0;
+		start = sd_timer_ns();
+		sd_markdown_render(ob, doc->data, doc->size, md);
+		elapsed = sd_timer_ns() - start;
+
+		if (i == 0 || elapsed < best)
+			best = elapsed;
+	}
+
+	return best;
+}
+
+/* fit_exponent • least-squares slope of log(time) against log(size) */
+static double
+fit_exponent(const struct scaling_point *pts, size_t count, size_t *used)
+{
+	double sx = 0, sy = 0, sxx = 0, sxy = 0, x, y, n;
+	size_t i;
+
+	*used = 0;
+	for (i = 0; i < count; ++i) {
+		if (pts[i].ns < MIN_FIT_NS)
+			continue;
+
+		x = log((double)pts[i].bytes);
+		y = log((double)pts[i].ns);
+		sx += x;
+		sy += y;
+		sxx += x * x;
+		sxy += x * y;
+		(*used)++;
+	}
+
+	if (*used < 3)
+		return 0.0;
+
+	n = (double)*used;
+	return (n * sxy - sx * sy) / (n * sxx - sx * sx);
+}
+
+static double
+family_limit(const char *name, const struct scaling_limit *limits, size_t nlimits, double fallback)
+{
+	size_t i;
+
+	for (i = 0; i < nlimits; ++i) {
+		if (strcmp(limits[i].family, name) == 0)
+			return limits[i].exponent;
+	}
+
+	return fallback;
+}
+
+static void
+usage(const char *name)
+{
+	fprintf(stderr,
+		"Usage: %s [options] [family...]\n\n"
+		"  -a             include the realistic families\n"
+		"  -n bytes       size of the first step (default: 4096)\n"
+		"  -k steps       number of doublings (default: 6)\n"
+		"  -r reps        renders per step, the fastest is kept (default: 5)\n"
+		"  -c ms          stop growing a family past this render time (default: 2000)\n"
+		"  -x exponent    highest tolerated growth exponent (default: 1.25)\n"
+		"  -l family=exp  tolerated exponent for one family\n\n"
+		"Exits with 1 when a family grows faster than tolerated.\n", name);
+}
+
+/* main • renders each family at doubling sizes and checks the growth */
+int
+main(int argc, char **argv)
+{
+	struct scaling_options opt;
+	struct scaling_limit limits[MAX_LIMITS];
+	struct scaling_point pts[MAX_STEPS];
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_markdown *md;
+	struct buf *doc, *ob;
+	size_t f, nlimits = 0;
+	int i, failed = 0;
+
+	opt.base = 4096;
+	opt.steps = 6;
+	opt.reps = 5;
+	opt.cap_ns = 2000 * 1000000ULL;
+	opt.exponent = 1.25;
+	opt.all = 0;
+
+	for (i = 1; i < argc && argv[i][0] == '-'; ++i) {
+		if (strcmp(argv[i], "-a") == 0) {
+			opt.all = 1;
+			continue;
+		}
+
+		if (i + 1 >= argc) {
+			usage(argv[0]);
+			return 2;
+		}
+
+		if (strcmp(argv[i], "-n") == 0)
+			opt.base = strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-k") == 0)
+			opt.steps = strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-r") == 0)
+			opt.reps = strtoul(argv[++i], NULL, 10);
+		else if (strcmp(argv[i], "-c") == 0)
+			opt.cap_ns = strtoull(argv[++i], NULL, 10) * 1000000ULL;
+		else if (strcmp(argv[i], "-x") == 0)
+			opt.exponent = strtod(argv[++i], NULL);
+		else if (strcmp(argv[i], "-l") == 0 && nlimits < MAX_LIMITS) {
+			char *eq = strchr(argv[++i], '=');
+
+			if (!eq) {
+				usage(argv[0]);
+				return 2;
+			}
+
+			*eq = '\0';
+			limits[nlimits].family = argv[i];
+			limits[nlimits].exponent = strtod(eq + 1, NULL);
+			nlimits++;
+		} else {
+			usage(argv[0]);
+			return 2;
+		}
+	}
+
+	if (opt.base == 0 || opt.reps == 0 || opt.steps < 3 || opt.steps > MAX_STEPS) {
+		usage(argv[0]);
+		return 2;
+	}
+
+	doc = bufnew(64 * 1024);
+	ob = bufnew(64 * 1024);
+
+	sdhtml_renderer(&callbacks, &options, 0);
+	md = sd_markdown_new(ALL_EXTENSIONS, 16, &callbacks, &options);
+
+	printf("%-16s %8s %10s %10s  %s\n", "family", "exponent", "limit", "max bytes", "result");
+
+	for (f = 0; f < corpus_family_count; ++f) {
+		const struct corpus_family *family = &corpus_families[f];
+		double exponent, limit;
+		size_t step, count = 0, used;
+		int j, selected = (i == argc) && (family->adversarial || opt.all);
+		const char *result;
+
+		for (j = i; j < argc; ++j)
+			selected |= (strcmp(argv[j], family->name) == 0);
+
+		if (!selected)
+			continue;
+
+		for (step = 0; step < opt.steps; ++step) {
+			doc->size = 0;
+			corpus_generate(doc, family, opt.base << step, 1);
+
+			pts[count].bytes = doc->size;
+			pts[count].ns = render_ns(md, ob, doc, opt.reps);
+
+			if (pts[count++].ns > opt.cap_ns)
+				break;
+		}
+
+		exponent = fit_exponent(pts, count, &used);
+		limit = family_limit(family->name, limits, nlimits, opt.exponent);
+
+		if (used < 3) {
+			result = "inconclusive (too fast to fit, raise -n)";
+		} else if (exponent > limit) {
+			result = "FAIL";
+			failed = 1;
+		} else {
+			result = "ok";
+		}
+
+		printf("%-16s %8.2f %10.2f %10lu  %s\n", family->name, exponent, limit,
+			(unsigned long)pts[count - 1].bytes, result);
+		fflush(stdout);
+	}
+
+	sd_markdown_free(md);
+	bufrelease(doc);
+	bufrelease(ob);
+
+	return failed;
+}
+
+/* vim: set filetype=c: */
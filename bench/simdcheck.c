@@ -0,0 +1,114 @@
+#include "scan.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_INPUT 1024
+
+/* xorshift32, so failures can be reproduced from the seed */
+static uint32_t rng_state;
+
+static uint32_t
+rng_next(void)
+{
+	uint32_t x = rng_state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return rng_state = x;
+}
+
+/* random_set • a charset of 0 to 20 members, a third of them outside ASCII */
+static void
+random_set(struct sd_charset *set, uint8_t *table)
+{
+	unsigned int i, n = rng_next() % 21;
+
+	memset(table, 0x0, 256);
+	for (i = 0; i < n; ++i) {
+		uint8_t c = (uint8_t)(rng_next() % 3 ? rng_next() % 128 : rng_next());
+		table[c] = 1 + (uint8_t)(i % 15);
+	}
+
+	sd_charset_init(set, table);
+}
+
+/* random_input • mostly non-members, with members sprinkled at a
+ * random density so that both long and short runs occur */
+static void
+random_input(uint8_t *data, size_t size, const uint8_t *table)
+{
+	unsigned int density = 1 + rng_next() % 256;
+	size_t i;
+
+	for (i = 0; i < size; ++i) {
+		uint8_t c = (uint8_t)rng_next();
+
+		if (rng_next() % density != 0) {
+			while (table[c])
+				c++;
+		}
+
+		data[i] = c;
+	}
+}
+
+/* main • checks every vector kernel against the scalar one */
+int
+main(int argc, char **argv)
+{
+	static uint8_t buffer[MAX_INPUT + 64];
+	uint8_t table[256];
+	struct sd_charset set;
+	sd_scan_fn scalar, kernel;
+	unsigned long rounds = 200000, r, failures = 0;
+	int level;
+
+	rng_state = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 10) : 0x2545f491;
+	if (argc > 1)
+		rounds = strtoul(argv[1], NULL, 10);
+
+	scalar = sd_scan_kernel(SD_SCAN_SCALAR);
+	printf("detected %s, bound %s\n",
+		sd_scan_level_name(sd_scan_detect()), sd_scan_level_name(sd_scan_level()));
+
+	for (level = SD_SCAN_SSE2; level < SD_SCAN_LEVELS; ++level) {
+		unsigned long failed = 0;
+
+		kernel = sd_scan_kernel((enum sd_scan_level)level);
+		if (!kernel) {
+			printf("%-8s unavailable\n", sd_scan_level_name((enum sd_scan_level)level));
+			continue;
+		}
+
+		for (r = 0; r < rounds; ++r) {
+			size_t size = rng_next() % MAX_INPUT;
+			size_t offset = rng_next() % 64;
+			uint8_t *data = buffer + offset;
+			size_t expect, got;
+
+			random_set(&set, table);
+			random_input(data, size, table);
+
+			expect = scalar(data, size, &set);
+			got = kernel(data, size, &set);
+
+			if (expect != got) {
+				if (failed++ < 5)
+					fprintf(stderr, "%s: size %lu, offset %lu, %lu members: got %lu, expected %lu\n",
+						sd_scan_level_name((enum sd_scan_level)level), (unsigned long)size,
+						(unsigned long)offset, (unsigned long)set.count,
+						(unsigned long)got, (unsigned long)expect);
+			}
+		}
+
+		printf("%-8s %lu rounds, %lu mismatches\n",
+			sd_scan_level_name((enum sd_scan_level)level), rounds, failed);
+		failures += failed;
+	}
+
+	return failures ? 1 : 0;
+}
+
+/* vim: set filetype=c: */
@@ -516,8 +516,9 @@ doc_std(struct buf *ib, FILE *out, char **cmtstarts, char **cmtends,
 			cssfile);
 	fprintf(out, "</head><body>");
 
-	/* contents */
+	/* contents, collecting the headers for the TOC on the way */
 	sdhtml_renderer(&callbacks, &options, HTML_HARD_WRAP|HTML_H_ATTRIBUTES|HTML_TOC);
+	options.toc = sdhtml_toc_new();
 	markdown = sd_markdown_new(
 		MKDEXT_TABLES /* support for tables */
 		| MKDEXT_FENCED_CODE /* allow ~~~ instead of ``` */
@@ -533,15 +534,8 @@ doc_std(struct buf *ib, FILE *out, char **cmtstarts, char **cmtends,
 
 	/* TOC */
 	bufreset(ob);
-	sdhtml_toc_h_renderer(&callbacks, &options, HTML_H_ATTRIBUTES);
-	markdown = sd_markdown_new(
-		MKDEXT_TABLES /* support for tables */
-		| MKDEXT_FENCED_CODE /* allow ~~~ instead of ``` */
-		| MKDEXT_NO_INTRA_EMPHASIS /* no emphasis in identifier with '_' */
-		, 16, &callbacks, &options);
-
-	sd_markdown_render(ob, cb->data, cb->size, markdown);
-	sd_markdown_free(markdown);
+	sdhtml_toc_emit(ob, options.toc);
+	sdhtml_toc_free(options.toc);
 
 	fprintf(out, "<div id=\"Nav\">\n");
 	ret = fwrite(ob->data, 1, ob->size, out);
@@ -635,7 +629,7 @@ static void docco_parse(struct buf *ib, struct stack *doc, struct stack *code) {
 		}
 		prev_line_empty = empty;
 	}
-	printf("found %d/%d sections\n", code->size, doc->size);
+	printf("found %d/%d sections\n", (int)code->size, (int)doc->size);
 	for (i = 0; i < doc->size; i++) {
 		struct buf *b = doc->item[i];
 		bufputc(b, 0);
@@ -0,0 +1,138 @@
+#include "markdown.h"
+#include "html.h"
+#include "buffer.h"
+#include "trace.h"
+#include "timer.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define READ_UNIT 1024
+#define OUTPUT_UNIT 64
+
+/* read_file • reads a whole file, or stdin when `path` is NULL */
+static struct buf *
+read_file(const char *path)
+{
+	struct buf *ib;
+	size_t ret;
+	FILE *in = stdin;
+
+	if (path) {
+		in = fopen(path, "rb");
+		if (!in) {
+			fprintf(stderr,"Unable to open input file \"%s\": %s\n", path, strerror(errno));
+			return NULL;
+		}
+	}
+
+	ib = bufnew(READ_UNIT);
+	bufgrow(ib, READ_UNIT);
+	while ((ret = fread(ib->data + ib->size, 1, ib->asize - ib->size, in)) > 0) {
+		ib->size += ret;
+		bufgrow(ib, ib->size + READ_UNIT);
+	}
+
+	if (in != stdin)
+		fclose(in);
+
+	return ib;
+}
+
+/* record • renders the markdown input, writing the trace to stdout */
+static int
+record(const char *path)
+{
+	struct buf *ib, *ob, *trace;
+	struct sd_callbacks callbacks, traced;
+	struct html_renderopt options;
+	struct sd_markdown *markdown;
+	struct sd_trace *rec;
+	int status;
+
+	ib = read_file(path);
+	if (!ib)
+		return 1;
+
+	ob = bufnew(OUTPUT_UNIT);
+	trace = bufnew(OUTPUT_UNIT);
+
+	sdhtml_renderer(&callbacks, &options, 0);
+	rec = sd_trace_callbacks(&callbacks, &options, &traced, trace);
+	markdown = sd_markdown_new(0, 16, &traced, rec);
+
+	sd_markdown_render(ob, ib->data, ib->size, markdown);
+	sd_markdown_free(markdown);
+	sd_trace_free(rec);
+
+	status = fwrite(trace->data, 1, trace->size, stdout) < trace->size;
+
+	bufrelease(ib);
+	bufrelease(ob);
+	bufrelease(trace);
+
+	return status;
+}
+
+/* replay • drives the HTML renderer from a trace, `passes` times */
+static int
+replay(const char *path, long passes)
+{
+	struct buf *ib, *ob;
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	uint64_t start, elapsed;
+	long i;
+	int status = SD_TRACE_OK;
+
+	ib = read_file(path);
+	if (!ib)
+		return 1;
+
+	ob = bufnew(OUTPUT_UNIT);
+	sdhtml_renderer(&callbacks, &options, 0);
+
+	start = sd_timer_ns();
+	for (i = 0; i < passes && status == SD_TRACE_OK; ++i) {
+		ob->size = 0;
+		status = sd_trace_replay(ob, ib->data, ib->size, &callbacks, &options);
+	}
+	elapsed = sd_timer_ns() - start;
+
+	if (status != SD_TRACE_OK) {
+		fprintf(stderr, "Invalid trace (error %d)\n", status);
+	} else if (passes > 1) {
+		fprintf(stderr, "%ld replays in %.3f ms, %.1f us per replay\n",
+			passes, elapsed / 1e6, elapsed / 1e3 / passes);
+	} else {
+		fwrite(ob->data, 1, ob->size, stdout);
+	}
+
+	bufrelease(ib);
+	bufrelease(ob);
+
+	return (status != SD_TRACE_OK) ? 1 : 0;
+}
+
+/* main • main function, dispatching to record or replay */
+int
+main(int argc, char **argv)
+{
+	if (argc > 1 && strcmp(argv[1], "record") == 0)
+		return record(argc > 2 ? argv[2] : NULL);
+
+	if (argc > 1 && strcmp(argv[1], "replay") == 0) {
+		if (argc > 3 && strcmp(argv[2], "-n") == 0)
+			return replay(argc > 4 ? argv[4] : NULL, strtol(argv[3], NULL, 10));
+
+		return replay(argc > 2 ? argv[2] : NULL, 1);
+	}
+
+	fprintf(stderr, "Usage: %s record [file.md] > file.trace\n", argv[0]);
+	fprintf(stderr, "       %s replay [-n passes] [file.trace]\n", argv[0]);
+	return 1;
+}
+
+/* vim: set filetype=c: */
@@ -24,12 +24,13 @@
 #include <stdlib.h>
 #include <string.h>
 
-#define READ_UNIT 1024
+#define READ_UNIT 65536
 #define OUTPUT_UNIT 64
 
 int
 main(int argc, char **argv)
 {
+	struct sdhtml_smartypants_stream *st;
 	struct buf *ib, *ob;
 	size_t ret;
 	FILE *in = stdin;
@@ -43,26 +44,27 @@ main(int argc, char **argv)
 		}
 	}
 
-	/* reading everything */
 	ib = bufnew(READ_UNIT);
 	bufgrow(ib, READ_UNIT);
-	while ((ret = fread(ib->data + ib->size, 1, ib->asize - ib->size, in)) > 0) {
-		ib->size += ret;
-		bufgrow(ib, ib->size + READ_UNIT);
-	}
-
-	if (in != stdin)
-		fclose(in);
-
-	/* performing markdown parsing */
 	ob = bufnew(OUTPUT_UNIT);
+	st = sdhtml_smartypants_new();
 
-	sdhtml_smartypants(ob, ib->data, ib->size);
+	/* transforming one read at a time, so memory stays constant */
+	while ((ret = fread(ib->data, 1, ib->asize, in)) > 0) {
+		ob->size = 0;
+		sdhtml_smartypants_feed(ob, st, ib->data, ret);
+		(void)fwrite(ob->data, 1, ob->size, stdout);
+	}
 
-	/* writing the result to stdout */
+	ob->size = 0;
+	sdhtml_smartypants_finish(ob, st);
 	(void)fwrite(ob->data, 1, ob->size, stdout);
 
+	if (in != stdin)
+		fclose(in);
+
 	/* cleanup */
+	sdhtml_smartypants_free(st);
 	bufrelease(ib);
 	bufrelease(ob);
 
@@ -2,6 +2,7 @@
 #define HOUDINI_H__
 
 #include "buffer.h"
+#include "chartype.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -14,8 +15,8 @@ extern "C" {
 /*
  * Helper _isdigit methods -- do not trust the current locale
  * */
-#	define _isxdigit(c) (strchr("0123456789ABCDEFabcdef", (c)) != NULL)
-#	define _isdigit(c) ((c) >= '0' && (c) <= '9')
+#	define _isxdigit(c) sd_isxdigit(c)
+#	define _isdigit(c) sd_isdigit(c)
 #endif
 
 extern void houdini_escape_html(struct buf *ob, const uint8_t *src, size_t size);
@@ -29,6 +30,7 @@ extern void houdini_unescape_uri(struct buf *ob, const uint8_t *src, size_t size
 extern void houdini_unescape_url(struct buf *ob, const uint8_t *src, size_t size);
 extern void houdini_escape_js(struct buf *ob, const uint8_t *src, size_t size);
 extern void houdini_unescape_js(struct buf *ob, const uint8_t *src, size_t size);
+extern void houdini_put_utf8(struct buf *ob, unsigned int codepoint);
 
 #ifdef __cplusplus
 }
@@ -3,6 +3,7 @@
 #include <string.h>
 
 #include "houdini.h"
+#include "scan.h"
 
 #define ESCAPE_GROW_FACTOR(x) (((x) * 12) / 10) /* this is very scientific, yes */
 
@@ -36,6 +37,10 @@ static const char HTML_ESCAPE_TABLE[] = {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
+static const struct sd_charset HTML_ESCAPE_SET = {
+	(const uint8_t *)HTML_ESCAPE_TABLE, "\"&'/<>", 6
+};
+
 static const char *HTML_ESCAPES[] = {
         "",
         "&quot;",
@@ -55,8 +60,9 @@ houdini_escape_html0(struct buf *ob, const uint8_t *src, size_t size, int secure
 
 	while (i < size) {
 		org = i;
-		while (i < size && (esc = HTML_ESCAPE_TABLE[src[i]]) == 0)
-			i++;
+		i += sd_scan(src + i, size - i, &HTML_ESCAPE_SET);
+		if (i < size)
+			esc = HTML_ESCAPE_TABLE[src[i]];
 
 		if (i > org)
 			bufput(ob, src + org, i - org);
@@ -0,0 +1,119 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "houdini.h"
+#include "html_entities.h"
+
+#define UNESCAPE_GROW_FACTOR(x) (x)
+
+/* longest name in the WHATWG list ("CounterClockwiseContourIntegral") */
+#define ENTITY_MAX_NAME 32
+
+void
+houdini_put_utf8(struct buf *ob, unsigned int cp)
+{
+	uint8_t out[4];
+
+	/* surrogates and anything past Unicode become U+FFFD */
+	if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF)
+		cp = 0xFFFD;
+
+	if (cp < 0x80) {
+		bufputc(ob, (int)cp);
+	} else if (cp < 0x800) {
+		out[0] = (uint8_t)(0xC0 | (cp >> 6));
+		out[1] = (uint8_t)(0x80 | (cp & 0x3F));
+		bufput(ob, out, 2);
+	} else if (cp < 0x10000) {
+		out[0] = (uint8_t)(0xE0 | (cp >> 12));
+		out[1] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+		out[2] = (uint8_t)(0x80 | (cp & 0x3F));
+		bufput(ob, out, 3);
+	} else {
+		out[0] = (uint8_t)(0xF0 | (cp >> 18));
+		out[1] = (uint8_t)(0x80 | ((cp >> 12) & 0x3F));
+		out[2] = (uint8_t)(0x80 | ((cp >> 6) & 0x3F));
+		out[3] = (uint8_t)(0x80 | (cp & 0x3F));
+		bufput(ob, out, 4);
+	}
+}
+
+/* unescape_ent • decodes the reference after a '&'. Returns the bytes
+ * consumed past the '&', 0 when this is not a complete reference */
+static size_t
+unescape_ent(struct buf *ob, const uint8_t *src, size_t size)
+{
+	size_t i = 0;
+
+	if (size >= 3 && src[0] == '#') {
+		unsigned int cp = 0;
+		size_t digits;
+
+		if (src[1] == 'x' || src[1] == 'X') {
+			for (i = 2; i < size && _isxdigit(src[i]); ++i) {
+				if (cp <= 0x10FFFF)
+					cp = (cp << 4) | (src[i] <= '9' ? src[i] - '0' : (src[i] | 0x20) - 'a' + 10);
+			}
+			digits = i - 2;
+		} else {
+			for (i = 1; i < size && _isdigit(src[i]); ++i) {
+				if (cp <= 0x10FFFF)
+					cp = cp * 10 + (src[i] - '0');
+			}
+			digits = i - 1;
+		}
+
+		if (digits == 0 || i >= size || src[i] != ';')
+			return 0;
+
+		/* HTML never decodes to NUL */
+		houdini_put_utf8(ob, cp ? cp : 0xFFFD);
+		return i + 1;
+	}
+
+	/* named: letters and digits up to the ';' */
+	for (i = 0; i < size && i <= ENTITY_MAX_NAME && sd_isalnum(src[i]); ++i);
+
+	if (i > 0 && i < size && src[i] == ';') {
+		const struct html_ent *entity = find_entity((const char *)src, i);
+
+		if (entity != NULL) {
+			bufput(ob, entity->utf8, entity->utf8_len);
+			return i + 1;
+		}
+	}
+
+	return 0;
+}
+
+void
+houdini_unescape_html(struct buf *ob, const uint8_t *src, size_t size)
+{
+	size_t  i = 0, org, ent;
+	const uint8_t *amp;
+
+	bufgrow(ob, UNESCAPE_GROW_FACTOR(size));
+
+	while (i < size) {
+		org = i;
+		amp = memchr(src + i, '&', size - i);
+		i = amp ? (size_t)(amp - src) : size;
+
+		if (i > org)
+			bufput(ob, src + org, i - org);
+
+		/* escaping */
+		if (i >= size)
+			break;
+
+		i++;
+
+		ent = unescape_ent(ob, src + i, size - i);
+		i += ent;
+
+		/* not an entity: the '&' is plain text */
+		if (!ent)
+			bufputc(ob, '&');
+	}
+}
@@ -0,0 +1,90 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "houdini.h"
+
+#define ESCAPE_GROW_FACTOR(x) (((x) * 12) / 10)
+
+/*
+ * Escapes for a JavaScript string literal, single or double quoted:
+ * the quotes, the backslash, the C0 controls and '/' (so that "</script>"
+ * cannot end an inline script). 0xE2 is checked for U+2028 and U+2029,
+ * which end a line in JavaScript.
+ */
+static const char JS_ESCAPE[] = {
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 
+	0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+void
+houdini_escape_js(struct buf *ob, const uint8_t *src, size_t size)
+{
+	static const char hex_chars[] = "0123456789ABCDEF";
+	size_t  i = 0, org;
+	char ch;
+
+	bufgrow(ob, ESCAPE_GROW_FACTOR(size));
+
+	while (i < size) {
+		org = i;
+		while (i < size && JS_ESCAPE[src[i]] == 0)
+			i++;
+
+		if (i > org)
+			bufput(ob, src + org, i - org);
+
+		/* escaping */
+		if (i >= size)
+			break;
+
+		ch = 0;
+		switch (src[i]) {
+		case '\b': ch = 'b'; break;
+		case '\t': ch = 't'; break;
+		case '\n': ch = 'n'; break;
+		case '\f': ch = 'f'; break;
+		case '\r': ch = 'r'; break;
+		case '"': case '\'': case '\\': case '/':
+			ch = src[i];
+			break;
+
+		case 0xE2:
+			if (i + 2 < size && src[i + 1] == 0x80 &&
+				(src[i + 2] == 0xA8 || src[i + 2] == 0xA9)) {
+				BUFPUTSL(ob, "\\u202");
+				bufputc(ob, src[i + 2] == 0xA8 ? '8' : '9');
+				i += 2;
+			} else {
+				bufputc(ob, src[i]);
+			}
+			i++;
+			continue;
+		}
+
+		if (ch) {
+			bufputc(ob, '\\');
+			bufputc(ob, ch);
+		} else {
+			BUFPUTSL(ob, "\\u00");
+			bufputc(ob, hex_chars[(src[i] >> 4) & 0xF]);
+			bufputc(ob, hex_chars[src[i] & 0xF]);
+		}
+
+		i++;
+	}
+}
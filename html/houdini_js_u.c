@@ -0,0 +1,111 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "houdini.h"
+
+#define UNESCAPE_GROW_FACTOR(x) (x)
+
+/* hex_run • value of `count` hex digits, -1 if any is missing */
+static long
+hex_run(const uint8_t *src, size_t size, size_t count)
+{
+	long value = 0;
+	size_t i;
+
+	if (size < count)
+		return -1;
+
+	for (i = 0; i < count; ++i) {
+		if (!_isxdigit(src[i]))
+			return -1;
+		value = (value << 4) | (src[i] <= '9' ? src[i] - '0' : (src[i] | 0x20) - 'a' + 10);
+	}
+
+	return value;
+}
+
+/* unescape_seq • decodes the sequence after a '\\' and returns the bytes
+ * it used; unknown escapes stand for the character itself */
+static size_t
+unescape_seq(struct buf *ob, const uint8_t *src, size_t size)
+{
+	long cp, low;
+
+	switch (src[0]) {
+	case 'b': bufputc(ob, '\b'); return 1;
+	case 't': bufputc(ob, '\t'); return 1;
+	case 'n': bufputc(ob, '\n'); return 1;
+	case 'v': bufputc(ob, '\v'); return 1;
+	case 'f': bufputc(ob, '\f'); return 1;
+	case 'r': bufputc(ob, '\r'); return 1;
+
+	/* line continuation */
+	case '\n':
+		return 1;
+
+	case '0':
+		if (size < 2 || !_isdigit(src[1])) {
+			bufputc(ob, '\0');
+			return 1;
+		}
+		break;
+
+	case 'x':
+		if ((cp = hex_run(src + 1, size - 1, 2)) >= 0) {
+			houdini_put_utf8(ob, (unsigned int)cp);
+			return 3;
+		}
+		break;
+
+	case 'u':
+		if ((cp = hex_run(src + 1, size - 1, 4)) < 0)
+			break;
+
+		/* surrogate pair: "\uD83D\uDE00" */
+		if (cp >= 0xD800 && cp <= 0xDBFF && size >= 11 &&
+			src[5] == '\\' && src[6] == 'u' &&
+			(low = hex_run(src + 7, size - 7, 4)) >= 0xDC00 && low <= 0xDFFF) {
+			houdini_put_utf8(ob, (unsigned int)(0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00)));
+			return 11;
+		}
+
+		houdini_put_utf8(ob, (unsigned int)cp);
+		return 5;
+	}
+
+	bufputc(ob, src[0]);
+	return 1;
+}
+
+void
+houdini_unescape_js(struct buf *ob, const uint8_t *src, size_t size)
+{
+	size_t  i = 0, org;
+	const uint8_t *esc;
+
+	bufgrow(ob, UNESCAPE_GROW_FACTOR(size));
+
+	while (i < size) {
+		org = i;
+		esc = memchr(src + i, '\\', size - i);
+		i = esc ? (size_t)(esc - src) : size;
+
+		if (i > org)
+			bufput(ob, src + org, i - org);
+
+		/* escaping */
+		if (i >= size)
+			break;
+
+		i++;
+
+		/* a trailing backslash is kept */
+		if (i >= size) {
+			bufputc(ob, '\\');
+			break;
+		}
+
+		i += unescape_seq(ob, src + i, size - i);
+	}
+}
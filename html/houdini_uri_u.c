@@ -0,0 +1,58 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "houdini.h"
+
+#define UNESCAPE_GROW_FACTOR(x) (x)
+
+static inline int
+hex_value(uint8_t c)
+{
+	return c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;
+}
+
+static void
+unescape(struct buf *ob, const uint8_t *src, size_t size, int is_url)
+{
+	size_t  i = 0, org;
+
+	bufgrow(ob, UNESCAPE_GROW_FACTOR(size));
+
+	while (i < size) {
+		org = i;
+		while (i < size && src[i] != '%' && !(is_url && src[i] == '+'))
+			i++;
+
+		if (i > org)
+			bufput(ob, src + org, i - org);
+
+		/* escaping */
+		if (i >= size)
+			break;
+
+		if (src[i] == '+') {
+			bufputc(ob, ' ');
+		} else if (i + 2 < size && _isxdigit(src[i + 1]) && _isxdigit(src[i + 2])) {
+			bufputc(ob, (hex_value(src[i + 1]) << 4) | hex_value(src[i + 2]));
+			i += 2;
+		} else {
+			/* a stray '%' stays as it is */
+			bufputc(ob, '%');
+		}
+
+		i++;
+	}
+}
+
+void
+houdini_unescape_uri(struct buf *ob, const uint8_t *src, size_t size)
+{
+	unescape(ob, src, size, 0);
+}
+
+void
+houdini_unescape_url(struct buf *ob, const uint8_t *src, size_t size)
+{
+	unescape(ob, src, size, 1);
+}
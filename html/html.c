@@ -17,11 +17,11 @@
 
 #include "markdown.h"
 #include "html.h"
+#include "chartype.h"
 
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <ctype.h>
 
 #include "houdini.h"
 
@@ -54,7 +54,7 @@ sdhtml_is_tag(const uint8_t *tag_data, size_t tag_size, const char *tagname)
 	if (i == tag_size)
 		return HTML_TAG_NONE;
 
-	if (isspace(tag_data[i]) || tag_data[i] == '>')
+	if (sd_isspace(tag_data[i]) || tag_data[i] == '>')
 		return closed ? HTML_TAG_CLOSE : HTML_TAG_OPEN;
 
 	return HTML_TAG_NONE;
@@ -70,6 +70,34 @@ static inline void escape_href(struct buf *ob, const uint8_t *source, size_t len
 	houdini_escape_href(ob, source, length);
 }
 
+/* link_verdict • what the link policy says about a URL */
+static inline enum sdhtml_link_verdict
+link_verdict(struct html_renderopt *options, const uint8_t *url, size_t size)
+{
+	if (!options->link_policy)
+		return SDHTML_LINK_ALLOW;
+
+	return sdhtml_policy_check(options->link_policy, url, size);
+}
+
+/* put_href • escaped URL of an allowed link, rewritten when proxied */
+static void
+put_href(struct buf *ob, struct html_renderopt *options,
+	enum sdhtml_link_verdict verdict, const uint8_t *url, size_t size)
+{
+	struct buf *proxied;
+
+	if (verdict != SDHTML_LINK_PROXY) {
+		escape_href(ob, url, size);
+		return;
+	}
+
+	proxied = bufnew(64);
+	sdhtml_policy_rewrite(proxied, options->link_policy, url, size);
+	escape_href(ob, proxied->data, proxied->size);
+	bufrelease(proxied);
+}
+
 /********************
  * GENERIC RENDERER *
  ********************/
@@ -77,6 +105,7 @@ static int
 rndr_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, void *opaque)
 {
 	struct html_renderopt *options = opaque;
+	enum sdhtml_link_verdict verdict;
 
 	if (!link || !link->size)
 		return 0;
@@ -86,10 +115,22 @@ rndr_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, vo
 		type != MKDA_EMAIL)
 		return 0;
 
+	if (type == MKDA_EMAIL)
+		verdict = link_verdict(options, (const uint8_t *)"mailto:", 7);
+	else
+		verdict = link_verdict(options, link->data, link->size);
+
+	/* the parser has already taken the text of the autolink: keep it,
+	 * without the link */
+	if (verdict == SDHTML_LINK_DENY) {
+		escape_html(ob, link->data, link->size);
+		return 1;
+	}
+
 	BUFPUTSL(ob, "<a href=\"");
 	if (type == MKDA_EMAIL)
 		BUFPUTSL(ob, "mailto:");
-	escape_href(ob, link->data, link->size);
+	put_href(ob, options, verdict, link->data, link->size);
 
 	if (options->link_attributes) {
 		bufputc(ob, '\"');
@@ -125,12 +166,12 @@ rndr_blockcode(struct buf *ob, const struct buf *text, const struct buf *lang, v
 		BUFPUTSL(ob, "<pre><code class=\"");
 
 		for (i = 0, cls = 0; i < lang->size; ++i, ++cls) {
-			while (i < lang->size && isspace(lang->data[i]))
+			while (i < lang->size && sd_isspace(lang->data[i]))
 				i++;
 
 			if (i < lang->size) {
 				size_t org = i;
-				while (i < lang->size && !isspace(lang->data[i]))
+				while (i < lang->size && !sd_isspace(lang->data[i]))
 					i++;
 
 				if (lang->data[org] == '.')
@@ -281,13 +322,94 @@ handle_h_attributes(const struct buf *text,
 		break;
 	}
 	/* remove whitespace from the end of the text */
-	while (txt_len > 0 && isspace(text->data[txt_len - 1])) {
+	while (txt_len > 0 && sd_isspace(text->data[txt_len - 1])) {
 		--txt_len;
 	}
 	if (txtlen) *txtlen = txt_len;
 	if (idattr) *idattr = id_attr;
 }
 
+struct toc_entry {
+	int level;
+	size_t at;		/* anchor and text, in sdhtml_toc.data */
+	size_t size;
+};
+
+struct sdhtml_toc {
+	struct toc_entry *entries;
+	size_t count;
+	size_t asize;
+
+	struct buf *data;
+	int h_attributes;	/* entries use the sdhtml_toc_h_renderer format */
+};
+
+/* toc_put_text • the rendered header text, without the links: a TOC
+ * entry is a link already */
+static void
+toc_put_text(struct buf *ob, const uint8_t *text, size_t size)
+{
+	size_t i = 0, org;
+
+	while (i < size) {
+		org = i;
+		while (i < size && text[i] != '<')
+			i++;
+
+		bufput(ob, text + org, i - org);
+
+		if (i >= size)
+			break;
+
+		if (sdhtml_is_tag(text + i, size - i, "a") == HTML_TAG_NONE) {
+			bufputc(ob, '<');
+			i++;
+			continue;
+		}
+
+		while (i < size && text[i] != '>')
+			i++;
+		i++;
+	}
+}
+
+/* toc_collect • records a header for sdhtml_toc_emit, with the anchor
+ * the toc renderers would give it */
+static void
+toc_collect(struct sdhtml_toc *toc, const struct buf *text, int level, int id, unsigned int flags)
+{
+	struct toc_entry *entry;
+	unsigned int txt_len = text ? text->size : 0, id_attr = 0;
+
+	if (toc->count == toc->asize) {
+		size_t asize = toc->asize ? toc->asize * 2 : 16;
+		struct toc_entry *entries = realloc(toc->entries, asize * sizeof(struct toc_entry));
+
+		if (!entries)
+			return;
+
+		toc->entries = entries;
+		toc->asize = asize;
+	}
+
+	entry = &toc->entries[toc->count++];
+	entry->level = level;
+	entry->at = toc->data->size;
+
+	toc->h_attributes = (flags & HTML_H_ATTRIBUTES) != 0;
+
+	if (toc->h_attributes)
+		handle_h_attributes(text, &txt_len, &id_attr, print_href_id, NULL, toc->data);
+
+	if (!id_attr)
+		bufprintf(toc->data, "<a href=\"#toc_%d\">", id);
+
+	if (text)
+		toc_put_text(toc->data, text->data, txt_len);
+
+	entry->size = toc->data->size - entry->at;
+}
+
 static void
 rndr_header(struct buf *ob, const struct buf *text, int level, void *opaque)
 {
@@ -296,6 +418,10 @@ rndr_header(struct buf *ob, const struct buf *text, int level, void *opaque)
 	if (ob->size)
 		bufputc(ob, '\n');
 
+	if (options->toc && (options->flags & HTML_TOC) &&
+		(text || !(options->flags & HTML_H_ATTRIBUTES)))
+		toc_collect(options->toc, text, level, options->toc_data.header_count, options->flags);
+
 	/* Handling of Header-Attributes ( ... {#iiiiddd .cccls}).
 	   The Handling of header attributes is hacked in here:
 	   The original sundown parser does not implement the attribute
@@ -339,14 +465,19 @@ static int
 rndr_link(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
 {
 	struct html_renderopt *options = opaque;
+	enum sdhtml_link_verdict verdict = SDHTML_LINK_ALLOW;
 
 	if (link != NULL && (options->flags & HTML_SAFELINK) != 0 && !sd_autolink_issafe(link->data, link->size))
 		return 0;
 
+	if (link && link->size &&
+		(verdict = link_verdict(options, link->data, link->size)) == SDHTML_LINK_DENY)
+		return 0;
+
 	BUFPUTSL(ob, "<a href=\"");
 
 	if (link && link->size)
-		escape_href(ob, link->data, link->size);
+		put_href(ob, options, verdict, link->data, link->size);
 
 	if (title && title->size) {
 		BUFPUTSL(ob, "\" title=\"");
@@ -400,7 +531,7 @@ rndr_paragraph(struct buf *ob, const struct buf *text, void *opaque)
 	if (!text || !text->size)
 		return;
 
-	while (i < text->size && isspace(text->data[i])) i++;
+	while (i < text->size && sd_isspace(text->data[i])) i++;
 
 	if (i == text->size)
 		return;
@@ -469,10 +600,15 @@ static int
 rndr_image(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *alt, void *opaque)
 {
 	struct html_renderopt *options = opaque;
+	enum sdhtml_link_verdict verdict;
+
 	if (!link || !link->size) return 0;
 
+	if ((verdict = link_verdict(options, link->data, link->size)) == SDHTML_LINK_DENY)
+		return 0;
+
 	BUFPUTSL(ob, "<img src=\"");
-	escape_href(ob, link->data, link->size);
+	put_href(ob, options, verdict, link->data, link->size);
 	BUFPUTSL(ob, "\" alt=\"");
 
 	if (alt && alt->size)
@@ -588,49 +724,73 @@ rndr_superscript(struct buf *ob, const struct buf *text, void *opaque)
 static void
 rndr_normal_text(struct buf *ob, const struct buf *text, void *opaque)
 {
-	if (text)
+	struct html_renderopt *options = opaque;
+
+	if (!text)
+		return;
+
+	if (options->flags & HTML_SMARTYPANTS)
+		sdhtml_smartypants_text(ob, &options->smartypants, text->data, text->size);
+	else
 		escape_html(ob, text->data, text->size);
 }
 
 static void
-toc_h_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+rndr_smartypants_reset(struct buf *ob, void *opaque)
 {
 	struct html_renderopt *options = opaque;
-	if (!text) return;
 
+	memset(&options->smartypants, 0x0, sizeof(options->smartypants));
+}
+
+/* toc_nest • opens the <li> of a header, closing and opening lists to
+ * get to its level; `classes` adds the "l<level>" classes of
+ * sdhtml_toc_h_renderer */
+static void
+toc_nest(struct buf *ob, int *current_level, int *level_offset, int level, int classes)
+{
 	/* set the level offset if this is the first header
 	 * we're parsing for the document */
-	if (options->toc_data.current_level == 0) {
-		options->toc_data.level_offset = level - 1;
-	}
-	unsigned int offl = options->toc_data.level_offset;
-	level -= offl;
-
-	if (level > options->toc_data.current_level) {
-		while (level > options->toc_data.current_level) {
-			options->toc_data.current_level++;
-			bufprintf(ob, "<ul class=\"l%d\">\n<li class=\"l%d\">\n",
-				options->toc_data.current_level + offl,
-				options->toc_data.current_level + offl
-			);
+	if (*current_level == 0)
+		*level_offset = level - 1;
+
+	level -= *level_offset;
+
+	if (level > *current_level) {
+		while (level > *current_level) {
+			(*current_level)++;
+			if (classes)
+				bufprintf(ob, "<ul class=\"l%d\">\n<li class=\"l%d\">\n",
+					*current_level + *level_offset, *current_level + *level_offset);
+			else
+				BUFPUTSL(ob, "<ul>\n<li>\n");
 		}
-	} else if (level < options->toc_data.current_level) {
-		bufputs(ob, "</li>\n");
-		while (level < options->toc_data.current_level) {
-			options->toc_data.current_level--;
-			bufputs(ob, "</ul>\n</li>\n");
-		}
-		bufprintf(ob,"<li class=\"l%d\">\n",
-			options->toc_data.current_level + offl
-		);
-	} else {
-		bufputs(ob, "</li>\n");
-		bufprintf(ob,"<li class=\"l%d\">\n",
-			options->toc_data.current_level + offl
-		);
+		return;
+	}
+
+	BUFPUTSL(ob, "</li>\n");
+
+	while (level < *current_level) {
+		BUFPUTSL(ob, "</ul>\n</li>\n");
+		(*current_level)--;
 	}
 
+	if (classes)
+		bufprintf(ob, "<li class=\"l%d\">\n", *current_level + *level_offset);
+	else
+		BUFPUTSL(ob, "<li>\n");
+}
+
+static void
+toc_h_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+{
+	struct html_renderopt *options = opaque;
 	unsigned int txt_len, id_attr;
+
+	if (!text) return;
+
+	toc_nest(ob, &options->toc_data.current_level, &options->toc_data.level_offset, level, 1);
+
 	handle_h_attributes(text, &txt_len, &id_attr, print_href_id, NULL, ob);
 	if (!id_attr) {
 		bufprintf(ob, "<a href=\"#toc_%d\">", options->toc_data.header_count++);
@@ -644,28 +804,7 @@ toc_header(struct buf *ob, const struct buf *text, int level, void *opaque)
 {
 	struct html_renderopt *options = opaque;
 
-	/* set the level offset if this is the first header
-	 * we're parsing for the document */
-	if (options->toc_data.current_level == 0) {
-		options->toc_data.level_offset = level - 1;
-	}
-	level -= options->toc_data.level_offset;
-
-	if (level > options->toc_data.current_level) {
-		while (level > options->toc_data.current_level) {
-			BUFPUTSL(ob, "<ul>\n<li>\n");
-			options->toc_data.current_level++;
-		}
-	} else if (level < options->toc_data.current_level) {
-		BUFPUTSL(ob, "</li>\n");
-		while (level < options->toc_data.current_level) {
-			BUFPUTSL(ob, "</ul>\n</li>\n");
-			options->toc_data.current_level--;
-		}
-		BUFPUTSL(ob,"<li>\n");
-	} else {
-		BUFPUTSL(ob,"</li>\n<li>\n");
-	}
+	toc_nest(ob, &options->toc_data.current_level, &options->toc_data.level_offset, level, 0);
 
 	bufprintf(ob, "<a href=\"#toc_%d\">", options->toc_data.header_count++);
 	if (text)
@@ -693,6 +832,61 @@ toc_finalize(struct buf *ob, void *opaque)
 	}
 }
 
+struct sdhtml_toc *
+sdhtml_toc_new(void)
+{
+	struct sdhtml_toc *toc;
+
+	toc = malloc(sizeof(struct sdhtml_toc));
+	if (!toc)
+		return NULL;
+
+	memset(toc, 0x0, sizeof(struct sdhtml_toc));
+
+	toc->data = bufnew(64);
+	if (!toc->data) {
+		free(toc);
+		return NULL;
+	}
+
+	return toc;
+}
+
+void
+sdhtml_toc_emit(struct buf *ob, const struct sdhtml_toc *toc)
+{
+	int current_level = 0, level_offset = 0;
+	size_t i;
+
+	for (i = 0; i < toc->count; ++i) {
+		const struct toc_entry *entry = &toc->entries[i];
+
+		toc_nest(ob, &current_level, &level_offset, entry->level, toc->h_attributes);
+		bufput(ob, toc->data->data + entry->at, entry->size);
+
+		if (toc->h_attributes)
+			BUFPUTSL(ob, "</a>");
+		else
+			BUFPUTSL(ob, "</a>\n");
+	}
+
+	while (current_level > 0) {
+		BUFPUTSL(ob, "</li>\n</ul>\n");
+		current_level--;
+	}
+}
+
+void
+sdhtml_toc_free(struct sdhtml_toc *toc)
+{
+	if (!toc)
+		return;
+
+	bufrelease(toc->data);
+	free(toc->entries);
+	free(toc);
+}
+
 void
 sdhtml_toc_h_renderer(struct sd_callbacks *callbacks, struct html_renderopt *options, unsigned int render_flags)
 {
@@ -794,4 +988,21 @@ sdhtml_renderer(struct sd_callbacks *callbacks, struct html_renderopt *options,
 
 	if (render_flags & HTML_SKIP_HTML || render_flags & HTML_ESCAPE)
 		callbacks->blockhtml = NULL;
+
+	if (render_flags & HTML_SMARTYPANTS)
+		callbacks->doc_header = rndr_smartypants_reset;
+}
+
+int
+sdhtml_set_cache(struct sd_markdown *md, struct sd_block_cache *cache, const struct html_renderopt *options)
+{
+	/* state carried from block to block, or that the key cannot see */
+	if (cache && ((options->flags & (HTML_TOC | HTML_SMARTYPANTS)) ||
+		options->link_policy || options->link_attributes || options->toc)) {
+		sd_markdown_set_cache(md, NULL, 0);
+		return -1;
+	}
+
+	sd_markdown_set_cache(md, cache, options->flags);
+	return 0;
 }
@@ -25,6 +25,22 @@
 extern "C" {
 #endif
 
+struct sdhtml_policy;
+struct sdhtml_toc;
+struct sdhtml_smartypants_stream;
+
+/* smartypants state, carried from one text run to the next */
+struct sdhtml_smartypants {
+	int in_squote;
+	int in_dquote;
+
+	/* a '`' or '\' ending the previous run, and where it ended: the
+	 * parser splits "``" and "\\" in two runs */
+	uint8_t tail;
+	const struct buf *tail_ob;
+	size_t tail_at;
+};
+
 struct html_renderopt {
 	struct {
 		int header_count;
@@ -36,6 +52,16 @@ struct html_renderopt {
 
 	/* extra callbacks */
 	void (*link_attributes)(struct buf *ob, const struct buf *url, void *self);
+
+	/* checked on every link, autolink and image; NULL allows all */
+	struct sdhtml_policy *link_policy;
+
+	/* with HTML_TOC, headers are also recorded here for sdhtml_toc_emit;
+	 * NULL records nothing */
+	struct sdhtml_toc *toc;
+
+	/* HTML_SMARTYPANTS state, reset at the start of every render */
+	struct sdhtml_smartypants smartypants;
 };
 
 typedef enum {
@@ -50,8 +76,19 @@ typedef enum {
 	HTML_USE_XHTML = (1 << 8),
 	HTML_ESCAPE = (1 << 9),
 	HTML_H_ATTRIBUTES = (1 << 10),
+	HTML_SMARTYPANTS = (1 << 11),
 } html_render_mode;
 
+enum {
+	SDHTML_POLICY_RELATIVE = (1 << 0),	/* allow links without a scheme */
+};
+
+enum sdhtml_link_verdict {
+	SDHTML_LINK_DENY = 0,
+	SDHTML_LINK_ALLOW,
+	SDHTML_LINK_PROXY,	/* host not allowed: rewrite through the proxy */
+};
+
 typedef enum {
 	HTML_TAG_NONE = 0,
 	HTML_TAG_OPEN,
@@ -70,9 +107,90 @@ sdhtml_toc_renderer(struct sd_callbacks *callbacks, struct html_renderopt *optio
 extern void
 sdhtml_toc_h_renderer(struct sd_callbacks *callbacks, struct html_renderopt *options_ptr, unsigned int render_flags);
 
+/* sdhtml_set_cache • sd_markdown_set_cache for a renderer set up by
+ * sdhtml_renderer. Returns -1 and leaves the cache off when `options`
+ * render a block differently depending on the blocks before it or on
+ * state the cache key does not hold: HTML_TOC, HTML_SMARTYPANTS, a link
+ * policy, link_attributes or a toc recorder */
+extern int
+sdhtml_set_cache(struct sd_markdown *md, struct sd_block_cache *cache, const struct html_renderopt *options);
+
+/* sdhtml_toc_new • header list filled by sdhtml_renderer, so that the
+ * table of contents does not need a second parse. Entries accumulate
+ * over every render that uses it */
+extern struct sdhtml_toc *
+sdhtml_toc_new(void);
+
+/* sdhtml_toc_emit • the nested <ul> of the recorded headers, as written
+ * by sdhtml_toc_renderer, or by sdhtml_toc_h_renderer for renders with
+ * HTML_H_ATTRIBUTES. The header text keeps its inline markup */
+extern void
+sdhtml_toc_emit(struct buf *ob, const struct sdhtml_toc *toc);
+
+extern void
+sdhtml_toc_free(struct sdhtml_toc *toc);
+
 extern void
 sdhtml_smartypants(struct buf *ob, const uint8_t *text, size_t size);
 
+/* sdhtml_smartypants_new • streaming smartypants: the document may be
+ * fed in chunks of any size, with output matching sdhtml_smartypants */
+extern struct sdhtml_smartypants_stream *
+sdhtml_smartypants_new(void);
+
+/* sdhtml_smartypants_feed • transforms a chunk, holding back at most a
+ * few bytes that need the next chunk to be decided */
+extern void
+sdhtml_smartypants_feed(struct buf *ob, struct sdhtml_smartypants_stream *st, const uint8_t *data, size_t size);
+
+/* sdhtml_smartypants_finish • flushes the held bytes at the end of the
+ * document; the stream is then ready for the next one */
+extern void
+sdhtml_smartypants_finish(struct buf *ob, struct sdhtml_smartypants_stream *st);
+
+extern void
+sdhtml_smartypants_free(struct sdhtml_smartypants_stream *st);
+
+/* sdhtml_smartypants_text • smartypants over raw text, escaping it for
+ * HTML in the same pass. This is what HTML_SMARTYPANTS runs on every
+ * text callback; code spans, code blocks and raw HTML never reach it */
+extern void
+sdhtml_smartypants_text(struct buf *ob, struct sdhtml_smartypants *smrt, const uint8_t *text, size_t size);
+
+/* sdhtml_policy_new • empty link policy: every scheme is refused until
+ * allowed, and every host is accepted until the first host rule */
+extern struct sdhtml_policy *
+sdhtml_policy_new(unsigned int flags);
+
+extern void
+sdhtml_policy_free(struct sdhtml_policy *policy);
+
+/* sdhtml_policy_allow_scheme • allows a scheme, without the ':'.
+ * Matching ignores case. Returns 0, or -1 on a malformed scheme */
+extern int
+sdhtml_policy_allow_scheme(struct sdhtml_policy *policy, const char *scheme);
+
+/* sdhtml_policy_allow_host • allows a host ("example.com"), or all the
+ * subdomains of one ("*.example.com"). Hosts are only checked on URLs
+ * with an authority ("//host") */
+extern int
+sdhtml_policy_allow_host(struct sdhtml_policy *policy, const char *host);
+
+/* sdhtml_policy_set_proxy • links to hosts outside the allowlist are
+ * rewritten to `prefix` followed by the percent-encoded URL instead of
+ * being refused. NULL or "" removes the proxy */
+extern int
+sdhtml_policy_set_proxy(struct sdhtml_policy *policy, const char *prefix);
+
+/* sdhtml_policy_check • one pass over the scheme and host of `url` */
+extern enum sdhtml_link_verdict
+sdhtml_policy_check(const struct sdhtml_policy *policy, const uint8_t *url, size_t size);
+
+/* sdhtml_policy_rewrite • appends the proxied form of `url` (not escaped
+ * for HTML) */
+extern void
+sdhtml_policy_rewrite(struct buf *ob, const struct sdhtml_policy *policy, const uint8_t *url, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
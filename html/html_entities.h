@@ -0,0 +1,2518 @@
+/*
+ * HTML5 named character references, from the WHATWG list (the ones
+ * terminated by ';'). Generated by html_entities.py from
+ * html_entities.gperf with `make html_entities`: do not edit.
+ */
+
+#define HTML_ENTITY_COUNT 2125
+#define HTML_ENTITY_MAX_LENGTH 31
+
+struct html_ent {
+	const char *entity;
+	unsigned char utf8_len;
+	const char *utf8;
+};
+
+static const struct html_ent html_entities[HTML_ENTITY_COUNT] = {
+	{ "AElig", 2, "\xC3\x86" },
+	{ "AMP", 1, "\x26" },
+	{ "Aacute", 2, "\xC3\x81" },
+	{ "Abreve", 2, "\xC4\x82" },
+	{ "Acirc", 2, "\xC3\x82" },
+	{ "Acy", 2, "\xD0\x90" },
+	{ "Afr", 4, "\xF0\x9D\x94\x84" },
+	{ "Agrave", 2, "\xC3\x80" },
+	{ "Alpha", 2, "\xCE\x91" },
+	{ "Amacr", 2, "\xC4\x80" },
+	{ "And", 3, "\xE2\xA9\x93" },
+	{ "Aogon", 2, "\xC4\x84" },
+	{ "Aopf", 4, "\xF0\x9D\x94\xB8" },
+	{ "ApplyFunction", 3, "\xE2\x81\xA1" },
+	{ "Aring", 2, "\xC3\x85" },
+	{ "Ascr", 4, "\xF0\x9D\x92\x9C" },
+	{ "Assign", 3, "\xE2\x89\x94" },
+	{ "Atilde", 2, "\xC3\x83" },
+	{ "Auml", 2, "\xC3\x84" },
+	{ "Backslash", 3, "\xE2\x88\x96" },
+	{ "Barv", 3, "\xE2\xAB\xA7" },
+	{ "Barwed", 3, "\xE2\x8C\x86" },
+	{ "Bcy", 2, "\xD0\x91" },
+	{ "Because", 3, "\xE2\x88\xB5" },
+	{ "Bernoullis", 3, "\xE2\x84\xAC" },
+	{ "Beta", 2, "\xCE\x92" },
+	{ "Bfr", 4, "\xF0\x9D\x94\x85" },
+	{ "Bopf", 4, "\xF0\x9D\x94\xB9" },
+	{ "Breve", 2, "\xCB\x98" },
+	{ "Bscr", 3, "\xE2\x84\xAC" },
+	{ "Bumpeq", 3, "\xE2\x89\x8E" },
+	{ "CHcy", 2, "\xD0\xA7" },
+	{ "COPY", 2, "\xC2\xA9" },
+	{ "Cacute", 2, "\xC4\x86" },
+	{ "Cap", 3, "\xE2\x8B\x92" },
+	{ "CapitalDifferentialD", 3, "\xE2\x85\x85" },
+	{ "Cayleys", 3, "\xE2\x84\xAD" },
+	{ "Ccaron", 2, "\xC4\x8C" },
+	{ "Ccedil", 2, "\xC3\x87" },
+	{ "Ccirc", 2, "\xC4\x88" },
+	{ "Cconint", 3, "\xE2\x88\xB0" },
+	{ "Cdot", 2, "\xC4\x8A" },
+	{ "Cedilla", 2, "\xC2\xB8" },
+	{ "CenterDot", 2, "\xC2\xB7" },
+	{ "Cfr", 3, "\xE2\x84\xAD" },
+	{ "Chi", 2, "\xCE\xA7" },
+	{ "CircleDot", 3, "\xE2\x8A\x99" },
+	{ "CircleMinus", 3, "\xE2\x8A\x96" },
+	{ "CirclePlus", 3, "\xE2\x8A\x95" },
+	{ "CircleTimes", 3, "\xE2\x8A\x97" },
+	{ "ClockwiseContourIntegral", 3, "\xE2\x88\xB2" },
+	{ "CloseCurlyDoubleQuote", 3, "\xE2\x80\x9D" },
+	{ "CloseCurlyQuote", 3, "\xE2\x80\x99" },
+	{ "Colon", 3, "\xE2\x88\xB7" },
+	{ "Colone", 3, "\xE2\xA9\xB4" },
+	{ "Congruent", 3, "\xE2\x89\xA1" },
+	{ "Conint", 3, "\xE2\x88\xAF" },
+	{ "ContourIntegral", 3, "\xE2\x88\xAE" },
+	{ "Copf", 3, "\xE2\x84\x82" },
+	{ "Coproduct", 3, "\xE2\x88\x90" },
+	{ "CounterClockwiseContourIntegral", 3, "\xE2\x88\xB3" },
+	{ "Cross", 3, "\xE2\xA8\xAF" },
+	{ "Cscr", 4, "\xF0\x9D\x92\x9E" },
+	{ "Cup", 3, "\xE2\x8B\x93" },
+	{ "CupCap", 3, "\xE2\x89\x8D" },
+	{ "DD", 3, "\xE2\x85\x85" },
+	{ "DDotrahd", 3, "\xE2\xA4\x91" },
+	{ "DJcy", 2, "\xD0\x82" },
+	{ "DScy", 2, "\xD0\x85" },
+	{ "DZcy", 2, "\xD0\x8F" },
+	{ "Dagger", 3, "\xE2\x80\xA1" },
+	{ "Darr", 3, "\xE2\x86\xA1" },
+	{ "Dashv", 3, "\xE2\xAB\xA4" },
+	{ "Dcaron", 2, "\xC4\x8E" },
+	{ "Dcy", 2, "\xD0\x94" },
+	{ "Del", 3, "\xE2\x88\x87" },
+	{ "Delta", 2, "\xCE\x94" },
+	{ "Dfr", 4, "\xF0\x9D\x94\x87" },
+	{ "DiacriticalAcute", 2, "\xC2\xB4" },
+	{ "DiacriticalDot", 2, "\xCB\x99" },
+	{ "DiacriticalDoubleAcute", 2, "\xCB\x9D" },
+	{ "DiacriticalGrave", 1, "\x60" },
+	{ "DiacriticalTilde", 2, "\xCB\x9C" },
+	{ "Diamond", 3, "\xE2\x8B\x84" },
+	{ "DifferentialD", 3, "\xE2\x85\x86" },
+	{ "Dopf", 4, "\xF0\x9D\x94\xBB" },
+	{ "Dot", 2, "\xC2\xA8" },
+	{ "DotDot", 3, "\xE2\x83\x9C" },
+	{ "DotEqual", 3, "\xE2\x89\x90" },
+	{ "DoubleContourIntegral", 3, "\xE2\x88\xAF" },
+	{ "DoubleDot", 2, "\xC2\xA8" },
+	{ "DoubleDownArrow", 3, "\xE2\x87\x93" },
+	{ "DoubleLeftArrow", 3, "\xE2\x87\x90" },
+	{ "DoubleLeftRightArrow", 3, "\xE2\x87\x94" },
+	{ "DoubleLeftTee", 3, "\xE2\xAB\xA4" },
+	{ "DoubleLongLeftArrow", 3, "\xE2\x9F\xB8" },
+	{ "DoubleLongLeftRightArrow", 3, "\xE2\x9F\xBA" },
+	{ "DoubleLongRightArrow", 3, "\xE2\x9F\xB9" },
+	{ "DoubleRightArrow", 3, "\xE2\x87\x92" },
+	{ "DoubleRightTee", 3, "\xE2\x8A\xA8" },
+	{ "DoubleUpArrow", 3, "\xE2\x87\x91" },
+	{ "DoubleUpDownArrow", 3, "\xE2\x87\x95" },
+	{ "DoubleVerticalBar", 3, "\xE2\x88\xA5" },
+	{ "DownArrow", 3, "\xE2\x86\x93" },
+	{ "DownArrowBar", 3, "\xE2\xA4\x93" },
+	{ "DownArrowUpArrow", 3, "\xE2\x87\xB5" },
+	{ "DownBreve", 2, "\xCC\x91" },
+	{ "DownLeftRightVector", 3, "\xE2\xA5\x90" },
+	{ "DownLeftTeeVector", 3, "\xE2\xA5\x9E" },
+	{ "DownLeftVector", 3, "\xE2\x86\xBD" },
+	{ "DownLeftVectorBar", 3, "\xE2\xA5\x96" },
+	{ "DownRightTeeVector", 3, "\xE2\xA5\x9F" },
+	{ "DownRightVector", 3, "\xE2\x87\x81" },
+	{ "DownRightVectorBar", 3, "\xE2\xA5\x97" },
+	{ "DownTee", 3, "\xE2\x8A\xA4" },
+	{ "DownTeeArrow", 3, "\xE2\x86\xA7" },
+	{ "Downarrow", 3, "\xE2\x87\x93" },
+	{ "Dscr", 4, "\xF0\x9D\x92\x9F" },
+	{ "Dstrok", 2, "\xC4\x90" },
+	{ "ENG", 2, "\xC5\x8A" },
+	{ "ETH", 2, "\xC3\x90" },
+	{ "Eacute", 2, "\xC3\x89" },
+	{ "Ecaron", 2, "\xC4\x9A" },
+	{ "Ecirc", 2, "\xC3\x8A" },
+	{ "Ecy", 2, "\xD0\xAD" },
+	{ "Edot", 2, "\xC4\x96" },
+	{ "Efr", 4, "\xF0\x9D\x94\x88" },
+	{ "Egrave", 2, "\xC3\x88" },
+	{ "Element", 3, "\xE2\x88\x88" },
+	{ "Emacr", 2, "\xC4\x92" },
+	{ "EmptySmallSquare", 3, "\xE2\x97\xBB" },
+	{ "EmptyVerySmallSquare", 3, "\xE2\x96\xAB" },
+	{ "Eogon", 2, "\xC4\x98" },
+	{ "Eopf", 4, "\xF0\x9D\x94\xBC" },
+	{ "Epsilon", 2, "\xCE\x95" },
+	{ "Equal", 3, "\xE2\xA9\xB5" },
+	{ "EqualTilde", 3, "\xE2\x89\x82" },
+	{ "Equilibrium", 3, "\xE2\x87\x8C" },
+	{ "Escr", 3, "\xE2\x84\xB0" },
+	{ "Esim", 3, "\xE2\xA9\xB3" },
+	{ "Eta", 2, "\xCE\x97" },
+	{ "Euml", 2, "\xC3\x8B" },
+	{ "Exists", 3, "\xE2\x88\x83" },
+	{ "ExponentialE", 3, "\xE2\x85\x87" },
+	{ "Fcy", 2, "\xD0\xA4" },
+	{ "Ffr", 4, "\xF0\x9D\x94\x89" },
+	{ "FilledSmallSquare", 3, "\xE2\x97\xBC" },
+	{ "FilledVerySmallSquare", 3, "\xE2\x96\xAA" },
+	{ "Fopf", 4, "\xF0\x9D\x94\xBD" },
+	{ "ForAll", 3, "\xE2\x88\x80" },
+	{ "Fouriertrf", 3, "\xE2\x84\xB1" },
+	{ "Fscr", 3, "\xE2\x84\xB1" },
+	{ "GJcy", 2, "\xD0\x83" },
+	{ "GT", 1, "\x3E" },
+	{ "Gamma", 2, "\xCE\x93" },
+	{ "Gammad", 2, "\xCF\x9C" },
+	{ "Gbreve", 2, "\xC4\x9E" },
+	{ "Gcedil", 2, "\xC4\xA2" },
+	{ "Gcirc", 2, "\xC4\x9C" },
+	{ "Gcy", 2, "\xD0\x93" },
+	{ "Gdot", 2, "\xC4\xA0" },
+	{ "Gfr", 4, "\xF0\x9D\x94\x8A" },
+	{ "Gg", 3, "\xE2\x8B\x99" },
+	{ "Gopf", 4, "\xF0\x9D\x94\xBE" },
+	{ "GreaterEqual", 3, "\xE2\x89\xA5" },
+	{ "GreaterEqualLess", 3, "\xE2\x8B\x9B" },
+	{ "GreaterFullEqual", 3, "\xE2\x89\xA7" },
+	{ "GreaterGreater", 3, "\xE2\xAA\xA2" },
+	{ "GreaterLess", 3, "\xE2\x89\xB7" },
+	{ "GreaterSlantEqual", 3, "\xE2\xA9\xBE" },
+	{ "GreaterTilde", 3, "\xE2\x89\xB3" },
+	{ "Gscr", 4, "\xF0\x9D\x92\xA2" },
+	{ "Gt", 3, "\xE2\x89\xAB" },
+	{ "HARDcy", 2, "\xD0\xAA" },
+	{ "Hacek", 2, "\xCB\x87" },
+	{ "Hat", 1, "\x5E" },
+	{ "Hcirc", 2, "\xC4\xA4" },
+	{ "Hfr", 3, "\xE2\x84\x8C" },
+	{ "HilbertSpace", 3, "\xE2\x84\x8B" },
+	{ "Hopf", 3, "\xE2\x84\x8D" },
+	{ "HorizontalLine", 3, "\xE2\x94\x80" },
+	{ "Hscr", 3, "\xE2\x84\x8B" },
+	{ "Hstrok", 2, "\xC4\xA6" },
+	{ "HumpDownHump", 3, "\xE2\x89\x8E" },
+	{ "HumpEqual", 3, "\xE2\x89\x8F" },
+	{ "IEcy", 2, "\xD0\x95" },
+	{ "IJlig", 2, "\xC4\xB2" },
+	{ "IOcy", 2, "\xD0\x81" },
+	{ "Iacute", 2, "\xC3\x8D" },
+	{ "Icirc", 2, "\xC3\x8E" },
+	{ "Icy", 2, "\xD0\x98" },
+	{ "Idot", 2, "\xC4\xB0" },
+	{ "Ifr", 3, "\xE2\x84\x91" },
+	{ "Igrave", 2, "\xC3\x8C" },
+	{ "Im", 3, "\xE2\x84\x91" },
+	{ "Imacr", 2, "\xC4\xAA" },
+	{ "ImaginaryI", 3, "\xE2\x85\x88" },
+	{ "Implies", 3, "\xE2\x87\x92" },
+	{ "Int", 3, "\xE2\x88\xAC" },
+	{ "Integral", 3, "\xE2\x88\xAB" },
+	{ "Intersection", 3, "\xE2\x8B\x82" },
+	{ "InvisibleComma", 3, "\xE2\x81\xA3" },
+	{ "InvisibleTimes", 3, "\xE2\x81\xA2" },
+	{ "Iogon", 2, "\xC4\xAE" },
+	{ "Iopf", 4, "\xF0\x9D\x95\x80" },
+	{ "Iota", 2, "\xCE\x99" },
+	{ "Iscr", 3, "\xE2\x84\x90" },
+	{ "Itilde", 2, "\xC4\xA8" },
+	{ "Iukcy", 2, "\xD0\x86" },
+	{ "Iuml", 2, "\xC3\x8F" },
+	{ "Jcirc", 2, "\xC4\xB4" },
+	{ "Jcy", 2, "\xD0\x99" },
+	{ "Jfr", 4, "\xF0\x9D\x94\x8D" },
+	{ "Jopf", 4, "\xF0\x9D\x95\x81" },
+	{ "Jscr", 4, "\xF0\x9D\x92\xA5" },
+	{ "Jsercy", 2, "\xD0\x88" },
+	{ "Jukcy", 2, "\xD0\x84" },
+	{ "KHcy", 2, "\xD0\xA5" },
+	{ "KJcy", 2, "\xD0\x8C" },
+	{ "Kappa", 2, "\xCE\x9A" },
+	{ "Kcedil", 2, "\xC4\xB6" },
+	{ "Kcy", 2, "\xD0\x9A" },
+	{ "Kfr", 4, "\xF0\x9D\x94\x8E" },
+	{ "Kopf", 4, "\xF0\x9D\x95\x82" },
+	{ "Kscr", 4, "\xF0\x9D\x92\xA6" },
+	{ "LJcy", 2, "\xD0\x89" },
+	{ "LT", 1, "\x3C" },
+	{ "Lacute", 2, "\xC4\xB9" },
+	{ "Lambda", 2, "\xCE\x9B" },
+	{ "Lang", 3, "\xE2\x9F\xAA" },
+	{ "Laplacetrf", 3, "\xE2\x84\x92" },
+	{ "Larr", 3, "\xE2\x86\x9E" },
+	{ "Lcaron", 2, "\xC4\xBD" },
+	{ "Lcedil", 2, "\xC4\xBB" },
+	{ "Lcy", 2, "\xD0\x9B" },
+	{ "LeftAngleBracket", 3, "\xE2\x9F\xA8" },
+	{ "LeftArrow", 3, "\xE2\x86\x90" },
+	{ "LeftArrowBar", 3, "\xE2\x87\xA4" },
+	{ "LeftArrowRightArrow", 3, "\xE2\x87\x86" },
+	{ "LeftCeiling", 3, "\xE2\x8C\x88" },
+	{ "LeftDoubleBracket", 3, "\xE2\x9F\xA6" },
+	{ "LeftDownTeeVector", 3, "\xE2\xA5\xA1" },
+	{ "LeftDownVector", 3, "\xE2\x87\x83" },
+	{ "LeftDownVectorBar", 3, "\xE2\xA5\x99" },
+	{ "LeftFloor", 3, "\xE2\x8C\x8A" },
+	{ "LeftRightArrow", 3, "\xE2\x86\x94" },
+	{ "LeftRightVector", 3, "\xE2\xA5\x8E" },
+	{ "LeftTee", 3, "\xE2\x8A\xA3" },
+	{ "LeftTeeArrow", 3, "\xE2\x86\xA4" },
+	{ "LeftTeeVector", 3, "\xE2\xA5\x9A" },
+	{ "LeftTriangle", 3, "\xE2\x8A\xB2" },
+	{ "LeftTriangleBar", 3, "\xE2\xA7\x8F" },
+	{ "LeftTriangleEqual", 3, "\xE2\x8A\xB4" },
+	{ "LeftUpDownVector", 3, "\xE2\xA5\x91" },
+	{ "LeftUpTeeVector", 3, "\xE2\xA5\xA0" },
+	{ "LeftUpVector", 3, "\xE2\x86\xBF" },
+	{ "LeftUpVectorBar", 3, "\xE2\xA5\x98" },
+	{ "LeftVector", 3, "\xE2\x86\xBC" },
+	{ "LeftVectorBar", 3, "\xE2\xA5\x92" },
+	{ "Leftarrow", 3, "\xE2\x87\x90" },
+	{ "Leftrightarrow", 3, "\xE2\x87\x94" },
+	{ "LessEqualGreater", 3, "\xE2\x8B\x9A" },
+	{ "LessFullEqual", 3, "\xE2\x89\xA6" },
+	{ "LessGreater", 3, "\xE2\x89\xB6" },
+	{ "LessLess", 3, "\xE2\xAA\xA1" },
+	{ "LessSlantEqual", 3, "\xE2\xA9\xBD" },
+	{ "LessTilde", 3, "\xE2\x89\xB2" },
+	{ "Lfr", 4, "\xF0\x9D\x94\x8F" },
+	{ "Ll", 3, "\xE2\x8B\x98" },
+	{ "Lleftarrow", 3, "\xE2\x87\x9A" },
+	{ "Lmidot", 2, "\xC4\xBF" },
+	{ "LongLeftArrow", 3, "\xE2\x9F\xB5" },
+	{ "LongLeftRightArrow", 3, "\xE2\x9F\xB7" },
+	{ "LongRightArrow", 3, "\xE2\x9F\xB6" },
+	{ "Longleftarrow", 3, "\xE2\x9F\xB8" },
+	{ "Longleftrightarrow", 3, "\xE2\x9F\xBA" },
+	{ "Longrightarrow", 3, "\xE2\x9F\xB9" },
+	{ "Lopf", 4, "\xF0\x9D\x95\x83" },
+	{ "LowerLeftArrow", 3, "\xE2\x86\x99" },
+	{ "LowerRightArrow", 3, "\xE2\x86\x98" },
+	{ "Lscr", 3, "\xE2\x84\x92" },
+	{ "Lsh", 3, "\xE2\x86\xB0" },
+	{ "Lstrok", 2, "\xC5\x81" },
+	{ "Lt", 3, "\xE2\x89\xAA" },
+	{ "Map", 3, "\xE2\xA4\x85" },
+	{ "Mcy", 2, "\xD0\x9C" },
+	{ "MediumSpace", 3, "\xE2\x81\x9F" },
+	{ "Mellintrf", 3, "\xE2\x84\xB3" },
+	{ "Mfr", 4, "\xF0\x9D\x94\x90" },
+	{ "MinusPlus", 3, "\xE2\x88\x93" },
+	{ "Mopf", 4, "\xF0\x9D\x95\x84" },
+	{ "Mscr", 3, "\xE2\x84\xB3" },
+	{ "Mu", 2, "\xCE\x9C" },
+	{ "NJcy", 2, "\xD0\x8A" },
+	{ "Nacute", 2, "\xC5\x83" },
+	{ "Ncaron", 2, "\xC5\x87" },
+	{ "Ncedil", 2, "\xC5\x85" },
+	{ "Ncy", 2, "\xD0\x9D" },
+	{ "NegativeMediumSpace", 3, "\xE2\x80\x8B" },
+	{ "NegativeThickSpace", 3, "\xE2\x80\x8B" },
+	{ "NegativeThinSpace", 3, "\xE2\x80\x8B" },
+	{ "NegativeVeryThinSpace", 3, "\xE2\x80\x8B" },
+	{ "NestedGreaterGreater", 3, "\xE2\x89\xAB" },
+	{ "NestedLessLess", 3, "\xE2\x89\xAA" },
+	{ "NewLine", 1, "\x0A" },
+	{ "Nfr", 4, "\xF0\x9D\x94\x91" },
+	{ "NoBreak", 3, "\xE2\x81\xA0" },
+	{ "NonBreakingSpace", 2, "\xC2\xA0" },
+	{ "Nopf", 3, "\xE2\x84\x95" },
+	{ "Not", 3, "\xE2\xAB\xAC" },
+	{ "NotCongruent", 3, "\xE2\x89\xA2" },
+	{ "NotCupCap", 3, "\xE2\x89\xAD" },
+	{ "NotDoubleVerticalBar", 3, "\xE2\x88\xA6" },
+	{ "NotElement", 3, "\xE2\x88\x89" },
+	{ "NotEqual", 3, "\xE2\x89\xA0" },
+	{ "NotEqualTilde", 5, "\xE2\x89\x82\xCC\xB8" },
+	{ "NotExists", 3, "\xE2\x88\x84" },
+	{ "NotGreater", 3, "\xE2\x89\xAF" },
+	{ "NotGreaterEqual", 3, "\xE2\x89\xB1" },
+	{ "NotGreaterFullEqual", 5, "\xE2\x89\xA7\xCC\xB8" },
+	{ "NotGreaterGreater", 5, "\xE2\x89\xAB\xCC\xB8" },
+	{ "NotGreaterLess", 3, "\xE2\x89\xB9" },
+	{ "NotGreaterSlantEqual", 5, "\xE2\xA9\xBE\xCC\xB8" },
+	{ "NotGreaterTilde", 3, "\xE2\x89\xB5" },
+	{ "NotHumpDownHump", 5, "\xE2\x89\x8E\xCC\xB8" },
+	{ "NotHumpEqual", 5, "\xE2\x89\x8F\xCC\xB8" },
+	{ "NotLeftTriangle", 3, "\xE2\x8B\xAA" },
+	{ "NotLeftTriangleBar", 5, "\xE2\xA7\x8F\xCC\xB8" },
+	{ "NotLeftTriangleEqual", 3, "\xE2\x8B\xAC" },
+	{ "NotLess", 3, "\xE2\x89\xAE" },
+	{ "NotLessEqual", 3, "\xE2\x89\xB0" },
+	{ "NotLessGreater", 3, "\xE2\x89\xB8" },
+	{ "NotLessLess", 5, "\xE2\x89\xAA\xCC\xB8" },
+	{ "NotLessSlantEqual", 5, "\xE2\xA9\xBD\xCC\xB8" },
+	{ "NotLessTilde", 3, "\xE2\x89\xB4" },
+	{ "NotNestedGreaterGreater", 5, "\xE2\xAA\xA2\xCC\xB8" },
+	{ "NotNestedLessLess", 5, "\xE2\xAA\xA1\xCC\xB8" },
+	{ "NotPrecedes", 3, "\xE2\x8A\x80" },
+	{ "NotPrecedesEqual", 5, "\xE2\xAA\xAF\xCC\xB8" },
+	{ "NotPrecedesSlantEqual", 3, "\xE2\x8B\xA0" },
+	{ "NotReverseElement", 3, "\xE2\x88\x8C" },
+	{ "NotRightTriangle", 3, "\xE2\x8B\xAB" },
+	{ "NotRightTriangleBar", 5, "\xE2\xA7\x90\xCC\xB8" },
+	{ "NotRightTriangleEqual", 3, "\xE2\x8B\xAD" },
+	{ "NotSquareSubset", 5, "\xE2\x8A\x8F\xCC\xB8" },
+	{ "NotSquareSubsetEqual", 3, "\xE2\x8B\xA2" },
+	{ "NotSquareSuperset", 5, "\xE2\x8A\x90\xCC\xB8" },
+	{ "NotSquareSupersetEqual", 3, "\xE2\x8B\xA3" },
+	{ "NotSubset", 6, "\xE2\x8A\x82\xE2\x83\x92" },
+	{ "NotSubsetEqual", 3, "\xE2\x8A\x88" },
+	{ "NotSucceeds", 3, "\xE2\x8A\x81" },
+	{ "NotSucceedsEqual", 5, "\xE2\xAA\xB0\xCC\xB8" },
+	{ "NotSucceedsSlantEqual", 3, "\xE2\x8B\xA1" },
+	{ "NotSucceedsTilde", 5, "\xE2\x89\xBF\xCC\xB8" },
+	{ "NotSuperset", 6, "\xE2\x8A\x83\xE2\x83\x92" },
+	{ "NotSupersetEqual", 3, "\xE2\x8A\x89" },
+	{ "NotTilde", 3, "\xE2\x89\x81" },
+	{ "NotTildeEqual", 3, "\xE2\x89\x84" },
+	{ "NotTildeFullEqual", 3, "\xE2\x89\x87" },
+	{ "NotTildeTilde", 3, "\xE2\x89\x89" },
+	{ "NotVerticalBar", 3, "\xE2\x88\xA4" },
+	{ "Nscr", 4, "\xF0\x9D\x92\xA9" },
+	{ "Ntilde", 2, "\xC3\x91" },
+	{ "Nu", 2, "\xCE\x9D" },
+	{ "OElig", 2, "\xC5\x92" },
+	{ "Oacute", 2, "\xC3\x93" },
+	{ "Ocirc", 2, "\xC3\x94" },
+	{ "Ocy", 2, "\xD0\x9E" },
+	{ "Odblac", 2, "\xC5\x90" },
+	{ "Ofr", 4, "\xF0\x9D\x94\x92" },
+	{ "Ograve", 2, "\xC3\x92" },
+	{ "Omacr", 2, "\xC5\x8C" },
+	{ "Omega", 2, "\xCE\xA9" },
+	{ "Omicron", 2, "\xCE\x9F" },
+	{ "Oopf", 4, "\xF0\x9D\x95\x86" },
+	{ "OpenCurlyDoubleQuote", 3, "\xE2\x80\x9C" },
+	{ "OpenCurlyQuote", 3, "\xE2\x80\x98" },
+	{ "Or", 3, "\xE2\xA9\x94" },
+	{ "Oscr", 4, "\xF0\x9D\x92\xAA" },
+	{ "Oslash", 2, "\xC3\x98" },
+	{ "Otilde", 2, "\xC3\x95" },
+	{ "Otimes", 3, "\xE2\xA8\xB7" },
+	{ "Ouml", 2, "\xC3\x96" },
+	{ "OverBar", 3, "\xE2\x80\xBE" },
+	{ "OverBrace", 3, "\xE2\x8F\x9E" },
+	{ "OverBracket", 3, "\xE2\x8E\xB4" },
+	{ "OverParenthesis", 3, "\xE2\x8F\x9C" },
+	{ "PartialD", 3, "\xE2\x88\x82" },
+	{ "Pcy", 2, "\xD0\x9F" },
+	{ "Pfr", 4, "\xF0\x9D\x94\x93" },
+	{ "Phi", 2, "\xCE\xA6" },
+	{ "Pi", 2, "\xCE\xA0" },
+	{ "PlusMinus", 2, "\xC2\xB1" },
+	{ "Poincareplane", 3, "\xE2\x84\x8C" },
+	{ "Popf", 3, "\xE2\x84\x99" },
+	{ "Pr", 3, "\xE2\xAA\xBB" },
+	{ "Precedes", 3, "\xE2\x89\xBA" },
+	{ "PrecedesEqual", 3, "\xE2\xAA\xAF" },
+	{ "PrecedesSlantEqual", 3, "\xE2\x89\xBC" },
+	{ "PrecedesTilde", 3, "\xE2\x89\xBE" },
+	{ "Prime", 3, "\xE2\x80\xB3" },
+	{ "Product", 3, "\xE2\x88\x8F" },
+	{ "Proportion", 3, "\xE2\x88\xB7" },
+	{ "Proportional", 3, "\xE2\x88\x9D" },
+	{ "Pscr", 4, "\xF0\x9D\x92\xAB" },
+	{ "Psi", 2, "\xCE\xA8" },
+	{ "QUOT", 1, "\x22" },
+	{ "Qfr", 4, "\xF0\x9D\x94\x94" },
+	{ "Qopf", 3, "\xE2\x84\x9A" },
+	{ "Qscr", 4, "\xF0\x9D\x92\xAC" },
+	{ "RBarr", 3, "\xE2\xA4\x90" },
+	{ "REG", 2, "\xC2\xAE" },
+	{ "Racute", 2, "\xC5\x94" },
+	{ "Rang", 3, "\xE2\x9F\xAB" },
+	{ "Rarr", 3, "\xE2\x86\xA0" },
+	{ "Rarrtl", 3, "\xE2\xA4\x96" },
+	{ "Rcaron", 2, "\xC5\x98" },
+	{ "Rcedil", 2, "\xC5\x96" },
+	{ "Rcy", 2, "\xD0\xA0" },
+	{ "Re", 3, "\xE2\x84\x9C" },
+	{ "ReverseElement", 3, "\xE2\x88\x8B" },
+	{ "ReverseEquilibrium", 3, "\xE2\x87\x8B" },
+	{ "ReverseUpEquilibrium", 3, "\xE2\xA5\xAF" },
+	{ "Rfr", 3, "\xE2\x84\x9C" },
+	{ "Rho", 2, "\xCE\xA1" },
+	{ "RightAngleBracket", 3, "\xE2\x9F\xA9" },
+	{ "RightArrow", 3, "\xE2\x86\x92" },
+	{ "RightArrowBar", 3, "\xE2\x87\xA5" },
+	{ "RightArrowLeftArrow", 3, "\xE2\x87\x84" },
+	{ "RightCeiling", 3, "\xE2\x8C\x89" },
+	{ "RightDoubleBracket", 3, "\xE2\x9F\xA7" },
+	{ "RightDownTeeVector", 3, "\xE2\xA5\x9D" },
+	{ "RightDownVector", 3, "\xE2\x87\x82" },
+	{ "RightDownVectorBar", 3, "\xE2\xA5\x95" },
+	{ "RightFloor", 3, "\xE2\x8C\x8B" },
+	{ "RightTee", 3, "\xE2\x8A\xA2" },
+	{ "RightTeeArrow", 3, "\xE2\x86\xA6" },
+	{ "RightTeeVector", 3, "\xE2\xA5\x9B" },
+	{ "RightTriangle", 3, "\xE2\x8A\xB3" },
+	{ "RightTriangleBar", 3, "\xE2\xA7\x90" },
+	{ "RightTriangleEqual", 3, "\xE2\x8A\xB5" },
+	{ "RightUpDownVector", 3, "\xE2\xA5\x8F" },
+	{ "RightUpTeeVector", 3, "\xE2\xA5\x9C" },
+	{ "RightUpVector", 3, "\xE2\x86\xBE" },
+	{ "RightUpVectorBar", 3, "\xE2\xA5\x94" },
+	{ "RightVector", 3, "\xE2\x87\x80" },
+	{ "RightVectorBar", 3, "\xE2\xA5\x93" },
+	{ "Rightarrow", 3, "\xE2\x87\x92" },
+	{ "Ropf", 3, "\xE2\x84\x9D" },
+	{ "RoundImplies", 3, "\xE2\xA5\xB0" },
+	{ "Rrightarrow", 3, "\xE2\x87\x9B" },
+	{ "Rscr", 3, "\xE2\x84\x9B" },
+	{ "Rsh", 3, "\xE2\x86\xB1" },
+	{ "RuleDelayed", 3, "\xE2\xA7\xB4" },
+	{ "SHCHcy", 2, "\xD0\xA9" },
+	{ "SHcy", 2, "\xD0\xA8" },
+	{ "SOFTcy", 2, "\xD0\xAC" },
+	{ "Sacute", 2, "\xC5\x9A" },
+	{ "Sc", 3, "\xE2\xAA\xBC" },
+	{ "Scaron", 2, "\xC5\xA0" },
+	{ "Scedil", 2, "\xC5\x9E" },
+	{ "Scirc", 2, "\xC5\x9C" },
+	{ "Scy", 2, "\xD0\xA1" },
+	{ "Sfr", 4, "\xF0\x9D\x94\x96" },
+	{ "ShortDownArrow", 3, "\xE2\x86\x93" },
+	{ "ShortLeftArrow", 3, "\xE2\x86\x90" },
+	{ "ShortRightArrow", 3, "\xE2\x86\x92" },
+	{ "ShortUpArrow", 3, "\xE2\x86\x91" },
+	{ "Sigma", 2, "\xCE\xA3" },
+	{ "SmallCircle", 3, "\xE2\x88\x98" },
+	{ "Sopf", 4, "\xF0\x9D\x95\x8A" },
+	{ "Sqrt", 3, "\xE2\x88\x9A" },
+	{ "Square", 3, "\xE2\x96\xA1" },
+	{ "SquareIntersection", 3, "\xE2\x8A\x93" },
+	{ "SquareSubset", 3, "\xE2\x8A\x8F" },
+	{ "SquareSubsetEqual", 3, "\xE2\x8A\x91" },
+	{ "SquareSuperset", 3, "\xE2\x8A\x90" },
+	{ "SquareSupersetEqual", 3, "\xE2\x8A\x92" },
+	{ "SquareUnion", 3, "\xE2\x8A\x94" },
+	{ "Sscr", 4, "\xF0\x9D\x92\xAE" },
+	{ "Star", 3, "\xE2\x8B\x86" },
+	{ "Sub", 3, "\xE2\x8B\x90" },
+	{ "Subset", 3, "\xE2\x8B\x90" },
+	{ "SubsetEqual", 3, "\xE2\x8A\x86" },
+	{ "Succeeds", 3, "\xE2\x89\xBB" },
+	{ "SucceedsEqual", 3, "\xE2\xAA\xB0" },
+	{ "SucceedsSlantEqual", 3, "\xE2\x89\xBD" },
+	{ "SucceedsTilde", 3, "\xE2\x89\xBF" },
+	{ "SuchThat", 3, "\xE2\x88\x8B" },
+	{ "Sum", 3, "\xE2\x88\x91" },
+	{ "Sup", 3, "\xE2\x8B\x91" },
+	{ "Superset", 3, "\xE2\x8A\x83" },
+	{ "SupersetEqual", 3, "\xE2\x8A\x87" },
+	{ "Supset", 3, "\xE2\x8B\x91" },
+	{ "THORN", 2, "\xC3\x9E" },
+	{ "TRADE", 3, "\xE2\x84\xA2" },
+	{ "TSHcy", 2, "\xD0\x8B" },
+	{ "TScy", 2, "\xD0\xA6" },
+	{ "Tab", 1, "\x09" },
+	{ "Tau", 2, "\xCE\xA4" },
+	{ "Tcaron", 2, "\xC5\xA4" },
+	{ "Tcedil", 2, "\xC5\xA2" },
+	{ "Tcy", 2, "\xD0\xA2" },
+	{ "Tfr", 4, "\xF0\x9D\x94\x97" },
+	{ "Therefore", 3, "\xE2\x88\xB4" },
+	{ "Theta", 2, "\xCE\x98" },
+	{ "ThickSpace", 6, "\xE2\x81\x9F\xE2\x80\x8A" },
+	{ "ThinSpace", 3, "\xE2\x80\x89" },
+	{ "Tilde", 3, "\xE2\x88\xBC" },
+	{ "TildeEqual", 3, "\xE2\x89\x83" },
+	{ "TildeFullEqual", 3, "\xE2\x89\x85" },
+	{ "TildeTilde", 3, "\xE2\x89\x88" },
+	{ "Topf", 4, "\xF0\x9D\x95\x8B" },
+	{ "TripleDot", 3, "\xE2\x83\x9B" },
+	{ "Tscr", 4, "\xF0\x9D\x92\xAF" },
+	{ "Tstrok", 2, "\xC5\xA6" },
+	{ "Uacute", 2, "\xC3\x9A" },
+	{ "Uarr", 3, "\xE2\x86\x9F" },
+	{ "Uarrocir", 3, "\xE2\xA5\x89" },
+	{ "Ubrcy", 2, "\xD0\x8E" },
+	{ "Ubreve", 2, "\xC5\xAC" },
+	{ "Ucirc", 2, "\xC3\x9B" },
+	{ "Ucy", 2, "\xD0\xA3" },
+	{ "Udblac", 2, "\xC5\xB0" },
+	{ "Ufr", 4, "\xF0\x9D\x94\x98" },
+	{ "Ugrave", 2, "\xC3\x99" },
+	{ "Umacr", 2, "\xC5\xAA" },
+	{ "UnderBar", 1, "\x5F" },
+	{ "UnderBrace", 3, "\xE2\x8F\x9F" },
+	{ "UnderBracket", 3, "\xE2\x8E\xB5" },
+	{ "UnderParenthesis", 3, "\xE2\x8F\x9D" },
+	{ "Union", 3, "\xE2\x8B\x83" },
+	{ "UnionPlus", 3, "\xE2\x8A\x8E" },
+	{ "Uogon", 2, "\xC5\xB2" },
+	{ "Uopf", 4, "\xF0\x9D\x95\x8C" },
+	{ "UpArrow", 3, "\xE2\x86\x91" },
+	{ "UpArrowBar", 3, "\xE2\xA4\x92" },
+	{ "UpArrowDownArrow", 3, "\xE2\x87\x85" },
+	{ "UpDownArrow", 3, "\xE2\x86\x95" },
+	{ "UpEquilibrium", 3, "\xE2\xA5\xAE" },
+	{ "UpTee", 3, "\xE2\x8A\xA5" },
+	{ "UpTeeArrow", 3, "\xE2\x86\xA5" },
+	{ "Uparrow", 3, "\xE2\x87\x91" },
+	{ "Updownarrow", 3, "\xE2\x87\x95" },
+	{ "UpperLeftArrow", 3, "\xE2\x86\x96" },
+	{ "UpperRightArrow", 3, "\xE2\x86\x97" },
+	{ "Upsi", 2, "\xCF\x92" },
+	{ "Upsilon", 2, "\xCE\xA5" },
+	{ "Uring", 2, "\xC5\xAE" },
+	{ "Uscr", 4, "\xF0\x9D\x92\xB0" },
+	{ "Utilde", 2, "\xC5\xA8" },
+	{ "Uuml", 2, "\xC3\x9C" },
+	{ "VDash", 3, "\xE2\x8A\xAB" },
+	{ "Vbar", 3, "\xE2\xAB\xAB" },
+	{ "Vcy", 2, "\xD0\x92" },
+	{ "Vdash", 3, "\xE2\x8A\xA9" },
+	{ "Vdashl", 3, "\xE2\xAB\xA6" },
+	{ "Vee", 3, "\xE2\x8B\x81" },
+	{ "Verbar", 3, "\xE2\x80\x96" },
+	{ "Vert", 3, "\xE2\x80\x96" },
+	{ "VerticalBar", 3, "\xE2\x88\xA3" },
+	{ "VerticalLine", 1, "\x7C" },
+	{ "VerticalSeparator", 3, "\xE2\x9D\x98" },
+	{ "VerticalTilde", 3, "\xE2\x89\x80" },
+	{ "VeryThinSpace", 3, "\xE2\x80\x8A" },
+	{ "Vfr", 4, "\xF0\x9D\x94\x99" },
+	{ "Vopf", 4, "\xF0\x9D\x95\x8D" },
+	{ "Vscr", 4, "\xF0\x9D\x92\xB1" },
+	{ "Vvdash", 3, "\xE2\x8A\xAA" },
+	{ "Wcirc", 2, "\xC5\xB4" },
+	{ "Wedge", 3, "\xE2\x8B\x80" },
+	{ "Wfr", 4, "\xF0\x9D\x94\x9A" },
+	{ "Wopf", 4, "\xF0\x9D\x95\x8E" },
+	{ "Wscr", 4, "\xF0\x9D\x92\xB2" },
+	{ "Xfr", 4, "\xF0\x9D\x94\x9B" },
+	{ "Xi", 2, "\xCE\x9E" },
+	{ "Xopf", 4, "\xF0\x9D\x95\x8F" },
+	{ "Xscr", 4, "\xF0\x9D\x92\xB3" },
+	{ "YAcy", 2, "\xD0\xAF" },
+	{ "YIcy", 2, "\xD0\x87" },
+	{ "YUcy", 2, "\xD0\xAE" },
+	{ "Yacute", 2, "\xC3\x9D" },
+	{ "Ycirc", 2, "\xC5\xB6" },
+	{ "Ycy", 2, "\xD0\xAB" },
+	{ "Yfr", 4, "\xF0\x9D\x94\x9C" },
+	{ "Yopf", 4, "\xF0\x9D\x95\x90" },
+	{ "Yscr", 4, "\xF0\x9D\x92\xB4" },
+	{ "Yuml", 2, "\xC5\xB8" },
+	{ "ZHcy", 2, "\xD0\x96" },
+	{ "Zacute", 2, "\xC5\xB9" },
+	{ "Zcaron", 2, "\xC5\xBD" },
+	{ "Zcy", 2, "\xD0\x97" },
+	{ "Zdot", 2, "\xC5\xBB" },
+	{ "ZeroWidthSpace", 3, "\xE2\x80\x8B" },
+	{ "Zeta", 2, "\xCE\x96" },
+	{ "Zfr", 3, "\xE2\x84\xA8" },
+	{ "Zopf", 3, "\xE2\x84\xA4" },
+	{ "Zscr", 4, "\xF0\x9D\x92\xB5" },
+	{ "aacute", 2, "\xC3\xA1" },
+	{ "abreve", 2, "\xC4\x83" },
+	{ "ac", 3, "\xE2\x88\xBE" },
+	{ "acE", 5, "\xE2\x88\xBE\xCC\xB3" },
+	{ "acd", 3, "\xE2\x88\xBF" },
+	{ "acirc", 2, "\xC3\xA2" },
+	{ "acute", 2, "\xC2\xB4" },
+	{ "acy", 2, "\xD0\xB0" },
+	{ "aelig", 2, "\xC3\xA6" },
+	{ "af", 3, "\xE2\x81\xA1" },
+	{ "afr", 4, "\xF0\x9D\x94\x9E" },
+	{ "agrave", 2, "\xC3\xA0" },
+	{ "alefsym", 3, "\xE2\x84\xB5" },
+	{ "aleph", 3, "\xE2\x84\xB5" },
+	{ "alpha", 2, "\xCE\xB1" },
+	{ "amacr", 2, "\xC4\x81" },
+	{ "amalg", 3, "\xE2\xA8\xBF" },
+	{ "amp", 1, "\x26" },
+	{ "and", 3, "\xE2\x88\xA7" },
+	{ "andand", 3, "\xE2\xA9\x95" },
+	{ "andd", 3, "\xE2\xA9\x9C" },
+	{ "andslope", 3, "\xE2\xA9\x98" },
+	{ "andv", 3, "\xE2\xA9\x9A" },
+	{ "ang", 3, "\xE2\x88\xA0" },
+	{ "ange", 3, "\xE2\xA6\xA4" },
+	{ "angle", 3, "\xE2\x88\xA0" },
+	{ "angmsd", 3, "\xE2\x88\xA1" },
+	{ "angmsdaa", 3, "\xE2\xA6\xA8" },
+	{ "angmsdab", 3, "\xE2\xA6\xA9" },
+	{ "angmsdac", 3, "\xE2\xA6\xAA" },
+	{ "angmsdad", 3, "\xE2\xA6\xAB" },
+	{ "angmsdae", 3, "\xE2\xA6\xAC" },
+	{ "angmsdaf", 3, "\xE2\xA6\xAD" },
+	{ "angmsdag", 3, "\xE2\xA6\xAE" },
+	{ "angmsdah", 3, "\xE2\xA6\xAF" },
+	{ "angrt", 3, "\xE2\x88\x9F" },
+	{ "angrtvb", 3, "\xE2\x8A\xBE" },
+	{ "angrtvbd", 3, "\xE2\xA6\x9D" },
+	{ "angsph", 3, "\xE2\x88\xA2" },
+	{ "angst", 2, "\xC3\x85" },
+	{ "angzarr", 3, "\xE2\x8D\xBC" },
+	{ "aogon", 2, "\xC4\x85" },
+	{ "aopf", 4, "\xF0\x9D\x95\x92" },
+	{ "ap", 3, "\xE2\x89\x88" },
+	{ "apE", 3, "\xE2\xA9\xB0" },
+	{ "apacir", 3, "\xE2\xA9\xAF" },
+	{ "ape", 3, "\xE2\x89\x8A" },
+	{ "apid", 3, "\xE2\x89\x8B" },
+	{ "apos", 1, "\x27" },
+	{ "approx", 3, "\xE2\x89\x88" },
+	{ "approxeq", 3, "\xE2\x89\x8A" },
+	{ "aring", 2, "\xC3\xA5" },
+	{ "ascr", 4, "\xF0\x9D\x92\xB6" },
+	{ "ast", 1, "\x2A" },
+	{ "asymp", 3, "\xE2\x89\x88" },
+	{ "asympeq", 3, "\xE2\x89\x8D" },
+	{ "atilde", 2, "\xC3\xA3" },
+	{ "auml", 2, "\xC3\xA4" },
+	{ "awconint", 3, "\xE2\x88\xB3" },
+	{ "awint", 3, "\xE2\xA8\x91" },
+	{ "bNot", 3, "\xE2\xAB\xAD" },
+	{ "backcong", 3, "\xE2\x89\x8C" },
+	{ "backepsilon", 2, "\xCF\xB6" },
+	{ "backprime", 3, "\xE2\x80\xB5" },
+	{ "backsim", 3, "\xE2\x88\xBD" },
+	{ "backsimeq", 3, "\xE2\x8B\x8D" },
+	{ "barvee", 3, "\xE2\x8A\xBD" },
+	{ "barwed", 3, "\xE2\x8C\x85" },
+	{ "barwedge", 3, "\xE2\x8C\x85" },
+	{ "bbrk", 3, "\xE2\x8E\xB5" },
+	{ "bbrktbrk", 3, "\xE2\x8E\xB6" },
+	{ "bcong", 3, "\xE2\x89\x8C" },
+	{ "bcy", 2, "\xD0\xB1" },
+	{ "bdquo", 3, "\xE2\x80\x9E" },
+	{ "becaus", 3, "\xE2\x88\xB5" },
+	{ "because", 3, "\xE2\x88\xB5" },
+	{ "bemptyv", 3, "\xE2\xA6\xB0" },
+	{ "bepsi", 2, "\xCF\xB6" },
+	{ "bernou", 3, "\xE2\x84\xAC" },
+	{ "beta", 2, "\xCE\xB2" },
+	{ "beth", 3, "\xE2\x84\xB6" },
+	{ "between", 3, "\xE2\x89\xAC" },
+	{ "bfr", 4, "\xF0\x9D\x94\x9F" },
+	{ "bigcap", 3, "\xE2\x8B\x82" },
+	{ "bigcirc", 3, "\xE2\x97\xAF" },
+	{ "bigcup", 3, "\xE2\x8B\x83" },
+	{ "bigodot", 3, "\xE2\xA8\x80" },
+	{ "bigoplus", 3, "\xE2\xA8\x81" },
+	{ "bigotimes", 3, "\xE2\xA8\x82" },
+	{ "bigsqcup", 3, "\xE2\xA8\x86" },
+	{ "bigstar", 3, "\xE2\x98\x85" },
+	{ "bigtriangledown", 3, "\xE2\x96\xBD" },
+	{ "bigtriangleup", 3, "\xE2\x96\xB3" },
+	{ "biguplus", 3, "\xE2\xA8\x84" },
+	{ "bigvee", 3, "\xE2\x8B\x81" },
+	{ "bigwedge", 3, "\xE2\x8B\x80" },
+	{ "bkarow", 3, "\xE2\xA4\x8D" },
+	{ "blacklozenge", 3, "\xE2\xA7\xAB" },
+	{ "blacksquare", 3, "\xE2\x96\xAA" },
+	{ "blacktriangle", 3, "\xE2\x96\xB4" },
+	{ "blacktriangledown", 3, "\xE2\x96\xBE" },
+	{ "blacktriangleleft", 3, "\xE2\x97\x82" },
+	{ "blacktriangleright", 3, "\xE2\x96\xB8" },
+	{ "blank", 3, "\xE2\x90\xA3" },
+	{ "blk12", 3, "\xE2\x96\x92" },
+	{ "blk14", 3, "\xE2\x96\x91" },
+	{ "blk34", 3, "\xE2\x96\x93" },
+	{ "block", 3, "\xE2\x96\x88" },
+	{ "bne", 4, "\x3D\xE2\x83\xA5" },
+	{ "bnequiv", 6, "\xE2\x89\xA1\xE2\x83\xA5" },
+	{ "bnot", 3, "\xE2\x8C\x90" },
+	{ "bopf", 4, "\xF0\x9D\x95\x93" },
+	{ "bot", 3, "\xE2\x8A\xA5" },
+	{ "bottom", 3, "\xE2\x8A\xA5" },
+	{ "bowtie", 3, "\xE2\x8B\x88" },
+	{ "boxDL", 3, "\xE2\x95\x97" },
+	{ "boxDR", 3, "\xE2\x95\x94" },
+	{ "boxDl", 3, "\xE2\x95\x96" },
+	{ "boxDr", 3, "\xE2\x95\x93" },
+	{ "boxH", 3, "\xE2\x95\x90" },
+	{ "boxHD", 3, "\xE2\x95\xA6" },
+	{ "boxHU", 3, "\xE2\x95\xA9" },
+	{ "boxHd", 3, "\xE2\x95\xA4" },
+	{ "boxHu", 3, "\xE2\x95\xA7" },
+	{ "boxUL", 3, "\xE2\x95\x9D" },
+	{ "boxUR", 3, "\xE2\x95\x9A" },
+	{ "boxUl", 3, "\xE2\x95\x9C" },
+	{ "boxUr", 3, "\xE2\x95\x99" },
+	{ "boxV", 3, "\xE2\x95\x91" },
+	{ "boxVH", 3, "\xE2\x95\xAC" },
+	{ "boxVL", 3, "\xE2\x95\xA3" },
+	{ "boxVR", 3, "\xE2\x95\xA0" },
+	{ "boxVh", 3, "\xE2\x95\xAB" },
+	{ "boxVl", 3, "\xE2\x95\xA2" },
+	{ "boxVr", 3, "\xE2\x95\x9F" },
+	{ "boxbox", 3, "\xE2\xA7\x89" },
+	{ "boxdL", 3, "\xE2\x95\x95" },
+	{ "boxdR", 3, "\xE2\x95\x92" },
+	{ "boxdl", 3, "\xE2\x94\x90" },
+	{ "boxdr", 3, "\xE2\x94\x8C" },
+	{ "boxh", 3, "\xE2\x94\x80" },
+	{ "boxhD", 3, "\xE2\x95\xA5" },
+	{ "boxhU", 3, "\xE2\x95\xA8" },
+	{ "boxhd", 3, "\xE2\x94\xAC" },
+	{ "boxhu", 3, "\xE2\x94\xB4" },
+	{ "boxminus", 3, "\xE2\x8A\x9F" },
+	{ "boxplus", 3, "\xE2\x8A\x9E" },
+	{ "boxtimes", 3, "\xE2\x8A\xA0" },
+	{ "boxuL", 3, "\xE2\x95\x9B" },
+	{ "boxuR", 3, "\xE2\x95\x98" },
+	{ "boxul", 3, "\xE2\x94\x98" },
+	{ "boxur", 3, "\xE2\x94\x94" },
+	{ "boxv", 3, "\xE2\x94\x82" },
+	{ "boxvH", 3, "\xE2\x95\xAA" },
+	{ "boxvL", 3, "\xE2\x95\xA1" },
+	{ "boxvR", 3, "\xE2\x95\x9E" },
+	{ "boxvh", 3, "\xE2\x94\xBC" },
+	{ "boxvl", 3, "\xE2\x94\xA4" },
+	{ "boxvr", 3, "\xE2\x94\x9C" },
+	{ "bprime", 3, "\xE2\x80\xB5" },
+	{ "breve", 2, "\xCB\x98" },
+	{ "brvbar", 2, "\xC2\xA6" },
+	{ "bscr", 4, "\xF0\x9D\x92\xB7" },
+	{ "bsemi", 3, "\xE2\x81\x8F" },
+	{ "bsim", 3, "\xE2\x88\xBD" },
+	{ "bsime", 3, "\xE2\x8B\x8D" },
+	{ "bsol", 1, "\x5C" },
+	{ "bsolb", 3, "\xE2\xA7\x85" },
+	{ "bsolhsub", 3, "\xE2\x9F\x88" },
+	{ "bull", 3, "\xE2\x80\xA2" },
+	{ "bullet", 3, "\xE2\x80\xA2" },
+	{ "bump", 3, "\xE2\x89\x8E" },
+	{ "bumpE", 3, "\xE2\xAA\xAE" },
+	{ "bumpe", 3, "\xE2\x89\x8F" },
+	{ "bumpeq", 3, "\xE2\x89\x8F" },
+	{ "cacute", 2, "\xC4\x87" },
+	{ "cap", 3, "\xE2\x88\xA9" },
+	{ "capand", 3, "\xE2\xA9\x84" },
+	{ "capbrcup", 3, "\xE2\xA9\x89" },
+	{ "capcap", 3, "\xE2\xA9\x8B" },
+	{ "capcup", 3, "\xE2\xA9\x87" },
+	{ "capdot", 3, "\xE2\xA9\x80" },
+	{ "caps", 6, "\xE2\x88\xA9\xEF\xB8\x80" },
+	{ "caret", 3, "\xE2\x81\x81" },
+	{ "caron", 2, "\xCB\x87" },
+	{ "ccaps", 3, "\xE2\xA9\x8D" },
+	{ "ccaron", 2, "\xC4\x8D" },
+	{ "ccedil", 2, "\xC3\xA7" },
+	{ "ccirc", 2, "\xC4\x89" },
+	{ "ccups", 3, "\xE2\xA9\x8C" },
+	{ "ccupssm", 3, "\xE2\xA9\x90" },
+	{ "cdot", 2, "\xC4\x8B" },
+	{ "cedil", 2, "\xC2\xB8" },
+	{ "cemptyv", 3, "\xE2\xA6\xB2" },
+	{ "cent", 2, "\xC2\xA2" },
+	{ "centerdot", 2, "\xC2\xB7" },
+	{ "cfr", 4, "\xF0\x9D\x94\xA0" },
+	{ "chcy", 2, "\xD1\x87" },
+	{ "check", 3, "\xE2\x9C\x93" },
+	{ "checkmark", 3, "\xE2\x9C\x93" },
+	{ "chi", 2, "\xCF\x87" },
+	{ "cir", 3, "\xE2\x97\x8B" },
+	{ "cirE", 3, "\xE2\xA7\x83" },
+	{ "circ", 2, "\xCB\x86" },
+	{ "circeq", 3, "\xE2\x89\x97" },
+	{ "circlearrowleft", 3, "\xE2\x86\xBA" },
+	{ "circlearrowright", 3, "\xE2\x86\xBB" },
+	{ "circledR", 2, "\xC2\xAE" },
+	{ "circledS", 3, "\xE2\x93\x88" },
+	{ "circledast", 3, "\xE2\x8A\x9B" },
+	{ "circledcirc", 3, "\xE2\x8A\x9A" },
+	{ "circleddash", 3, "\xE2\x8A\x9D" },
+	{ "cire", 3, "\xE2\x89\x97" },
+	{ "cirfnint", 3, "\xE2\xA8\x90" },
+	{ "cirmid", 3, "\xE2\xAB\xAF" },
+	{ "cirscir", 3, "\xE2\xA7\x82" },
+	{ "clubs", 3, "\xE2\x99\xA3" },
+	{ "clubsuit", 3, "\xE2\x99\xA3" },
+	{ "colon", 1, "\x3A" },
+	{ "colone", 3, "\xE2\x89\x94" },
+	{ "coloneq", 3, "\xE2\x89\x94" },
+	{ "comma", 1, "\x2C" },
+	{ "commat", 1, "\x40" },
+	{ "comp", 3, "\xE2\x88\x81" },
+	{ "compfn", 3, "\xE2\x88\x98" },
+	{ "complement", 3, "\xE2\x88\x81" },
+	{ "complexes", 3, "\xE2\x84\x82" },
+	{ "cong", 3, "\xE2\x89\x85" },
+	{ "congdot", 3, "\xE2\xA9\xAD" },
+	{ "conint", 3, "\xE2\x88\xAE" },
+	{ "copf", 4, "\xF0\x9D\x95\x94" },
+	{ "coprod", 3, "\xE2\x88\x90" },
+	{ "copy", 2, "\xC2\xA9" },
+	{ "copysr", 3, "\xE2\x84\x97" },
+	{ "crarr", 3, "\xE2\x86\xB5" },
+	{ "cross", 3, "\xE2\x9C\x97" },
+	{ "cscr", 4, "\xF0\x9D\x92\xB8" },
+	{ "csub", 3, "\xE2\xAB\x8F" },
+	{ "csube", 3, "\xE2\xAB\x91" },
+	{ "csup", 3, "\xE2\xAB\x90" },
+	{ "csupe", 3, "\xE2\xAB\x92" },
+	{ "ctdot", 3, "\xE2\x8B\xAF" },
+	{ "cudarrl", 3, "\xE2\xA4\xB8" },
+	{ "cudarrr", 3, "\xE2\xA4\xB5" },
+	{ "cuepr", 3, "\xE2\x8B\x9E" },
+	{ "cuesc", 3, "\xE2\x8B\x9F" },
+	{ "cularr", 3, "\xE2\x86\xB6" },
+	{ "cularrp", 3, "\xE2\xA4\xBD" },
+	{ "cup", 3, "\xE2\x88\xAA" },
+	{ "cupbrcap", 3, "\xE2\xA9\x88" },
+	{ "cupcap", 3, "\xE2\xA9\x86" },
+	{ "cupcup", 3, "\xE2\xA9\x8A" },
+	{ "cupdot", 3, "\xE2\x8A\x8D" },
+	{ "cupor", 3, "\xE2\xA9\x85" },
+	{ "cups", 6, "\xE2\x88\xAA\xEF\xB8\x80" },
+	{ "curarr", 3, "\xE2\x86\xB7" },
+	{ "curarrm", 3, "\xE2\xA4\xBC" },
+	{ "curlyeqprec", 3, "\xE2\x8B\x9E" },
+	{ "curlyeqsucc", 3, "\xE2\x8B\x9F" },
+	{ "curlyvee", 3, "\xE2\x8B\x8E" },
+	{ "curlywedge", 3, "\xE2\x8B\x8F" },
+	{ "curren", 2, "\xC2\xA4" },
+	{ "curvearrowleft", 3, "\xE2\x86\xB6" },
+	{ "curvearrowright", 3, "\xE2\x86\xB7" },
+	{ "cuvee", 3, "\xE2\x8B\x8E" },
+	{ "cuwed", 3, "\xE2\x8B\x8F" },
+	{ "cwconint", 3, "\xE2\x88\xB2" },
+	{ "cwint", 3, "\xE2\x88\xB1" },
+	{ "cylcty", 3, "\xE2\x8C\xAD" },
+	{ "dArr", 3, "\xE2\x87\x93" },
+	{ "dHar", 3, "\xE2\xA5\xA5" },
+	{ "dagger", 3, "\xE2\x80\xA0" },
+	{ "daleth", 3, "\xE2\x84\xB8" },
+	{ "darr", 3, "\xE2\x86\x93" },
+	{ "dash", 3, "\xE2\x80\x90" },
+	{ "dashv", 3, "\xE2\x8A\xA3" },
+	{ "dbkarow", 3, "\xE2\xA4\x8F" },
+	{ "dblac", 2, "\xCB\x9D" },
+	{ "dcaron", 2, "\xC4\x8F" },
+	{ "dcy", 2, "\xD0\xB4" },
+	{ "dd", 3, "\xE2\x85\x86" },
+	{ "ddagger", 3, "\xE2\x80\xA1" },
+	{ "ddarr", 3, "\xE2\x87\x8A" },
+	{ "ddotseq", 3, "\xE2\xA9\xB7" },
+	{ "deg", 2, "\xC2\xB0" },
+	{ "delta", 2, "\xCE\xB4" },
+	{ "demptyv", 3, "\xE2\xA6\xB1" },
+	{ "dfisht", 3, "\xE2\xA5\xBF" },
+	{ "dfr", 4, "\xF0\x9D\x94\xA1" },
+	{ "dharl", 3, "\xE2\x87\x83" },
+	{ "dharr", 3, "\xE2\x87\x82" },
+	{ "diam", 3, "\xE2\x8B\x84" },
+	{ "diamond", 3, "\xE2\x8B\x84" },
+	{ "diamondsuit", 3, "\xE2\x99\xA6" },
+	{ "diams", 3, "\xE2\x99\xA6" },
+	{ "die", 2, "\xC2\xA8" },
+	{ "digamma", 2, "\xCF\x9D" },
+	{ "disin", 3, "\xE2\x8B\xB2" },
+	{ "div", 2, "\xC3\xB7" },
+	{ "divide", 2, "\xC3\xB7" },
+	{ "divideontimes", 3, "\xE2\x8B\x87" },
+	{ "divonx", 3, "\xE2\x8B\x87" },
+	{ "djcy", 2, "\xD1\x92" },
+	{ "dlcorn", 3, "\xE2\x8C\x9E" },
+	{ "dlcrop", 3, "\xE2\x8C\x8D" },
+	{ "dollar", 1, "\x24" },
+	{ "dopf", 4, "\xF0\x9D\x95\x95" },
+	{ "dot", 2, "\xCB\x99" },
+	{ "doteq", 3, "\xE2\x89\x90" },
+	{ "doteqdot", 3, "\xE2\x89\x91" },
+	{ "dotminus", 3, "\xE2\x88\xB8" },
+	{ "dotplus", 3, "\xE2\x88\x94" },
+	{ "dotsquare", 3, "\xE2\x8A\xA1" },
+	{ "doublebarwedge", 3, "\xE2\x8C\x86" },
+	{ "downarrow", 3, "\xE2\x86\x93" },
+	{ "downdownarrows", 3, "\xE2\x87\x8A" },
+	{ "downharpoonleft", 3, "\xE2\x87\x83" },
+	{ "downharpoonright", 3, "\xE2\x87\x82" },
+	{ "drbkarow", 3, "\xE2\xA4\x90" },
+	{ "drcorn", 3, "\xE2\x8C\x9F" },
+	{ "drcrop", 3, "\xE2\x8C\x8C" },
+	{ "dscr", 4, "\xF0\x9D\x92\xB9" },
+	{ "dscy", 2, "\xD1\x95" },
+	{ "dsol", 3, "\xE2\xA7\xB6" },
+	{ "dstrok", 2, "\xC4\x91" },
+	{ "dtdot", 3, "\xE2\x8B\xB1" },
+	{ "dtri", 3, "\xE2\x96\xBF" },
+	{ "dtrif", 3, "\xE2\x96\xBE" },
+	{ "duarr", 3, "\xE2\x87\xB5" },
+	{ "duhar", 3, "\xE2\xA5\xAF" },
+	{ "dwangle", 3, "\xE2\xA6\xA6" },
+	{ "dzcy", 2, "\xD1\x9F" },
+	{ "dzigrarr", 3, "\xE2\x9F\xBF" },
+	{ "eDDot", 3, "\xE2\xA9\xB7" },
+	{ "eDot", 3, "\xE2\x89\x91" },
+	{ "eacute", 2, "\xC3\xA9" },
+	{ "easter", 3, "\xE2\xA9\xAE" },
+	{ "ecaron", 2, "\xC4\x9B" },
+	{ "ecir", 3, "\xE2\x89\x96" },
+	{ "ecirc", 2, "\xC3\xAA" },
+	{ "ecolon", 3, "\xE2\x89\x95" },
+	{ "ecy", 2, "\xD1\x8D" },
+	{ "edot", 2, "\xC4\x97" },
+	{ "ee", 3, "\xE2\x85\x87" },
+	{ "efDot", 3, "\xE2\x89\x92" },
+	{ "efr", 4, "\xF0\x9D\x94\xA2" },
+	{ "eg", 3, "\xE2\xAA\x9A" },
+	{ "egrave", 2, "\xC3\xA8" },
+	{ "egs", 3, "\xE2\xAA\x96" },
+	{ "egsdot", 3, "\xE2\xAA\x98" },
+	{ "el", 3, "\xE2\xAA\x99" },
+	{ "elinters", 3, "\xE2\x8F\xA7" },
+	{ "ell", 3, "\xE2\x84\x93" },
+	{ "els", 3, "\xE2\xAA\x95" },
+	{ "elsdot", 3, "\xE2\xAA\x97" },
+	{ "emacr", 2, "\xC4\x93" },
+	{ "empty", 3, "\xE2\x88\x85" },
+	{ "emptyset", 3, "\xE2\x88\x85" },
+	{ "emptyv", 3, "\xE2\x88\x85" },
+	{ "emsp", 3, "\xE2\x80\x83" },
+	{ "emsp13", 3, "\xE2\x80\x84" },
+	{ "emsp14", 3, "\xE2\x80\x85" },
+	{ "eng", 2, "\xC5\x8B" },
+	{ "ensp", 3, "\xE2\x80\x82" },
+	{ "eogon", 2, "\xC4\x99" },
+	{ "eopf", 4, "\xF0\x9D\x95\x96" },
+	{ "epar", 3, "\xE2\x8B\x95" },
+	{ "eparsl", 3, "\xE2\xA7\xA3" },
+	{ "eplus", 3, "\xE2\xA9\xB1" },
+	{ "epsi", 2, "\xCE\xB5" },
+	{ "epsilon", 2, "\xCE\xB5" },
+	{ "epsiv", 2, "\xCF\xB5" },
+	{ "eqcirc", 3, "\xE2\x89\x96" },
+	{ "eqcolon", 3, "\xE2\x89\x95" },
+	{ "eqsim", 3, "\xE2\x89\x82" },
+	{ "eqslantgtr", 3, "\xE2\xAA\x96" },
+	{ "eqslantless", 3, "\xE2\xAA\x95" },
+	{ "equals", 1, "\x3D" },
+	{ "equest", 3, "\xE2\x89\x9F" },
+	{ "equiv", 3, "\xE2\x89\xA1" },
+	{ "equivDD", 3, "\xE2\xA9\xB8" },
+	{ "eqvparsl", 3, "\xE2\xA7\xA5" },
+	{ "erDot", 3, "\xE2\x89\x93" },
+	{ "erarr", 3, "\xE2\xA5\xB1" },
+	{ "escr", 3, "\xE2\x84\xAF" },
+	{ "esdot", 3, "\xE2\x89\x90" },
+	{ "esim", 3, "\xE2\x89\x82" },
+	{ "eta", 2, "\xCE\xB7" },
+	{ "eth", 2, "\xC3\xB0" },
+	{ "euml", 2, "\xC3\xAB" },
+	{ "euro", 3, "\xE2\x82\xAC" },
+	{ "excl", 1, "\x21" },
+	{ "exist", 3, "\xE2\x88\x83" },
+	{ "expectation", 3, "\xE2\x84\xB0" },
+	{ "exponentiale", 3, "\xE2\x85\x87" },
+	{ "fallingdotseq", 3, "\xE2\x89\x92" },
+	{ "fcy", 2, "\xD1\x84" },
+	{ "female", 3, "\xE2\x99\x80" },
+	{ "ffilig", 3, "\xEF\xAC\x83" },
+	{ "fflig", 3, "\xEF\xAC\x80" },
+	{ "ffllig", 3, "\xEF\xAC\x84" },
+	{ "ffr", 4, "\xF0\x9D\x94\xA3" },
+	{ "filig", 3, "\xEF\xAC\x81" },
+	{ "fjlig", 2, "\x66\x6A" },
+	{ "flat", 3, "\xE2\x99\xAD" },
+	{ "fllig", 3, "\xEF\xAC\x82" },
+	{ "fltns", 3, "\xE2\x96\xB1" },
+	{ "fnof", 2, "\xC6\x92" },
+	{ "fopf", 4, "\xF0\x9D\x95\x97" },
+	{ "forall", 3, "\xE2\x88\x80" },
+	{ "fork", 3, "\xE2\x8B\x94" },
+	{ "forkv", 3, "\xE2\xAB\x99" },
+	{ "fpartint", 3, "\xE2\xA8\x8D" },
+	{ "frac12", 2, "\xC2\xBD" },
+	{ "frac13", 3, "\xE2\x85\x93" },
+	{ "frac14", 2, "\xC2\xBC" },
+	{ "frac15", 3, "\xE2\x85\x95" },
+	{ "frac16", 3, "\xE2\x85\x99" },
+	{ "frac18", 3, "\xE2\x85\x9B" },
+	{ "frac23", 3, "\xE2\x85\x94" },
+	{ "frac25", 3, "\xE2\x85\x96" },
+	{ "frac34", 2, "\xC2\xBE" },
+	{ "frac35", 3, "\xE2\x85\x97" },
+	{ "frac38", 3, "\xE2\x85\x9C" },
+	{ "frac45", 3, "\xE2\x85\x98" },
+	{ "frac56", 3, "\xE2\x85\x9A" },
+	{ "frac58", 3, "\xE2\x85\x9D" },
+	{ "frac78", 3, "\xE2\x85\x9E" },
+	{ "frasl", 3, "\xE2\x81\x84" },
+	{ "frown", 3, "\xE2\x8C\xA2" },
+	{ "fscr", 4, "\xF0\x9D\x92\xBB" },
+	{ "gE", 3, "\xE2\x89\xA7" },
+	{ "gEl", 3, "\xE2\xAA\x8C" },
+	{ "gacute", 2, "\xC7\xB5" },
+	{ "gamma", 2, "\xCE\xB3" },
+	{ "gammad", 2, "\xCF\x9D" },
+	{ "gap", 3, "\xE2\xAA\x86" },
+	{ "gbreve", 2, "\xC4\x9F" },
+	{ "gcirc", 2, "\xC4\x9D" },
+	{ "gcy", 2, "\xD0\xB3" },
+	{ "gdot", 2, "\xC4\xA1" },
+	{ "ge", 3, "\xE2\x89\xA5" },
+	{ "gel", 3, "\xE2\x8B\x9B" },
+	{ "geq", 3, "\xE2\x89\xA5" },
+	{ "geqq", 3, "\xE2\x89\xA7" },
+	{ "geqslant", 3, "\xE2\xA9\xBE" },
+	{ "ges", 3, "\xE2\xA9\xBE" },
+	{ "gescc", 3, "\xE2\xAA\xA9" },
+	{ "gesdot", 3, "\xE2\xAA\x80" },
+	{ "gesdoto", 3, "\xE2\xAA\x82" },
+	{ "gesdotol", 3, "\xE2\xAA\x84" },
+	{ "gesl", 6, "\xE2\x8B\x9B\xEF\xB8\x80" },
+	{ "gesles", 3, "\xE2\xAA\x94" },
+	{ "gfr", 4, "\xF0\x9D\x94\xA4" },
+	{ "gg", 3, "\xE2\x89\xAB" },
+	{ "ggg", 3, "\xE2\x8B\x99" },
+	{ "gimel", 3, "\xE2\x84\xB7" },
+	{ "gjcy", 2, "\xD1\x93" },
+	{ "gl", 3, "\xE2\x89\xB7" },
+	{ "glE", 3, "\xE2\xAA\x92" },
+	{ "gla", 3, "\xE2\xAA\xA5" },
+	{ "glj", 3, "\xE2\xAA\xA4" },
+	{ "gnE", 3, "\xE2\x89\xA9" },
+	{ "gnap", 3, "\xE2\xAA\x8A" },
+	{ "gnapprox", 3, "\xE2\xAA\x8A" },
+	{ "gne", 3, "\xE2\xAA\x88" },
+	{ "gneq", 3, "\xE2\xAA\x88" },
+	{ "gneqq", 3, "\xE2\x89\xA9" },
+	{ "gnsim", 3, "\xE2\x8B\xA7" },
+	{ "gopf", 4, "\xF0\x9D\x95\x98" },
+	{ "grave", 1, "\x60" },
+	{ "gscr", 3, "\xE2\x84\x8A" },
+	{ "gsim", 3, "\xE2\x89\xB3" },
+	{ "gsime", 3, "\xE2\xAA\x8E" },
+	{ "gsiml", 3, "\xE2\xAA\x90" },
+	{ "gt", 1, "\x3E" },
+	{ "gtcc", 3, "\xE2\xAA\xA7" },
+	{ "gtcir", 3, "\xE2\xA9\xBA" },
+	{ "gtdot", 3, "\xE2\x8B\x97" },
+	{ "gtlPar", 3, "\xE2\xA6\x95" },
+	{ "gtquest", 3, "\xE2\xA9\xBC" },
+	{ "gtrapprox", 3, "\xE2\xAA\x86" },
+	{ "gtrarr", 3, "\xE2\xA5\xB8" },
+	{ "gtrdot", 3, "\xE2\x8B\x97" },
+	{ "gtreqless", 3, "\xE2\x8B\x9B" },
+	{ "gtreqqless", 3, "\xE2\xAA\x8C" },
+	{ "gtrless", 3, "\xE2\x89\xB7" },
+	{ "gtrsim", 3, "\xE2\x89\xB3" },
+	{ "gvertneqq", 6, "\xE2\x89\xA9\xEF\xB8\x80" },
+	{ "gvnE", 6, "\xE2\x89\xA9\xEF\xB8\x80" },
+	{ "hArr", 3, "\xE2\x87\x94" },
+	{ "hairsp", 3, "\xE2\x80\x8A" },
+	{ "half", 2, "\xC2\xBD" },
+	{ "hamilt", 3, "\xE2\x84\x8B" },
+	{ "hardcy", 2, "\xD1\x8A" },
+	{ "harr", 3, "\xE2\x86\x94" },
+	{ "harrcir", 3, "\xE2\xA5\x88" },
+	{ "harrw", 3, "\xE2\x86\xAD" },
+	{ "hbar", 3, "\xE2\x84\x8F" },
+	{ "hcirc", 2, "\xC4\xA5" },
+	{ "hearts", 3, "\xE2\x99\xA5" },
+	{ "heartsuit", 3, "\xE2\x99\xA5" },
+	{ "hellip", 3, "\xE2\x80\xA6" },
+	{ "hercon", 3, "\xE2\x8A\xB9" },
+	{ "hfr", 4, "\xF0\x9D\x94\xA5" },
+	{ "hksearow", 3, "\xE2\xA4\xA5" },
+	{ "hkswarow", 3, "\xE2\xA4\xA6" },
+	{ "hoarr", 3, "\xE2\x87\xBF" },
+	{ "homtht", 3, "\xE2\x88\xBB" },
+	{ "hookleftarrow", 3, "\xE2\x86\xA9" },
+	{ "hookrightarrow", 3, "\xE2\x86\xAA" },
+	{ "hopf", 4, "\xF0\x9D\x95\x99" },
+	{ "horbar", 3, "\xE2\x80\x95" },
+	{ "hscr", 4, "\xF0\x9D\x92\xBD" },
+	{ "hslash", 3, "\xE2\x84\x8F" },
+	{ "hstrok", 2, "\xC4\xA7" },
+	{ "hybull", 3, "\xE2\x81\x83" },
+	{ "hyphen", 3, "\xE2\x80\x90" },
+	{ "iacute", 2, "\xC3\xAD" },
+	{ "ic", 3, "\xE2\x81\xA3" },
+	{ "icirc", 2, "\xC3\xAE" },
+	{ "icy", 2, "\xD0\xB8" },
+	{ "iecy", 2, "\xD0\xB5" },
+	{ "iexcl", 2, "\xC2\xA1" },
+	{ "iff", 3, "\xE2\x87\x94" },
+	{ "ifr", 4, "\xF0\x9D\x94\xA6" },
+	{ "igrave", 2, "\xC3\xAC" },
+	{ "ii", 3, "\xE2\x85\x88" },
+	{ "iiiint", 3, "\xE2\xA8\x8C" },
+	{ "iiint", 3, "\xE2\x88\xAD" },
+	{ "iinfin", 3, "\xE2\xA7\x9C" },
+	{ "iiota", 3, "\xE2\x84\xA9" },
+	{ "ijlig", 2, "\xC4\xB3" },
+	{ "imacr", 2, "\xC4\xAB" },
+	{ "image", 3, "\xE2\x84\x91" },
+	{ "imagline", 3, "\xE2\x84\x90" },
+	{ "imagpart", 3, "\xE2\x84\x91" },
+	{ "imath", 2, "\xC4\xB1" },
+	{ "imof", 3, "\xE2\x8A\xB7" },
+	{ "imped", 2, "\xC6\xB5" },
+	{ "in", 3, "\xE2\x88\x88" },
+	{ "incare", 3, "\xE2\x84\x85" },
+	{ "infin", 3, "\xE2\x88\x9E" },
+	{ "infintie", 3, "\xE2\xA7\x9D" },
+	{ "inodot", 2, "\xC4\xB1" },
+	{ "int", 3, "\xE2\x88\xAB" },
+	{ "intcal", 3, "\xE2\x8A\xBA" },
+	{ "integers", 3, "\xE2\x84\xA4" },
+	{ "intercal", 3, "\xE2\x8A\xBA" },
+	{ "intlarhk", 3, "\xE2\xA8\x97" },
+	{ "intprod", 3, "\xE2\xA8\xBC" },
+	{ "iocy", 2, "\xD1\x91" },
+	{ "iogon", 2, "\xC4\xAF" },
+	{ "iopf", 4, "\xF0\x9D\x95\x9A" },
+	{ "iota", 2, "\xCE\xB9" },
+	{ "iprod", 3, "\xE2\xA8\xBC" },
+	{ "iquest", 2, "\xC2\xBF" },
+	{ "iscr", 4, "\xF0\x9D\x92\xBE" },
+	{ "isin", 3, "\xE2\x88\x88" },
+	{ "isinE", 3, "\xE2\x8B\xB9" },
+	{ "isindot", 3, "\xE2\x8B\xB5" },
+	{ "isins", 3, "\xE2\x8B\xB4" },
+	{ "isinsv", 3, "\xE2\x8B\xB3" },
+	{ "isinv", 3, "\xE2\x88\x88" },
+	{ "it", 3, "\xE2\x81\xA2" },
+	{ "itilde", 2, "\xC4\xA9" },
+	{ "iukcy", 2, "\xD1\x96" },
+	{ "iuml", 2, "\xC3\xAF" },
+	{ "jcirc", 2, "\xC4\xB5" },
+	{ "jcy", 2, "\xD0\xB9" },
+	{ "jfr", 4, "\xF0\x9D\x94\xA7" },
+	{ "jmath", 2, "\xC8\xB7" },
+	{ "jopf", 4, "\xF0\x9D\x95\x9B" },
+	{ "jscr", 4, "\xF0\x9D\x92\xBF" },
+	{ "jsercy", 2, "\xD1\x98" },
+	{ "jukcy", 2, "\xD1\x94" },
+	{ "kappa", 2, "\xCE\xBA" },
+	{ "kappav", 2, "\xCF\xB0" },
+	{ "kcedil", 2, "\xC4\xB7" },
+	{ "kcy", 2, "\xD0\xBA" },
+	{ "kfr", 4, "\xF0\x9D\x94\xA8" },
+	{ "kgreen", 2, "\xC4\xB8" },
+	{ "khcy", 2, "\xD1\x85" },
+	{ "kjcy", 2, "\xD1\x9C" },
+	{ "kopf", 4, "\xF0\x9D\x95\x9C" },
+	{ "kscr", 4, "\xF0\x9D\x93\x80" },
+	{ "lAarr", 3, "\xE2\x87\x9A" },
+	{ "lArr", 3, "\xE2\x87\x90" },
+	{ "lAtail", 3, "\xE2\xA4\x9B" },
+	{ "lBarr", 3, "\xE2\xA4\x8E" },
+	{ "lE", 3, "\xE2\x89\xA6" },
+	{ "lEg", 3, "\xE2\xAA\x8B" },
+	{ "lHar", 3, "\xE2\xA5\xA2" },
+	{ "lacute", 2, "\xC4\xBA" },
+	{ "laemptyv", 3, "\xE2\xA6\xB4" },
+	{ "lagran", 3, "\xE2\x84\x92" },
+	{ "lambda", 2, "\xCE\xBB" },
+	{ "lang", 3, "\xE2\x9F\xA8" },
+	{ "langd", 3, "\xE2\xA6\x91" },
+	{ "langle", 3, "\xE2\x9F\xA8" },
+	{ "lap", 3, "\xE2\xAA\x85" },
+	{ "laquo", 2, "\xC2\xAB" },
+	{ "larr", 3, "\xE2\x86\x90" },
+	{ "larrb", 3, "\xE2\x87\xA4" },
+	{ "larrbfs", 3, "\xE2\xA4\x9F" },
+	{ "larrfs", 3, "\xE2\xA4\x9D" },
+	{ "larrhk", 3, "\xE2\x86\xA9" },
+	{ "larrlp", 3, "\xE2\x86\xAB" },
+	{ "larrpl", 3, "\xE2\xA4\xB9" },
+	{ "larrsim", 3, "\xE2\xA5\xB3" },
+	{ "larrtl", 3, "\xE2\x86\xA2" },
+	{ "lat", 3, "\xE2\xAA\xAB" },
+	{ "latail", 3, "\xE2\xA4\x99" },
+	{ "late", 3, "\xE2\xAA\xAD" },
+	{ "lates", 6, "\xE2\xAA\xAD\xEF\xB8\x80" },
+	{ "lbarr", 3, "\xE2\xA4\x8C" },
+	{ "lbbrk", 3, "\xE2\x9D\xB2" },
+	{ "lbrace", 1, "\x7B" },
+	{ "lbrack", 1, "\x5B" },
+	{ "lbrke", 3, "\xE2\xA6\x8B" },
+	{ "lbrksld", 3, "\xE2\xA6\x8F" },
+	{ "lbrkslu", 3, "\xE2\xA6\x8D" },
+	{ "lcaron", 2, "\xC4\xBE" },
+	{ "lcedil", 2, "\xC4\xBC" },
+	{ "lceil", 3, "\xE2\x8C\x88" },
+	{ "lcub", 1, "\x7B" },
+	{ "lcy", 2, "\xD0\xBB" },
+	{ "ldca", 3, "\xE2\xA4\xB6" },
+	{ "ldquo", 3, "\xE2\x80\x9C" },
+	{ "ldquor", 3, "\xE2\x80\x9E" },
+	{ "ldrdhar", 3, "\xE2\xA5\xA7" },
+	{ "ldrushar", 3, "\xE2\xA5\x8B" },
+	{ "ldsh", 3, "\xE2\x86\xB2" },
+	{ "le", 3, "\xE2\x89\xA4" },
+	{ "leftarrow", 3, "\xE2\x86\x90" },
+	{ "leftarrowtail", 3, "\xE2\x86\xA2" },
+	{ "leftharpoondown", 3, "\xE2\x86\xBD" },
+	{ "leftharpoonup", 3, "\xE2\x86\xBC" },
+	{ "leftleftarrows", 3, "\xE2\x87\x87" },
+	{ "leftrightarrow", 3, "\xE2\x86\x94" },
+	{ "leftrightarrows", 3, "\xE2\x87\x86" },
+	{ "leftrightharpoons", 3, "\xE2\x87\x8B" },
+	{ "leftrightsquigarrow", 3, "\xE2\x86\xAD" },
+	{ "leftthreetimes", 3, "\xE2\x8B\x8B" },
+	{ "leg", 3, "\xE2\x8B\x9A" },
+	{ "leq", 3, "\xE2\x89\xA4" },
+	{ "leqq", 3, "\xE2\x89\xA6" },
+	{ "leqslant", 3, "\xE2\xA9\xBD" },
+	{ "les", 3, "\xE2\xA9\xBD" },
+	{ "lescc", 3, "\xE2\xAA\xA8" },
+	{ "lesdot", 3, "\xE2\xA9\xBF" },
+	{ "lesdoto", 3, "\xE2\xAA\x81" },
+	{ "lesdotor", 3, "\xE2\xAA\x83" },
+	{ "lesg", 6, "\xE2\x8B\x9A\xEF\xB8\x80" },
+	{ "lesges", 3, "\xE2\xAA\x93" },
+	{ "lessapprox", 3, "\xE2\xAA\x85" },
+	{ "lessdot", 3, "\xE2\x8B\x96" },
+	{ "lesseqgtr", 3, "\xE2\x8B\x9A" },
+	{ "lesseqqgtr", 3, "\xE2\xAA\x8B" },
+	{ "lessgtr", 3, "\xE2\x89\xB6" },
+	{ "lesssim", 3, "\xE2\x89\xB2" },
+	{ "lfisht", 3, "\xE2\xA5\xBC" },
+	{ "lfloor", 3, "\xE2\x8C\x8A" },
+	{ "lfr", 4, "\xF0\x9D\x94\xA9" },
+	{ "lg", 3, "\xE2\x89\xB6" },
+	{ "lgE", 3, "\xE2\xAA\x91" },
+	{ "lhard", 3, "\xE2\x86\xBD" },
+	{ "lharu", 3, "\xE2\x86\xBC" },
+	{ "lharul", 3, "\xE2\xA5\xAA" },
+	{ "lhblk", 3, "\xE2\x96\x84" },
+	{ "ljcy", 2, "\xD1\x99" },
+	{ "ll", 3, "\xE2\x89\xAA" },
+	{ "llarr", 3, "\xE2\x87\x87" },
+	{ "llcorner", 3, "\xE2\x8C\x9E" },
+	{ "llhard", 3, "\xE2\xA5\xAB" },
+	{ "lltri", 3, "\xE2\x97\xBA" },
+	{ "lmidot", 2, "\xC5\x80" },
+	{ "lmoust", 3, "\xE2\x8E\xB0" },
+	{ "lmoustache", 3, "\xE2\x8E\xB0" },
+	{ "lnE", 3, "\xE2\x89\xA8" },
+	{ "lnap", 3, "\xE2\xAA\x89" },
+	{ "lnapprox", 3, "\xE2\xAA\x89" },
+	{ "lne", 3, "\xE2\xAA\x87" },
+	{ "lneq", 3, "\xE2\xAA\x87" },
+	{ "lneqq", 3, "\xE2\x89\xA8" },
+	{ "lnsim", 3, "\xE2\x8B\xA6" },
+	{ "loang", 3, "\xE2\x9F\xAC" },
+	{ "loarr", 3, "\xE2\x87\xBD" },
+	{ "lobrk", 3, "\xE2\x9F\xA6" },
+	{ "longleftarrow", 3, "\xE2\x9F\xB5" },
+	{ "longleftrightarrow", 3, "\xE2\x9F\xB7" },
+	{ "longmapsto", 3, "\xE2\x9F\xBC" },
+	{ "longrightarrow", 3, "\xE2\x9F\xB6" },
+	{ "looparrowleft", 3, "\xE2\x86\xAB" },
+	{ "looparrowright", 3, "\xE2\x86\xAC" },
+	{ "lopar", 3, "\xE2\xA6\x85" },
+	{ "lopf", 4, "\xF0\x9D\x95\x9D" },
+	{ "loplus", 3, "\xE2\xA8\xAD" },
+	{ "lotimes", 3, "\xE2\xA8\xB4" },
+	{ "lowast", 3, "\xE2\x88\x97" },
+	{ "lowbar", 1, "\x5F" },
+	{ "loz", 3, "\xE2\x97\x8A" },
+	{ "lozenge", 3, "\xE2\x97\x8A" },
+	{ "lozf", 3, "\xE2\xA7\xAB" },
+	{ "lpar", 1, "\x28" },
+	{ "lparlt", 3, "\xE2\xA6\x93" },
+	{ "lrarr", 3, "\xE2\x87\x86" },
+	{ "lrcorner", 3, "\xE2\x8C\x9F" },
+	{ "lrhar", 3, "\xE2\x87\x8B" },
+	{ "lrhard", 3, "\xE2\xA5\xAD" },
+	{ "lrm", 3, "\xE2\x80\x8E" },
+	{ "lrtri", 3, "\xE2\x8A\xBF" },
+	{ "lsaquo", 3, "\xE2\x80\xB9" },
+	{ "lscr", 4, "\xF0\x9D\x93\x81" },
+	{ "lsh", 3, "\xE2\x86\xB0" },
+	{ "lsim", 3, "\xE2\x89\xB2" },
+	{ "lsime", 3, "\xE2\xAA\x8D" },
+	{ "lsimg", 3, "\xE2\xAA\x8F" },
+	{ "lsqb", 1, "\x5B" },
+	{ "lsquo", 3, "\xE2\x80\x98" },
+	{ "lsquor", 3, "\xE2\x80\x9A" },
+	{ "lstrok", 2, "\xC5\x82" },
+	{ "lt", 1, "\x3C" },
+	{ "ltcc", 3, "\xE2\xAA\xA6" },
+	{ "ltcir", 3, "\xE2\xA9\xB9" },
+	{ "ltdot", 3, "\xE2\x8B\x96" },
+	{ "lthree", 3, "\xE2\x8B\x8B" },
+	{ "ltimes", 3, "\xE2\x8B\x89" },
+	{ "ltlarr", 3, "\xE2\xA5\xB6" },
+	{ "ltquest", 3, "\xE2\xA9\xBB" },
+	{ "ltrPar", 3, "\xE2\xA6\x96" },
+	{ "ltri", 3, "\xE2\x97\x83" },
+	{ "ltrie", 3, "\xE2\x8A\xB4" },
+	{ "ltrif", 3, "\xE2\x97\x82" },
+	{ "lurdshar", 3, "\xE2\xA5\x8A" },
+	{ "luruhar", 3, "\xE2\xA5\xA6" },
+	{ "lvertneqq", 6, "\xE2\x89\xA8\xEF\xB8\x80" },
+	{ "lvnE", 6, "\xE2\x89\xA8\xEF\xB8\x80" },
+	{ "mDDot", 3, "\xE2\x88\xBA" },
+	{ "macr", 2, "\xC2\xAF" },
+	{ "male", 3, "\xE2\x99\x82" },
+	{ "malt", 3, "\xE2\x9C\xA0" },
+	{ "maltese", 3, "\xE2\x9C\xA0" },
+	{ "map", 3, "\xE2\x86\xA6" },
+	{ "mapsto", 3, "\xE2\x86\xA6" },
+	{ "mapstodown", 3, "\xE2\x86\xA7" },
+	{ "mapstoleft", 3, "\xE2\x86\xA4" },
+	{ "mapstoup", 3, "\xE2\x86\xA5" },
+	{ "marker", 3, "\xE2\x96\xAE" },
+	{ "mcomma", 3, "\xE2\xA8\xA9" },
+	{ "mcy", 2, "\xD0\xBC" },
+	{ "mdash", 3, "\xE2\x80\x94" },
+	{ "measuredangle", 3, "\xE2\x88\xA1" },
+	{ "mfr", 4, "\xF0\x9D\x94\xAA" },
+	{ "mho", 3, "\xE2\x84\xA7" },
+	{ "micro", 2, "\xC2\xB5" },
+	{ "mid", 3, "\xE2\x88\xA3" },
+	{ "midast", 1, "\x2A" },
+	{ "midcir", 3, "\xE2\xAB\xB0" },
+	{ "middot", 2, "\xC2\xB7" },
+	{ "minus", 3, "\xE2\x88\x92" },
+	{ "minusb", 3, "\xE2\x8A\x9F" },
+	{ "minusd", 3, "\xE2\x88\xB8" },
+	{ "minusdu", 3, "\xE2\xA8\xAA" },
+	{ "mlcp", 3, "\xE2\xAB\x9B" },
+	{ "mldr", 3, "\xE2\x80\xA6" },
+	{ "mnplus", 3, "\xE2\x88\x93" },
+	{ "models", 3, "\xE2\x8A\xA7" },
+	{ "mopf", 4, "\xF0\x9D\x95\x9E" },
+	{ "mp", 3, "\xE2\x88\x93" },
+	{ "mscr", 4, "\xF0\x9D\x93\x82" },
+	{ "mstpos", 3, "\xE2\x88\xBE" },
+	{ "mu", 2, "\xCE\xBC" },
+	{ "multimap", 3, "\xE2\x8A\xB8" },
+	{ "mumap", 3, "\xE2\x8A\xB8" },
+	{ "nGg", 5, "\xE2\x8B\x99\xCC\xB8" },
+	{ "nGt", 6, "\xE2\x89\xAB\xE2\x83\x92" },
+	{ "nGtv", 5, "\xE2\x89\xAB\xCC\xB8" },
+	{ "nLeftarrow", 3, "\xE2\x87\x8D" },
+	{ "nLeftrightarrow", 3, "\xE2\x87\x8E" },
+	{ "nLl", 5, "\xE2\x8B\x98\xCC\xB8" },
+	{ "nLt", 6, "\xE2\x89\xAA\xE2\x83\x92" },
+	{ "nLtv", 5, "\xE2\x89\xAA\xCC\xB8" },
+	{ "nRightarrow", 3, "\xE2\x87\x8F" },
+	{ "nVDash", 3, "\xE2\x8A\xAF" },
+	{ "nVdash", 3, "\xE2\x8A\xAE" },
+	{ "nabla", 3, "\xE2\x88\x87" },
+	{ "nacute", 2, "\xC5\x84" },
+	{ "nang", 6, "\xE2\x88\xA0\xE2\x83\x92" },
+	{ "nap", 3, "\xE2\x89\x89" },
+	{ "napE", 5, "\xE2\xA9\xB0\xCC\xB8" },
+	{ "napid", 5, "\xE2\x89\x8B\xCC\xB8" },
+	{ "napos", 2, "\xC5\x89" },
+	{ "napprox", 3, "\xE2\x89\x89" },
+	{ "natur", 3, "\xE2\x99\xAE" },
+	{ "natural", 3, "\xE2\x99\xAE" },
+	{ "naturals", 3, "\xE2\x84\x95" },
+	{ "nbsp", 2, "\xC2\xA0" },
+	{ "nbump", 5, "\xE2\x89\x8E\xCC\xB8" },
+	{ "nbumpe", 5, "\xE2\x89\x8F\xCC\xB8" },
+	{ "ncap", 3, "\xE2\xA9\x83" },
+	{ "ncaron", 2, "\xC5\x88" },
+	{ "ncedil", 2, "\xC5\x86" },
+	{ "ncong", 3, "\xE2\x89\x87" },
+	{ "ncongdot", 5, "\xE2\xA9\xAD\xCC\xB8" },
+	{ "ncup", 3, "\xE2\xA9\x82" },
+	{ "ncy", 2, "\xD0\xBD" },
+	{ "ndash", 3, "\xE2\x80\x93" },
+	{ "ne", 3, "\xE2\x89\xA0" },
+	{ "neArr", 3, "\xE2\x87\x97" },
+	{ "nearhk", 3, "\xE2\xA4\xA4" },
+	{ "nearr", 3, "\xE2\x86\x97" },
+	{ "nearrow", 3, "\xE2\x86\x97" },
+	{ "nedot", 5, "\xE2\x89\x90\xCC\xB8" },
+	{ "nequiv", 3, "\xE2\x89\xA2" },
+	{ "nesear", 3, "\xE2\xA4\xA8" },
+	{ "nesim", 5, "\xE2\x89\x82\xCC\xB8" },
+	{ "nexist", 3, "\xE2\x88\x84" },
+	{ "nexists", 3, "\xE2\x88\x84" },
+	{ "nfr", 4, "\xF0\x9D\x94\xAB" },
+	{ "ngE", 5, "\xE2\x89\xA7\xCC\xB8" },
+	{ "nge", 3, "\xE2\x89\xB1" },
+	{ "ngeq", 3, "\xE2\x89\xB1" },
+	{ "ngeqq", 5, "\xE2\x89\xA7\xCC\xB8" },
+	{ "ngeqslant", 5, "\xE2\xA9\xBE\xCC\xB8" },
+	{ "nges", 5, "\xE2\xA9\xBE\xCC\xB8" },
+	{ "ngsim", 3, "\xE2\x89\xB5" },
+	{ "ngt", 3, "\xE2\x89\xAF" },
+	{ "ngtr", 3, "\xE2\x89\xAF" },
+	{ "nhArr", 3, "\xE2\x87\x8E" },
+	{ "nharr", 3, "\xE2\x86\xAE" },
+	{ "nhpar", 3, "\xE2\xAB\xB2" },
+	{ "ni", 3, "\xE2\x88\x8B" },
+	{ "nis", 3, "\xE2\x8B\xBC" },
+	{ "nisd", 3, "\xE2\x8B\xBA" },
+	{ "niv", 3, "\xE2\x88\x8B" },
+	{ "njcy", 2, "\xD1\x9A" },
+	{ "nlArr", 3, "\xE2\x87\x8D" },
+	{ "nlE", 5, "\xE2\x89\xA6\xCC\xB8" },
+	{ "nlarr", 3, "\xE2\x86\x9A" },
+	{ "nldr", 3, "\xE2\x80\xA5" },
+	{ "nle", 3, "\xE2\x89\xB0" },
+	{ "nleftarrow", 3, "\xE2\x86\x9A" },
+	{ "nleftrightarrow", 3, "\xE2\x86\xAE" },
+	{ "nleq", 3, "\xE2\x89\xB0" },
+	{ "nleqq", 5, "\xE2\x89\xA6\xCC\xB8" },
+	{ "nleqslant", 5, "\xE2\xA9\xBD\xCC\xB8" },
+	{ "nles", 5, "\xE2\xA9\xBD\xCC\xB8" },
+	{ "nless", 3, "\xE2\x89\xAE" },
+	{ "nlsim", 3, "\xE2\x89\xB4" },
+	{ "nlt", 3, "\xE2\x89\xAE" },
+	{ "nltri", 3, "\xE2\x8B\xAA" },
+	{ "nltrie", 3, "\xE2\x8B\xAC" },
+	{ "nmid", 3, "\xE2\x88\xA4" },
+	{ "nopf", 4, "\xF0\x9D\x95\x9F" },
+	{ "not", 2, "\xC2\xAC" },
+	{ "notin", 3, "\xE2\x88\x89" },
+	{ "notinE", 5, "\xE2\x8B\xB9\xCC\xB8" },
+	{ "notindot", 5, "\xE2\x8B\xB5\xCC\xB8" },
+	{ "notinva", 3, "\xE2\x88\x89" },
+	{ "notinvb", 3, "\xE2\x8B\xB7" },
+	{ "notinvc", 3, "\xE2\x8B\xB6" },
+	{ "notni", 3, "\xE2\x88\x8C" },
+	{ "notniva", 3, "\xE2\x88\x8C" },
+	{ "notnivb", 3, "\xE2\x8B\xBE" },
+	{ "notnivc", 3, "\xE2\x8B\xBD" },
+	{ "npar", 3, "\xE2\x88\xA6" },
+	{ "nparallel", 3, "\xE2\x88\xA6" },
+	{ "nparsl", 6, "\xE2\xAB\xBD\xE2\x83\xA5" },
+	{ "npart", 5, "\xE2\x88\x82\xCC\xB8" },
+	{ "npolint", 3, "\xE2\xA8\x94" },
+	{ "npr", 3, "\xE2\x8A\x80" },
+	{ "nprcue", 3, "\xE2\x8B\xA0" },
+	{ "npre", 5, "\xE2\xAA\xAF\xCC\xB8" },
+	{ "nprec", 3, "\xE2\x8A\x80" },
+	{ "npreceq", 5, "\xE2\xAA\xAF\xCC\xB8" },
+	{ "nrArr", 3, "\xE2\x87\x8F" },
+	{ "nrarr", 3, "\xE2\x86\x9B" },
+	{ "nrarrc", 5, "\xE2\xA4\xB3\xCC\xB8" },
+	{ "nrarrw", 5, "\xE2\x86\x9D\xCC\xB8" },
+	{ "nrightarrow", 3, "\xE2\x86\x9B" },
+	{ "nrtri", 3, "\xE2\x8B\xAB" },
+	{ "nrtrie", 3, "\xE2\x8B\xAD" },
+	{ "nsc", 3, "\xE2\x8A\x81" },
+	{ "nsccue", 3, "\xE2\x8B\xA1" },
+	{ "nsce", 5, "\xE2\xAA\xB0\xCC\xB8" },
+	{ "nscr", 4, "\xF0\x9D\x93\x83" },
+	{ "nshortmid", 3, "\xE2\x88\xA4" },
+	{ "nshortparallel", 3, "\xE2\x88\xA6" },
+	{ "nsim", 3, "\xE2\x89\x81" },
+	{ "nsime", 3, "\xE2\x89\x84" },
+	{ "nsimeq", 3, "\xE2\x89\x84" },
+	{ "nsmid", 3, "\xE2\x88\xA4" },
+	{ "nspar", 3, "\xE2\x88\xA6" },
+	{ "nsqsube", 3, "\xE2\x8B\xA2" },
+	{ "nsqsupe", 3, "\xE2\x8B\xA3" },
+	{ "nsub", 3, "\xE2\x8A\x84" },
+	{ "nsubE", 5, "\xE2\xAB\x85\xCC\xB8" },
+	{ "nsube", 3, "\xE2\x8A\x88" },
+	{ "nsubset", 6, "\xE2\x8A\x82\xE2\x83\x92" },
+	{ "nsubseteq", 3, "\xE2\x8A\x88" },
+	{ "nsubseteqq", 5, "\xE2\xAB\x85\xCC\xB8" },
+	{ "nsucc", 3, "\xE2\x8A\x81" },
+	{ "nsucceq", 5, "\xE2\xAA\xB0\xCC\xB8" },
+	{ "nsup", 3, "\xE2\x8A\x85" },
+	{ "nsupE", 5, "\xE2\xAB\x86\xCC\xB8" },
+	{ "nsupe", 3, "\xE2\x8A\x89" },
+	{ "nsupset", 6, "\xE2\x8A\x83\xE2\x83\x92" },
+	{ "nsupseteq", 3, "\xE2\x8A\x89" },
+	{ "nsupseteqq", 5, "\xE2\xAB\x86\xCC\xB8" },
+	{ "ntgl", 3, "\xE2\x89\xB9" },
+	{ "ntilde", 2, "\xC3\xB1" },
+	{ "ntlg", 3, "\xE2\x89\xB8" },
+	{ "ntriangleleft", 3, "\xE2\x8B\xAA" },
+	{ "ntrianglelefteq", 3, "\xE2\x8B\xAC" },
+	{ "ntriangleright", 3, "\xE2\x8B\xAB" },
+	{ "ntrianglerighteq", 3, "\xE2\x8B\xAD" },
+	{ "nu", 2, "\xCE\xBD" },
+	{ "num", 1, "\x23" },
+	{ "numero", 3, "\xE2\x84\x96" },
+	{ "numsp", 3, "\xE2\x80\x87" },
+	{ "nvDash", 3, "\xE2\x8A\xAD" },
+	{ "nvHarr", 3, "\xE2\xA4\x84" },
+	{ "nvap", 6, "\xE2\x89\x8D\xE2\x83\x92" },
+	{ "nvdash", 3, "\xE2\x8A\xAC" },
+	{ "nvge", 6, "\xE2\x89\xA5\xE2\x83\x92" },
+	{ "nvgt", 4, "\x3E\xE2\x83\x92" },
+	{ "nvinfin", 3, "\xE2\xA7\x9E" },
+	{ "nvlArr", 3, "\xE2\xA4\x82" },
+	{ "nvle", 6, "\xE2\x89\xA4\xE2\x83\x92" },
+	{ "nvlt", 4, "\x3C\xE2\x83\x92" },
+	{ "nvltrie", 6, "\xE2\x8A\xB4\xE2\x83\x92" },
+	{ "nvrArr", 3, "\xE2\xA4\x83" },
+	{ "nvrtrie", 6, "\xE2\x8A\xB5\xE2\x83\x92" },
+	{ "nvsim", 6, "\xE2\x88\xBC\xE2\x83\x92" },
+	{ "nwArr", 3, "\xE2\x87\x96" },
+	{ "nwarhk", 3, "\xE2\xA4\xA3" },
+	{ "nwarr", 3, "\xE2\x86\x96" },
+	{ "nwarrow", 3, "\xE2\x86\x96" },
+	{ "nwnear", 3, "\xE2\xA4\xA7" },
+	{ "oS", 3, "\xE2\x93\x88" },
+	{ "oacute", 2, "\xC3\xB3" },
+	{ "oast", 3, "\xE2\x8A\x9B" },
+	{ "ocir", 3, "\xE2\x8A\x9A" },
+	{ "ocirc", 2, "\xC3\xB4" },
+	{ "ocy", 2, "\xD0\xBE" },
+	{ "odash", 3, "\xE2\x8A\x9D" },
+	{ "odblac", 2, "\xC5\x91" },
+	{ "odiv", 3, "\xE2\xA8\xB8" },
+	{ "odot", 3, "\xE2\x8A\x99" },
+	{ "odsold", 3, "\xE2\xA6\xBC" },
+	{ "oelig", 2, "\xC5\x93" },
+	{ "ofcir", 3, "\xE2\xA6\xBF" },
+	{ "ofr", 4, "\xF0\x9D\x94\xAC" },
+	{ "ogon", 2, "\xCB\x9B" },
+	{ "ograve", 2, "\xC3\xB2" },
+	{ "ogt", 3, "\xE2\xA7\x81" },
+	{ "ohbar", 3, "\xE2\xA6\xB5" },
+	{ "ohm", 2, "\xCE\xA9" },
+	{ "oint", 3, "\xE2\x88\xAE" },
+	{ "olarr", 3, "\xE2\x86\xBA" },
+	{ "olcir", 3, "\xE2\xA6\xBE" },
+	{ "olcross", 3, "\xE2\xA6\xBB" },
+	{ "oline", 3, "\xE2\x80\xBE" },
+	{ "olt", 3, "\xE2\xA7\x80" },
+	{ "omacr", 2, "\xC5\x8D" },
+	{ "omega", 2, "\xCF\x89" },
+	{ "omicron", 2, "\xCE\xBF" },
+	{ "omid", 3, "\xE2\xA6\xB6" },
+	{ "ominus", 3, "\xE2\x8A\x96" },
+	{ "oopf", 4, "\xF0\x9D\x95\xA0" },
+	{ "opar", 3, "\xE2\xA6\xB7" },
+	{ "operp", 3, "\xE2\xA6\xB9" },
+	{ "oplus", 3, "\xE2\x8A\x95" },
+	{ "or", 3, "\xE2\x88\xA8" },
+	{ "orarr", 3, "\xE2\x86\xBB" },
+	{ "ord", 3, "\xE2\xA9\x9D" },
+	{ "order", 3, "\xE2\x84\xB4" },
+	{ "orderof", 3, "\xE2\x84\xB4" },
+	{ "ordf", 2, "\xC2\xAA" },
+	{ "ordm", 2, "\xC2\xBA" },
+	{ "origof", 3, "\xE2\x8A\xB6" },
+	{ "oror", 3, "\xE2\xA9\x96" },
+	{ "orslope", 3, "\xE2\xA9\x97" },
+	{ "orv", 3, "\xE2\xA9\x9B" },
+	{ "oscr", 3, "\xE2\x84\xB4" },
+	{ "oslash", 2, "\xC3\xB8" },
+	{ "osol", 3, "\xE2\x8A\x98" },
+	{ "otilde", 2, "\xC3\xB5" },
+	{ "otimes", 3, "\xE2\x8A\x97" },
+	{ "otimesas", 3, "\xE2\xA8\xB6" },
+	{ "ouml", 2, "\xC3\xB6" },
+	{ "ovbar", 3, "\xE2\x8C\xBD" },
+	{ "par", 3, "\xE2\x88\xA5" },
+	{ "para", 2, "\xC2\xB6" },
+	{ "parallel", 3, "\xE2\x88\xA5" },
+	{ "parsim", 3, "\xE2\xAB\xB3" },
+	{ "parsl", 3, "\xE2\xAB\xBD" },
+	{ "part", 3, "\xE2\x88\x82" },
+	{ "pcy", 2, "\xD0\xBF" },
+	{ "percnt", 1, "\x25" },
+	{ "period", 1, "\x2E" },
+	{ "permil", 3, "\xE2\x80\xB0" },
+	{ "perp", 3, "\xE2\x8A\xA5" },
+	{ "pertenk", 3, "\xE2\x80\xB1" },
+	{ "pfr", 4, "\xF0\x9D\x94\xAD" },
+	{ "phi", 2, "\xCF\x86" },
+	{ "phiv", 2, "\xCF\x95" },
+	{ "phmmat", 3, "\xE2\x84\xB3" },
+	{ "phone", 3, "\xE2\x98\x8E" },
+	{ "pi", 2, "\xCF\x80" },
+	{ "pitchfork", 3, "\xE2\x8B\x94" },
+	{ "piv", 2, "\xCF\x96" },
+	{ "planck", 3, "\xE2\x84\x8F" },
+	{ "planckh", 3, "\xE2\x84\x8E" },
+	{ "plankv", 3, "\xE2\x84\x8F" },
+	{ "plus", 1, "\x2B" },
+	{ "plusacir", 3, "\xE2\xA8\xA3" },
+	{ "plusb", 3, "\xE2\x8A\x9E" },
+	{ "pluscir", 3, "\xE2\xA8\xA2" },
+	{ "plusdo", 3, "\xE2\x88\x94" },
+	{ "plusdu", 3, "\xE2\xA8\xA5" },
+	{ "pluse", 3, "\xE2\xA9\xB2" },
+	{ "plusmn", 2, "\xC2\xB1" },
+	{ "plussim", 3, "\xE2\xA8\xA6" },
+	{ "plustwo", 3, "\xE2\xA8\xA7" },
+	{ "pm", 2, "\xC2\xB1" },
+	{ "pointint", 3, "\xE2\xA8\x95" },
+	{ "popf", 4, "\xF0\x9D\x95\xA1" },
+	{ "pound", 2, "\xC2\xA3" },
+	{ "pr", 3, "\xE2\x89\xBA" },
+	{ "prE", 3, "\xE2\xAA\xB3" },
+	{ "prap", 3, "\xE2\xAA\xB7" },
+	{ "prcue", 3, "\xE2\x89\xBC" },
+	{ "pre", 3, "\xE2\xAA\xAF" },
+	{ "prec", 3, "\xE2\x89\xBA" },
+	{ "precapprox", 3, "\xE2\xAA\xB7" },
+	{ "preccurlyeq", 3, "\xE2\x89\xBC" },
+	{ "preceq", 3, "\xE2\xAA\xAF" },
+	{ "precnapprox", 3, "\xE2\xAA\xB9" },
+	{ "precneqq", 3, "\xE2\xAA\xB5" },
+	{ "precnsim", 3, "\xE2\x8B\xA8" },
+	{ "precsim", 3, "\xE2\x89\xBE" },
+	{ "prime", 3, "\xE2\x80\xB2" },
+	{ "primes", 3, "\xE2\x84\x99" },
+	{ "prnE", 3, "\xE2\xAA\xB5" },
+	{ "prnap", 3, "\xE2\xAA\xB9" },
+	{ "prnsim", 3, "\xE2\x8B\xA8" },
+	{ "prod", 3, "\xE2\x88\x8F" },
+	{ "profalar", 3, "\xE2\x8C\xAE" },
+	{ "profline", 3, "\xE2\x8C\x92" },
+	{ "profsurf", 3, "\xE2\x8C\x93" },
+	{ "prop", 3, "\xE2\x88\x9D" },
+	{ "propto", 3, "\xE2\x88\x9D" },
+	{ "prsim", 3, "\xE2\x89\xBE" },
+	{ "prurel", 3, "\xE2\x8A\xB0" },
+	{ "pscr", 4, "\xF0\x9D\x93\x85" },
+	{ "psi", 2, "\xCF\x88" },
+	{ "puncsp", 3, "\xE2\x80\x88" },
+	{ "qfr", 4, "\xF0\x9D\x94\xAE" },
+	{ "qint", 3, "\xE2\xA8\x8C" },
+	{ "qopf", 4, "\xF0\x9D\x95\xA2" },
+	{ "qprime", 3, "\xE2\x81\x97" },
+	{ "qscr", 4, "\xF0\x9D\x93\x86" },
+	{ "quaternions", 3, "\xE2\x84\x8D" },
+	{ "quatint", 3, "\xE2\xA8\x96" },
+	{ "quest", 1, "\x3F" },
+	{ "questeq", 3, "\xE2\x89\x9F" },
+	{ "quot", 1, "\x22" },
+	{ "rAarr", 3, "\xE2\x87\x9B" },
+	{ "rArr", 3, "\xE2\x87\x92" },
+	{ "rAtail", 3, "\xE2\xA4\x9C" },
+	{ "rBarr", 3, "\xE2\xA4\x8F" },
+	{ "rHar", 3, "\xE2\xA5\xA4" },
+	{ "race", 5, "\xE2\x88\xBD\xCC\xB1" },
+	{ "racute", 2, "\xC5\x95" },
+	{ "radic", 3, "\xE2\x88\x9A" },
+	{ "raemptyv", 3, "\xE2\xA6\xB3" },
+	{ "rang", 3, "\xE2\x9F\xA9" },
+	{ "rangd", 3, "\xE2\xA6\x92" },
+	{ "range", 3, "\xE2\xA6\xA5" },
+	{ "rangle", 3, "\xE2\x9F\xA9" },
+	{ "raquo", 2, "\xC2\xBB" },
+	{ "rarr", 3, "\xE2\x86\x92" },
+	{ "rarrap", 3, "\xE2\xA5\xB5" },
+	{ "rarrb", 3, "\xE2\x87\xA5" },
+	{ "rarrbfs", 3, "\xE2\xA4\xA0" },
+	{ "rarrc", 3, "\xE2\xA4\xB3" },
+	{ "rarrfs", 3, "\xE2\xA4\x9E" },
+	{ "rarrhk", 3, "\xE2\x86\xAA" },
+	{ "rarrlp", 3, "\xE2\x86\xAC" },
+	{ "rarrpl", 3, "\xE2\xA5\x85" },
+	{ "rarrsim", 3, "\xE2\xA5\xB4" },
+	{ "rarrtl", 3, "\xE2\x86\xA3" },
+	{ "rarrw", 3, "\xE2\x86\x9D" },
+	{ "ratail", 3, "\xE2\xA4\x9A" },
+	{ "ratio", 3, "\xE2\x88\xB6" },
+	{ "rationals", 3, "\xE2\x84\x9A" },
+	{ "rbarr", 3, "\xE2\xA4\x8D" },
+	{ "rbbrk", 3, "\xE2\x9D\xB3" },
+	{ "rbrace", 1, "\x7D" },
+	{ "rbrack", 1, "\x5D" },
+	{ "rbrke", 3, "\xE2\xA6\x8C" },
+	{ "rbrksld", 3, "\xE2\xA6\x8E" },
+	{ "rbrkslu", 3, "\xE2\xA6\x90" },
+	{ "rcaron", 2, "\xC5\x99" },
+	{ "rcedil", 2, "\xC5\x97" },
+	{ "rceil", 3, "\xE2\x8C\x89" },
+	{ "rcub", 1, "\x7D" },
+	{ "rcy", 2, "\xD1\x80" },
+	{ "rdca", 3, "\xE2\xA4\xB7" },
+	{ "rdldhar", 3, "\xE2\xA5\xA9" },
+	{ "rdquo", 3, "\xE2\x80\x9D" },
+	{ "rdquor", 3, "\xE2\x80\x9D" },
+	{ "rdsh", 3, "\xE2\x86\xB3" },
+	{ "real", 3, "\xE2\x84\x9C" },
+	{ "realine", 3, "\xE2\x84\x9B" },
+	{ "realpart", 3, "\xE2\x84\x9C" },
+	{ "reals", 3, "\xE2\x84\x9D" },
+	{ "rect", 3, "\xE2\x96\xAD" },
+	{ "reg", 2, "\xC2\xAE" },
+	{ "rfisht", 3, "\xE2\xA5\xBD" },
+	{ "rfloor", 3, "\xE2\x8C\x8B" },
+	{ "rfr", 4, "\xF0\x9D\x94\xAF" },
+	{ "rhard", 3, "\xE2\x87\x81" },
+	{ "rharu", 3, "\xE2\x87\x80" },
+	{ "rharul", 3, "\xE2\xA5\xAC" },
+	{ "rho", 2, "\xCF\x81" },
+	{ "rhov", 2, "\xCF\xB1" },
+	{ "rightarrow", 3, "\xE2\x86\x92" },
+	{ "rightarrowtail", 3, "\xE2\x86\xA3" },
+	{ "rightharpoondown", 3, "\xE2\x87\x81" },
+	{ "rightharpoonup", 3, "\xE2\x87\x80" },
+	{ "rightleftarrows", 3, "\xE2\x87\x84" },
+	{ "rightleftharpoons", 3, "\xE2\x87\x8C" },
+	{ "rightrightarrows", 3, "\xE2\x87\x89" },
+	{ "rightsquigarrow", 3, "\xE2\x86\x9D" },
+	{ "rightthreetimes", 3, "\xE2\x8B\x8C" },
+	{ "ring", 2, "\xCB\x9A" },
+	{ "risingdotseq", 3, "\xE2\x89\x93" },
+	{ "rlarr", 3, "\xE2\x87\x84" },
+	{ "rlhar", 3, "\xE2\x87\x8C" },
+	{ "rlm", 3, "\xE2\x80\x8F" },
+	{ "rmoust", 3, "\xE2\x8E\xB1" },
+	{ "rmoustache", 3, "\xE2\x8E\xB1" },
+	{ "rnmid", 3, "\xE2\xAB\xAE" },
+	{ "roang", 3, "\xE2\x9F\xAD" },
+	{ "roarr", 3, "\xE2\x87\xBE" },
+	{ "robrk", 3, "\xE2\x9F\xA7" },
+	{ "ropar", 3, "\xE2\xA6\x86" },
+	{ "ropf", 4, "\xF0\x9D\x95\xA3" },
+	{ "roplus", 3, "\xE2\xA8\xAE" },
+	{ "rotimes", 3, "\xE2\xA8\xB5" },
+	{ "rpar", 1, "\x29" },
+	{ "rpargt", 3, "\xE2\xA6\x94" },
+	{ "rppolint", 3, "\xE2\xA8\x92" },
+	{ "rrarr", 3, "\xE2\x87\x89" },
+	{ "rsaquo", 3, "\xE2\x80\xBA" },
+	{ "rscr", 4, "\xF0\x9D\x93\x87" },
+	{ "rsh", 3, "\xE2\x86\xB1" },
+	{ "rsqb", 1, "\x5D" },
+	{ "rsquo", 3, "\xE2\x80\x99" },
+	{ "rsquor", 3, "\xE2\x80\x99" },
+	{ "rthree", 3, "\xE2\x8B\x8C" },
+	{ "rtimes", 3, "\xE2\x8B\x8A" },
+	{ "rtri", 3, "\xE2\x96\xB9" },
+	{ "rtrie", 3, "\xE2\x8A\xB5" },
+	{ "rtrif", 3, "\xE2\x96\xB8" },
+	{ "rtriltri", 3, "\xE2\xA7\x8E" },
+	{ "ruluhar", 3, "\xE2\xA5\xA8" },
+	{ "rx", 3, "\xE2\x84\x9E" },
+	{ "sacute", 2, "\xC5\x9B" },
+	{ "sbquo", 3, "\xE2\x80\x9A" },
+	{ "sc", 3, "\xE2\x89\xBB" },
+	{ "scE", 3, "\xE2\xAA\xB4" },
+	{ "scap", 3, "\xE2\xAA\xB8" },
+	{ "scaron", 2, "\xC5\xA1" },
+	{ "sccue", 3, "\xE2\x89\xBD" },
+	{ "sce", 3, "\xE2\xAA\xB0" },
+	{ "scedil", 2, "\xC5\x9F" },
+	{ "scirc", 2, "\xC5\x9D" },
+	{ "scnE", 3, "\xE2\xAA\xB6" },
+	{ "scnap", 3, "\xE2\xAA\xBA" },
+	{ "scnsim", 3, "\xE2\x8B\xA9" },
+	{ "scpolint", 3, "\xE2\xA8\x93" },
+	{ "scsim", 3, "\xE2\x89\xBF" },
+	{ "scy", 2, "\xD1\x81" },
+	{ "sdot", 3, "\xE2\x8B\x85" },
+	{ "sdotb", 3, "\xE2\x8A\xA1" },
+	{ "sdote", 3, "\xE2\xA9\xA6" },
+	{ "seArr", 3, "\xE2\x87\x98" },
+	{ "searhk", 3, "\xE2\xA4\xA5" },
+	{ "searr", 3, "\xE2\x86\x98" },
+	{ "searrow", 3, "\xE2\x86\x98" },
+	{ "sect", 2, "\xC2\xA7" },
+	{ "semi", 1, "\x3B" },
+	{ "seswar", 3, "\xE2\xA4\xA9" },
+	{ "setminus", 3, "\xE2\x88\x96" },
+	{ "setmn", 3, "\xE2\x88\x96" },
+	{ "sext", 3, "\xE2\x9C\xB6" },
+	{ "sfr", 4, "\xF0\x9D\x94\xB0" },
+	{ "sfrown", 3, "\xE2\x8C\xA2" },
+	{ "sharp", 3, "\xE2\x99\xAF" },
+	{ "shchcy", 2, "\xD1\x89" },
+	{ "shcy", 2, "\xD1\x88" },
+	{ "shortmid", 3, "\xE2\x88\xA3" },
+	{ "shortparallel", 3, "\xE2\x88\xA5" },
+	{ "shy", 2, "\xC2\xAD" },
+	{ "sigma", 2, "\xCF\x83" },
+	{ "sigmaf", 2, "\xCF\x82" },
+	{ "sigmav", 2, "\xCF\x82" },
+	{ "sim", 3, "\xE2\x88\xBC" },
+	{ "simdot", 3, "\xE2\xA9\xAA" },
+	{ "sime", 3, "\xE2\x89\x83" },
+	{ "simeq", 3, "\xE2\x89\x83" },
+	{ "simg", 3, "\xE2\xAA\x9E" },
+	{ "simgE", 3, "\xE2\xAA\xA0" },
+	{ "siml", 3, "\xE2\xAA\x9D" },
+	{ "simlE", 3, "\xE2\xAA\x9F" },
+	{ "simne", 3, "\xE2\x89\x86" },
+	{ "simplus", 3, "\xE2\xA8\xA4" },
+	{ "simrarr", 3, "\xE2\xA5\xB2" },
+	{ "slarr", 3, "\xE2\x86\x90" },
+	{ "smallsetminus", 3, "\xE2\x88\x96" },
+	{ "smashp", 3, "\xE2\xA8\xB3" },
+	{ "smeparsl", 3, "\xE2\xA7\xA4" },
+	{ "smid", 3, "\xE2\x88\xA3" },
+	{ "smile", 3, "\xE2\x8C\xA3" },
+	{ "smt", 3, "\xE2\xAA\xAA" },
+	{ "smte", 3, "\xE2\xAA\xAC" },
+	{ "smtes", 6, "\xE2\xAA\xAC\xEF\xB8\x80" },
+	{ "softcy", 2, "\xD1\x8C" },
+	{ "sol", 1, "\x2F" },
+	{ "solb", 3, "\xE2\xA7\x84" },
+	{ "solbar", 3, "\xE2\x8C\xBF" },
+	{ "sopf", 4, "\xF0\x9D\x95\xA4" },
+	{ "spades", 3, "\xE2\x99\xA0" },
+	{ "spadesuit", 3, "\xE2\x99\xA0" },
+	{ "spar", 3, "\xE2\x88\xA5" },
+	{ "sqcap", 3, "\xE2\x8A\x93" },
+	{ "sqcaps", 6, "\xE2\x8A\x93\xEF\xB8\x80" },
+	{ "sqcup", 3, "\xE2\x8A\x94" },
+	{ "sqcups", 6, "\xE2\x8A\x94\xEF\xB8\x80" },
+	{ "sqsub", 3, "\xE2\x8A\x8F" },
+	{ "sqsube", 3, "\xE2\x8A\x91" },
+	{ "sqsubset", 3, "\xE2\x8A\x8F" },
+	{ "sqsubseteq", 3, "\xE2\x8A\x91" },
+	{ "sqsup", 3, "\xE2\x8A\x90" },
+	{ "sqsupe", 3, "\xE2\x8A\x92" },
+	{ "sqsupset", 3, "\xE2\x8A\x90" },
+	{ "sqsupseteq", 3, "\xE2\x8A\x92" },
+	{ "squ", 3, "\xE2\x96\xA1" },
+	{ "square", 3, "\xE2\x96\xA1" },
+	{ "squarf", 3, "\xE2\x96\xAA" },
+	{ "squf", 3, "\xE2\x96\xAA" },
+	{ "srarr", 3, "\xE2\x86\x92" },
+	{ "sscr", 4, "\xF0\x9D\x93\x88" },
+	{ "ssetmn", 3, "\xE2\x88\x96" },
+	{ "ssmile", 3, "\xE2\x8C\xA3" },
+	{ "sstarf", 3, "\xE2\x8B\x86" },
+	{ "star", 3, "\xE2\x98\x86" },
+	{ "starf", 3, "\xE2\x98\x85" },
+	{ "straightepsilon", 2, "\xCF\xB5" },
+	{ "straightphi", 2, "\xCF\x95" },
+	{ "strns", 2, "\xC2\xAF" },
+	{ "sub", 3, "\xE2\x8A\x82" },
+	{ "subE", 3, "\xE2\xAB\x85" },
+	{ "subdot", 3, "\xE2\xAA\xBD" },
+	{ "sube", 3, "\xE2\x8A\x86" },
+	{ "subedot", 3, "\xE2\xAB\x83" },
+	{ "submult", 3, "\xE2\xAB\x81" },
+	{ "subnE", 3, "\xE2\xAB\x8B" },
+	{ "subne", 3, "\xE2\x8A\x8A" },
+	{ "subplus", 3, "\xE2\xAA\xBF" },
+	{ "subrarr", 3, "\xE2\xA5\xB9" },
+	{ "subset", 3, "\xE2\x8A\x82" },
+	{ "subseteq", 3, "\xE2\x8A\x86" },
+	{ "subseteqq", 3, "\xE2\xAB\x85" },
+	{ "subsetneq", 3, "\xE2\x8A\x8A" },
+	{ "subsetneqq", 3, "\xE2\xAB\x8B" },
+	{ "subsim", 3, "\xE2\xAB\x87" },
+	{ "subsub", 3, "\xE2\xAB\x95" },
+	{ "subsup", 3, "\xE2\xAB\x93" },
+	{ "succ", 3, "\xE2\x89\xBB" },
+	{ "succapprox", 3, "\xE2\xAA\xB8" },
+	{ "succcurlyeq", 3, "\xE2\x89\xBD" },
+	{ "succeq", 3, "\xE2\xAA\xB0" },
+	{ "succnapprox", 3, "\xE2\xAA\xBA" },
+	{ "succneqq", 3, "\xE2\xAA\xB6" },
+	{ "succnsim", 3, "\xE2\x8B\xA9" },
+	{ "succsim", 3, "\xE2\x89\xBF" },
+	{ "sum", 3, "\xE2\x88\x91" },
+	{ "sung", 3, "\xE2\x99\xAA" },
+	{ "sup", 3, "\xE2\x8A\x83" },
+	{ "sup1", 2, "\xC2\xB9" },
+	{ "sup2", 2, "\xC2\xB2" },
+	{ "sup3", 2, "\xC2\xB3" },
+	{ "supE", 3, "\xE2\xAB\x86" },
+	{ "supdot", 3, "\xE2\xAA\xBE" },
+	{ "supdsub", 3, "\xE2\xAB\x98" },
+	{ "supe", 3, "\xE2\x8A\x87" },
+	{ "supedot", 3, "\xE2\xAB\x84" },
+	{ "suphsol", 3, "\xE2\x9F\x89" },
+	{ "suphsub", 3, "\xE2\xAB\x97" },
+	{ "suplarr", 3, "\xE2\xA5\xBB" },
+	{ "supmult", 3, "\xE2\xAB\x82" },
+	{ "supnE", 3, "\xE2\xAB\x8C" },
+	{ "supne", 3, "\xE2\x8A\x8B" },
+	{ "supplus", 3, "\xE2\xAB\x80" },
+	{ "supset", 3, "\xE2\x8A\x83" },
+	{ "supseteq", 3, "\xE2\x8A\x87" },
+	{ "supseteqq", 3, "\xE2\xAB\x86" },
+	{ "supsetneq", 3, "\xE2\x8A\x8B" },
+	{ "supsetneqq", 3, "\xE2\xAB\x8C" },
+	{ "supsim", 3, "\xE2\xAB\x88" },
+	{ "supsub", 3, "\xE2\xAB\x94" },
+	{ "supsup", 3, "\xE2\xAB\x96" },
+	{ "swArr", 3, "\xE2\x87\x99" },
+	{ "swarhk", 3, "\xE2\xA4\xA6" },
+	{ "swarr", 3, "\xE2\x86\x99" },
+	{ "swarrow", 3, "\xE2\x86\x99" },
+	{ "swnwar", 3, "\xE2\xA4\xAA" },
+	{ "szlig", 2, "\xC3\x9F" },
+	{ "target", 3, "\xE2\x8C\x96" },
+	{ "tau", 2, "\xCF\x84" },
+	{ "tbrk", 3, "\xE2\x8E\xB4" },
+	{ "tcaron", 2, "\xC5\xA5" },
+	{ "tcedil", 2, "\xC5\xA3" },
+	{ "tcy", 2, "\xD1\x82" },
+	{ "tdot", 3, "\xE2\x83\x9B" },
+	{ "telrec", 3, "\xE2\x8C\x95" },
+	{ "tfr", 4, "\xF0\x9D\x94\xB1" },
+	{ "there4", 3, "\xE2\x88\xB4" },
+	{ "therefore", 3, "\xE2\x88\xB4" },
+	{ "theta", 2, "\xCE\xB8" },
+	{ "thetasym", 2, "\xCF\x91" },
+	{ "thetav", 2, "\xCF\x91" },
+	{ "thickapprox", 3, "\xE2\x89\x88" },
+	{ "thicksim", 3, "\xE2\x88\xBC" },
+	{ "thinsp", 3, "\xE2\x80\x89" },
+	{ "thkap", 3, "\xE2\x89\x88" },
+	{ "thksim", 3, "\xE2\x88\xBC" },
+	{ "thorn", 2, "\xC3\xBE" },
+	{ "tilde", 2, "\xCB\x9C" },
+	{ "times", 2, "\xC3\x97" },
+	{ "timesb", 3, "\xE2\x8A\xA0" },
+	{ "timesbar", 3, "\xE2\xA8\xB1" },
+	{ "timesd", 3, "\xE2\xA8\xB0" },
+	{ "tint", 3, "\xE2\x88\xAD" },
+	{ "toea", 3, "\xE2\xA4\xA8" },
+	{ "top", 3, "\xE2\x8A\xA4" },
+	{ "topbot", 3, "\xE2\x8C\xB6" },
+	{ "topcir", 3, "\xE2\xAB\xB1" },
+	{ "topf", 4, "\xF0\x9D\x95\xA5" },
+	{ "topfork", 3, "\xE2\xAB\x9A" },
+	{ "tosa", 3, "\xE2\xA4\xA9" },
+	{ "tprime", 3, "\xE2\x80\xB4" },
+	{ "trade", 3, "\xE2\x84\xA2" },
+	{ "triangle", 3, "\xE2\x96\xB5" },
+	{ "triangledown", 3, "\xE2\x96\xBF" },
+	{ "triangleleft", 3, "\xE2\x97\x83" },
+	{ "trianglelefteq", 3, "\xE2\x8A\xB4" },
+	{ "triangleq", 3, "\xE2\x89\x9C" },
+	{ "triangleright", 3, "\xE2\x96\xB9" },
+	{ "trianglerighteq", 3, "\xE2\x8A\xB5" },
+	{ "tridot", 3, "\xE2\x97\xAC" },
+	{ "trie", 3, "\xE2\x89\x9C" },
+	{ "triminus", 3, "\xE2\xA8\xBA" },
+	{ "triplus", 3, "\xE2\xA8\xB9" },
+	{ "trisb", 3, "\xE2\xA7\x8D" },
+	{ "tritime", 3, "\xE2\xA8\xBB" },
+	{ "trpezium", 3, "\xE2\x8F\xA2" },
+	{ "tscr", 4, "\xF0\x9D\x93\x89" },
+	{ "tscy", 2, "\xD1\x86" },
+	{ "tshcy", 2, "\xD1\x9B" },
+	{ "tstrok", 2, "\xC5\xA7" },
+	{ "twixt", 3, "\xE2\x89\xAC" },
+	{ "twoheadleftarrow", 3, "\xE2\x86\x9E" },
+	{ "twoheadrightarrow", 3, "\xE2\x86\xA0" },
+	{ "uArr", 3, "\xE2\x87\x91" },
+	{ "uHar", 3, "\xE2\xA5\xA3" },
+	{ "uacute", 2, "\xC3\xBA" },
+	{ "uarr", 3, "\xE2\x86\x91" },
+	{ "ubrcy", 2, "\xD1\x9E" },
+	{ "ubreve", 2, "\xC5\xAD" },
+	{ "ucirc", 2, "\xC3\xBB" },
+	{ "ucy", 2, "\xD1\x83" },
+	{ "udarr", 3, "\xE2\x87\x85" },
+	{ "udblac", 2, "\xC5\xB1" },
+	{ "udhar", 3, "\xE2\xA5\xAE" },
+	{ "ufisht", 3, "\xE2\xA5\xBE" },
+	{ "ufr", 4, "\xF0\x9D\x94\xB2" },
+	{ "ugrave", 2, "\xC3\xB9" },
+	{ "uharl", 3, "\xE2\x86\xBF" },
+	{ "uharr", 3, "\xE2\x86\xBE" },
+	{ "uhblk", 3, "\xE2\x96\x80" },
+	{ "ulcorn", 3, "\xE2\x8C\x9C" },
+	{ "ulcorner", 3, "\xE2\x8C\x9C" },
+	{ "ulcrop", 3, "\xE2\x8C\x8F" },
+	{ "ultri", 3, "\xE2\x97\xB8" },
+	{ "umacr", 2, "\xC5\xAB" },
+	{ "uml", 2, "\xC2\xA8" },
+	{ "uogon", 2, "\xC5\xB3" },
+	{ "uopf", 4, "\xF0\x9D\x95\xA6" },
+	{ "uparrow", 3, "\xE2\x86\x91" },
+	{ "updownarrow", 3, "\xE2\x86\x95" },
+	{ "upharpoonleft", 3, "\xE2\x86\xBF" },
+	{ "upharpoonright", 3, "\xE2\x86\xBE" },
+	{ "uplus", 3, "\xE2\x8A\x8E" },
+	{ "upsi", 2, "\xCF\x85" },
+	{ "upsih", 2, "\xCF\x92" },
+	{ "upsilon", 2, "\xCF\x85" },
+	{ "upuparrows", 3, "\xE2\x87\x88" },
+	{ "urcorn", 3, "\xE2\x8C\x9D" },
+	{ "urcorner", 3, "\xE2\x8C\x9D" },
+	{ "urcrop", 3, "\xE2\x8C\x8E" },
+	{ "uring", 2, "\xC5\xAF" },
+	{ "urtri", 3, "\xE2\x97\xB9" },
+	{ "uscr", 4, "\xF0\x9D\x93\x8A" },
+	{ "utdot", 3, "\xE2\x8B\xB0" },
+	{ "utilde", 2, "\xC5\xA9" },
+	{ "utri", 3, "\xE2\x96\xB5" },
+	{ "utrif", 3, "\xE2\x96\xB4" },
+	{ "uuarr", 3, "\xE2\x87\x88" },
+	{ "uuml", 2, "\xC3\xBC" },
+	{ "uwangle", 3, "\xE2\xA6\xA7" },
+	{ "vArr", 3, "\xE2\x87\x95" },
+	{ "vBar", 3, "\xE2\xAB\xA8" },
+	{ "vBarv", 3, "\xE2\xAB\xA9" },
+	{ "vDash", 3, "\xE2\x8A\xA8" },
+	{ "vangrt", 3, "\xE2\xA6\x9C" },
+	{ "varepsilon", 2, "\xCF\xB5" },
+	{ "varkappa", 2, "\xCF\xB0" },
+	{ "varnothing", 3, "\xE2\x88\x85" },
+	{ "varphi", 2, "\xCF\x95" },
+	{ "varpi", 2, "\xCF\x96" },
+	{ "varpropto", 3, "\xE2\x88\x9D" },
+	{ "varr", 3, "\xE2\x86\x95" },
+	{ "varrho", 2, "\xCF\xB1" },
+	{ "varsigma", 2, "\xCF\x82" },
+	{ "varsubsetneq", 6, "\xE2\x8A\x8A\xEF\xB8\x80" },
+	{ "varsubsetneqq", 6, "\xE2\xAB\x8B\xEF\xB8\x80" },
+	{ "varsupsetneq", 6, "\xE2\x8A\x8B\xEF\xB8\x80" },
+	{ "varsupsetneqq", 6, "\xE2\xAB\x8C\xEF\xB8\x80" },
+	{ "vartheta", 2, "\xCF\x91" },
+	{ "vartriangleleft", 3, "\xE2\x8A\xB2" },
+	{ "vartriangleright", 3, "\xE2\x8A\xB3" },
+	{ "vcy", 2, "\xD0\xB2" },
+	{ "vdash", 3, "\xE2\x8A\xA2" },
+	{ "vee", 3, "\xE2\x88\xA8" },
+	{ "veebar", 3, "\xE2\x8A\xBB" },
+	{ "veeeq", 3, "\xE2\x89\x9A" },
+	{ "vellip", 3, "\xE2\x8B\xAE" },
+	{ "verbar", 1, "\x7C" },
+	{ "vert", 1, "\x7C" },
+	{ "vfr", 4, "\xF0\x9D\x94\xB3" },
+	{ "vltri", 3, "\xE2\x8A\xB2" },
+	{ "vnsub", 6, "\xE2\x8A\x82\xE2\x83\x92" },
+	{ "vnsup", 6, "\xE2\x8A\x83\xE2\x83\x92" },
+	{ "vopf", 4, "\xF0\x9D\x95\xA7" },
+	{ "vprop", 3, "\xE2\x88\x9D" },
+	{ "vrtri", 3, "\xE2\x8A\xB3" },
+	{ "vscr", 4, "\xF0\x9D\x93\x8B" },
+	{ "vsubnE", 6, "\xE2\xAB\x8B\xEF\xB8\x80" },
+	{ "vsubne", 6, "\xE2\x8A\x8A\xEF\xB8\x80" },
+	{ "vsupnE", 6, "\xE2\xAB\x8C\xEF\xB8\x80" },
+	{ "vsupne", 6, "\xE2\x8A\x8B\xEF\xB8\x80" },
+	{ "vzigzag", 3, "\xE2\xA6\x9A" },
+	{ "wcirc", 2, "\xC5\xB5" },
+	{ "wedbar", 3, "\xE2\xA9\x9F" },
+	{ "wedge", 3, "\xE2\x88\xA7" },
+	{ "wedgeq", 3, "\xE2\x89\x99" },
+	{ "weierp", 3, "\xE2\x84\x98" },
+	{ "wfr", 4, "\xF0\x9D\x94\xB4" },
+	{ "wopf", 4, "\xF0\x9D\x95\xA8" },
+	{ "wp", 3, "\xE2\x84\x98" },
+	{ "wr", 3, "\xE2\x89\x80" },
+	{ "wreath", 3, "\xE2\x89\x80" },
+	{ "wscr", 4, "\xF0\x9D\x93\x8C" },
+	{ "xcap", 3, "\xE2\x8B\x82" },
+	{ "xcirc", 3, "\xE2\x97\xAF" },
+	{ "xcup", 3, "\xE2\x8B\x83" },
+	{ "xdtri", 3, "\xE2\x96\xBD" },
+	{ "xfr", 4, "\xF0\x9D\x94\xB5" },
+	{ "xhArr", 3, "\xE2\x9F\xBA" },
+	{ "xharr", 3, "\xE2\x9F\xB7" },
+	{ "xi", 2, "\xCE\xBE" },
+	{ "xlArr", 3, "\xE2\x9F\xB8" },
+	{ "xlarr", 3, "\xE2\x9F\xB5" },
+	{ "xmap", 3, "\xE2\x9F\xBC" },
+	{ "xnis", 3, "\xE2\x8B\xBB" },
+	{ "xodot", 3, "\xE2\xA8\x80" },
+	{ "xopf", 4, "\xF0\x9D\x95\xA9" },
+	{ "xoplus", 3, "\xE2\xA8\x81" },
+	{ "xotime", 3, "\xE2\xA8\x82" },
+	{ "xrArr", 3, "\xE2\x9F\xB9" },
+	{ "xrarr", 3, "\xE2\x9F\xB6" },
+	{ "xscr", 4, "\xF0\x9D\x93\x8D" },
+	{ "xsqcup", 3, "\xE2\xA8\x86" },
+	{ "xuplus", 3, "\xE2\xA8\x84" },
+	{ "xutri", 3, "\xE2\x96\xB3" },
+	{ "xvee", 3, "\xE2\x8B\x81" },
+	{ "xwedge", 3, "\xE2\x8B\x80" },
+	{ "yacute", 2, "\xC3\xBD" },
+	{ "yacy", 2, "\xD1\x8F" },
+	{ "ycirc", 2, "\xC5\xB7" },
+	{ "ycy", 2, "\xD1\x8B" },
+	{ "yen", 2, "\xC2\xA5" },
+	{ "yfr", 4, "\xF0\x9D\x94\xB6" },
+	{ "yicy", 2, "\xD1\x97" },
+	{ "yopf", 4, "\xF0\x9D\x95\xAA" },
+	{ "yscr", 4, "\xF0\x9D\x93\x8E" },
+	{ "yucy", 2, "\xD1\x8E" },
+	{ "yuml", 2, "\xC3\xBF" },
+	{ "zacute", 2, "\xC5\xBA" },
+	{ "zcaron", 2, "\xC5\xBE" },
+	{ "zcy", 2, "\xD0\xB7" },
+	{ "zdot", 2, "\xC5\xBC" },
+	{ "zeetrf", 3, "\xE2\x84\xA8" },
+	{ "zeta", 2, "\xCE\xB6" },
+	{ "zfr", 4, "\xF0\x9D\x94\xB7" },
+	{ "zhcy", 2, "\xD0\xB6" },
+	{ "zigrarr", 3, "\xE2\x87\x9D" },
+	{ "zopf", 4, "\xF0\x9D\x95\xAB" },
+	{ "zscr", 4, "\xF0\x9D\x93\x8F" },
+	{ "zwj", 3, "\xE2\x80\x8D" },
+	{ "zwnj", 3, "\xE2\x80\x8C" },
+};
+
+/* bucket displacements, indexed by hash % 1024 */
+static const unsigned short html_entity_disp[1024] = {
+	0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+	0, 0, 1, 0, 0, 2, 1, 1, 0, 1, 0, 1, 0, 1, 0, 3,
+	1, 0, 4, 1, 0, 0, 4, 3, 2, 1, 0, 6, 0, 0, 0, 1,
+	0, 2, 2, 1, 0, 0, 0, 1, 0, 0, 0, 10, 1, 0, 2, 3,
+	0, 1, 0, 2, 1, 2, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1,
+	0, 3, 0, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 1, 0, 4,
+	0, 0, 0, 0, 2, 0, 1, 1, 0, 0, 3, 0, 0, 2, 0, 0,
+	0, 0, 2, 1, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 2, 1,
+	2, 1, 3, 0, 5, 0, 0, 1, 1, 0, 0, 3, 0, 0, 0, 5,
+	7, 0, 1, 0, 0, 1, 0, 1, 5, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, 0,
+	2, 0, 2, 0, 0, 0, 1, 2, 0, 2, 2, 2, 1, 4, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 1,
+	0, 3, 1, 2, 0, 0, 1, 0, 0, 0, 0, 2, 0, 1, 0, 0,
+	0, 0, 0, 1, 1, 2, 1, 0, 0, 0, 1, 2, 0, 2, 0, 0,
+	1, 0, 2, 1, 0, 1, 0, 0, 0, 4, 2, 5, 0, 3, 0, 1,
+	2, 2, 0, 0, 2, 3, 2, 1, 0, 0, 0, 9, 0, 1, 1, 1,
+	0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 2, 0,
+	0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 2, 2, 3, 0, 0, 3,
+	3, 0, 2, 0, 0, 0, 1, 2, 1, 4, 0, 1, 0, 1, 0, 0,
+	0, 0, 0, 0, 3, 2, 1, 0, 3, 0, 0, 0, 1, 1, 1, 0,
+	0, 1, 0, 0, 0, 2, 2, 0, 4, 1, 0, 0, 6, 3, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 2,
+	0, 0, 0, 3, 0, 0, 5, 2, 1, 3, 0, 0, 9, 10, 0, 0,
+	0, 1, 0, 0, 1, 0, 0, 4, 1, 1, 0, 3, 0, 2, 1, 0,
+	1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0,
+	0, 0, 1, 1, 0, 0, 1, 3, 6, 3, 1, 1, 5, 0, 0, 1,
+	2, 0, 0, 1, 2, 1, 0, 2, 2, 5, 0, 0, 2, 1, 0, 0,
+	0, 0, 1, 0, 2, 1, 0, 2, 2, 2, 3, 0, 2, 0, 0, 1,
+	1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3,
+	0, 0, 1, 0, 2, 0, 2, 3, 3, 3, 2, 3, 1, 0, 0, 1,
+	1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3,
+	2, 0, 0, 1, 2, 2, 6, 0, 2, 5, 4, 2, 0, 0, 0, 1,
+	0, 0, 1, 3, 1, 1, 0, 0, 4, 0, 3, 3, 1, 0, 0, 1,
+	1, 0, 0, 1, 3, 0, 1, 3, 1, 1, 0, 1, 0, 2, 0, 0,
+	0, 1, 1, 1, 2, 0, 1, 2, 0, 3, 6, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 1, 0, 1, 2, 0, 1, 1, 0, 1, 1,
+	0, 1, 1, 3, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0,
+	0, 2, 8, 1, 2, 1, 0, 3, 0, 1, 0, 1, 3, 0, 0, 0,
+	4, 0, 2, 1, 0, 4, 1, 1, 2, 1, 1, 0, 1, 0, 0, 3,
+	2, 0, 5, 0, 2, 4, 3, 8, 2, 0, 0, 1, 1, 2, 0, 0,
+	0, 3, 5, 0, 3, 0, 0, 0, 0, 0, 3, 0, 2, 0, 1, 0,
+	9, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 4, 0, 0, 11, 1,
+	2, 1, 2, 0, 0, 1, 1, 0, 0, 3, 0, 1, 0, 0, 2, 3,
+	0, 0, 0, 2, 0, 0, 1, 6, 3, 5, 1, 0, 1, 3, 0, 0,
+	0, 1, 1, 0, 2, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+	0, 0, 5, 2, 0, 0, 0, 1, 1, 1, 0, 7, 0, 2, 0, 0,
+	0, 1, 0, 3, 0, 3, 3, 0, 0, 0, 1, 1, 5, 0, 1, 0,
+	0, 0, 0, 0, 14, 0, 0, 3, 8, 1, 5, 2, 7, 0, 0, 0,
+	1, 0, 0, 0, 1, 2, 2, 2, 2, 0, 1, 1, 13, 0, 0, 5,
+	0, 0, 0, 0, 1, 0, 1, 2, 0, 0, 6, 2, 1, 7, 1, 0,
+	4, 4, 5, 1, 6, 0, 1, 1, 0, 2, 6, 1, 0, 1, 1, 0,
+	4, 6, 1, 1, 0, 1, 7, 1, 0, 0, 2, 10, 5, 0, 0, 1,
+	1, 0, 0, 1, 2, 1, 0, 4, 1, 0, 2, 0, 2, 6, 4, 3,
+	4, 0, 1, 2, 0, 0, 0, 1, 3, 1, 1, 2, 1, 1, 0, 0,
+	0, 0, 0, 0, 3, 3, 12, 2, 0, 5, 0, 5, 0, 1, 10, 0,
+	0, 0, 0, 1, 0, 0, 0, 4, 1, 2, 8, 1, 1, 0, 0, 0,
+	1, 0, 3, 0, 2, 0, 3, 0, 0, 10, 1, 0, 2, 0, 0, 1,
+	0, 0, 0, 2, 2, 5, 0, 12, 1, 5, 0, 3, 1, 0, 0, 1,
+	1, 3, 3, 2, 1, 0, 1, 4, 1, 0, 0, 1, 5, 2, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 1, 1, 8, 0, 0, 0, 1, 1, 0,
+	7, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 3, 6, 0, 6,
+	0, 0, 7, 2, 8, 3, 1, 0, 1, 0, 1, 0, 7, 13, 0, 1,
+	0, 1, 4, 3, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0,
+};
+
+/* slot -> entity, 0xffff when empty */
+static const unsigned short html_entity_slots[4096] = {
+	65535, 65535, 999, 65535, 104, 65535, 1658, 65535, 65535, 65535, 1042, 1265, 1253, 65535, 840, 65535,
+	1203, 65535, 65535, 650, 65535, 2120, 65535, 65535, 65535, 1104, 65535, 65535, 65535, 334, 606, 65535,
+	65535, 65535, 1621, 460, 420, 1794, 588, 1221, 65535, 65535, 65535, 65535, 65535, 423, 2012, 1028,
+	1902, 363, 2100, 65535, 1097, 895, 1989, 494, 700, 14, 1226, 65535, 598, 65535, 65535, 959,
+	65535, 65535, 65535, 465, 65535, 65535, 65535, 553, 43, 762, 65535, 65535, 1034, 468, 65535, 125,
+	65535, 1149, 65535, 521, 387, 65535, 65535, 65535, 1006, 359, 65535, 1196, 2007, 65535, 1299, 65535,
+	544, 65535, 1297, 753, 65535, 1568, 860, 241, 65535, 65535, 1057, 2026, 1131, 1183, 294, 793,
+	1119, 947, 79, 35, 65535, 156, 65535, 1724, 65535, 1675, 910, 977, 65535, 65535, 65535, 788,
+	65535, 65535, 65535, 146, 65535, 65535, 1644, 65535, 1073, 1916, 668, 65535, 415, 65535, 1185, 65535,
+	65535, 65535, 1354, 884, 65535, 158, 1148, 65535, 570, 1799, 65535, 65535, 65535, 65535, 416, 1304,
+	65535, 1234, 65535, 2074, 65535, 839, 1596, 2091, 65535, 65535, 65535, 1256, 65535, 1010, 65535, 2047,
+	65535, 65535, 65535, 65535, 1282, 1846, 1555, 65535, 1065, 65535, 193, 227, 65535, 65535, 65535, 65535,
+	65535, 1598, 2063, 65535, 1632, 1927, 407, 721, 621, 65535, 65535, 65535, 65535, 1563, 65535, 65535,
+	65535, 65535, 89, 65535, 2114, 65535, 1318, 65535, 1995, 65535, 775, 40, 1046, 65535, 65535, 65535,
+	1245, 65535, 65535, 1562, 1475, 669, 1173, 1960, 65535, 1095, 647, 65535, 873, 412, 228, 65535,
+	992, 777, 65535, 65535, 283, 65535, 626, 65535, 65535, 1578, 65535, 65535, 1383, 1429, 434, 65535,
+	487, 2036, 586, 1391, 1975, 65535, 65535, 65535, 1952, 65535, 1021, 376, 65535, 1626, 65535, 1835,
+	1867, 21, 65535, 65535, 65535, 375, 65535, 1357, 2046, 65535, 1907, 1964, 1128, 65535, 1924, 65535,
+	65535, 1775, 65535, 1785, 65535, 496, 65535, 65535, 65535, 1154, 852, 65535, 182, 65535, 1985, 1248,
+	137, 65535, 1326, 417, 510, 1313, 651, 65535, 65535, 1552, 1733, 617, 1321, 65535, 2094, 1533,
+	948, 65535, 678, 516, 65535, 251, 1180, 65535, 982, 970, 1274, 702, 149, 1491, 65535, 65535,
+	65535, 109, 65535, 913, 65535, 2079, 65535, 65535, 65535, 211, 1314, 65535, 258, 287, 1900, 1959,
+	213, 65535, 65535, 65535, 1465, 2014, 1085, 65535, 65535, 65535, 65535, 65535, 65535, 1912, 1723, 65535,
+	898, 65535, 1254, 65535, 5, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1929, 2104, 65535,
+	563, 65535, 1839, 1410, 809, 1665, 1560, 1520, 2071, 691, 1527, 65535, 1372, 319, 979, 229,
+	1140, 204, 1994, 65535, 1881, 2101, 65535, 65535, 65535, 65535, 1001, 65535, 65535, 65535, 65535, 2032,
+	1362, 65535, 65535, 65535, 65535, 1356, 65535, 1811, 65535, 65535, 65535, 1666, 1442, 65535, 65535, 697,
+	65535, 892, 1337, 1680, 65535, 733, 1507, 141, 281, 1934, 65535, 593, 65535, 65535, 1575, 65535,
+	65535, 1052, 72, 192, 2011, 316, 1423, 1133, 2045, 65535, 65535, 1132, 65535, 65535, 65535, 441,
+	960, 65535, 65535, 340, 548, 255, 65535, 2077, 1416, 65535, 1914, 65535, 1089, 665, 2119, 1255,
+	65535, 1872, 655, 1066, 65535, 65535, 65535, 65535, 546, 1784, 1107, 293, 802, 65535, 220, 65535,
+	65535, 629, 65535, 1951, 1661, 65535, 65535, 65535, 438, 65535, 1525, 65535, 514, 65535, 1922, 1529,
+	65535, 65535, 1324, 1797, 65535, 818, 65535, 308, 2116, 769, 419, 65535, 65535, 13, 1669, 65535,
+	1049, 950, 65535, 65535, 2030, 65535, 1827, 734, 244, 2029, 1187, 65535, 1295, 985, 1588, 65535,
+	329, 65535, 1353, 65535, 65535, 1279, 65535, 65535, 1539, 65535, 65535, 1561, 2118, 1417, 1296, 65535,
+	65535, 1617, 65535, 1519, 1015, 65535, 473, 65535, 65535, 1156, 774, 1940, 1963, 65535, 65535, 65535,
+	65535, 814, 1580, 194, 300, 595, 1877, 722, 65535, 690, 65535, 65535, 65535, 177, 1521, 1091,
+	719, 65535, 65535, 65535, 1602, 65535, 65535, 65535, 644, 65535, 1291, 65535, 302, 1112, 65535, 65535,
+	1135, 186, 961, 1549, 65535, 1879, 65535, 65535, 65535, 65535, 65535, 1113, 65535, 65535, 65535, 65535,
+	65535, 123, 1778, 730, 526, 65535, 65535, 1832, 65535, 923, 65535, 65535, 65535, 310, 65535, 1303,
+	65535, 65535, 65535, 746, 401, 1873, 65535, 65535, 65535, 65535, 57, 967, 65535, 65535, 65535, 1425,
+	65535, 65535, 65535, 1118, 65535, 1789, 65535, 65535, 65535, 65535, 65535, 2038, 742, 1581, 1505, 65535,
+	65535, 65535, 1719, 65535, 65535, 65535, 1258, 65535, 65535, 65535, 65535, 65535, 1369, 65535, 65535, 65535,
+	821, 1332, 65535, 65535, 542, 65535, 65535, 671, 65535, 65535, 767, 65535, 1218, 1947, 918, 435,
+	1971, 410, 65535, 711, 65535, 1216, 1349, 65535, 65535, 819, 2088, 65535, 65535, 1868, 1788, 1691,
+	65535, 65535, 81, 65535, 65535, 1978, 1722, 65535, 65535, 65535, 65535, 65535, 65535, 1479, 65535, 65535,
+	65535, 65535, 712, 1168, 609, 65535, 1284, 65535, 1695, 65535, 65535, 55, 1615, 490, 65535, 65535,
+	411, 65535, 65535, 65535, 1727, 65535, 811, 457, 65535, 38, 65535, 955, 65535, 1342, 1780, 65535,
+	1885, 65535, 1606, 1376, 65535, 65535, 65535, 65535, 65535, 65535, 221, 1033, 820, 1044, 65535, 1591,
+	65535, 65535, 1883, 65535, 532, 1398, 312, 65535, 65535, 65535, 2017, 206, 65535, 91, 1664, 65535,
+	1440, 1950, 65535, 1764, 500, 1007, 65535, 15, 65535, 65535, 1642, 65535, 280, 65535, 1662, 65535,
+	65535, 174, 65535, 65535, 65535, 65535, 65535, 65535, 1237, 610, 65535, 656, 209, 65535, 65535, 65535,
+	1884, 65535, 65535, 65535, 684, 65535, 1412, 701, 957, 65535, 1198, 893, 515, 65535, 65535, 528,
+	65535, 1670, 549, 1380, 65535, 1679, 65535, 65535, 2089, 1641, 65535, 65535, 731, 808, 1513, 167,
+	65535, 65535, 1590, 801, 1333, 365, 65535, 1813, 65535, 65535, 161, 256, 942, 1716, 65535, 2073,
+	1650, 585, 65535, 275, 65535, 2121, 760, 1077, 863, 65535, 65535, 978, 1744, 65535, 1862, 65535,
+	282, 371, 65535, 88, 65535, 65535, 861, 1153, 65535, 65535, 708, 1558, 65535, 31, 1653, 65535,
+	65535, 1067, 379, 65535, 1739, 65535, 65535, 1145, 65535, 65535, 65535, 65535, 65535, 65535, 355, 65535,
+	65535, 869, 65535, 65535, 65535, 65535, 65535, 2028, 1000, 65535, 547, 65535, 65535, 65535, 350, 1969,
+	384, 191, 2034, 878, 65535, 65535, 239, 1576, 1500, 65535, 65535, 65535, 65535, 65535, 1399, 65535,
+	65535, 335, 65535, 571, 1759, 65535, 65535, 1866, 250, 1466, 65535, 1810, 1607, 65535, 1384, 65535,
+	790, 65535, 65535, 1913, 1705, 65535, 1387, 475, 65535, 65535, 725, 65535, 1319, 958, 795, 459,
+	1628, 65535, 65535, 41, 65535, 65535, 833, 2000, 797, 65535, 824, 1048, 1890, 65535, 2060, 65535,
+	65535, 65535, 1790, 65535, 277, 486, 65535, 1878, 1634, 65535, 65535, 1816, 65535, 1981, 1470, 271,
+	380, 65535, 65535, 1652, 65535, 65535, 65535, 65535, 1781, 65535, 65535, 421, 65535, 65535, 65535, 1055,
+	1953, 65535, 1570, 65535, 1280, 118, 65535, 817, 1972, 395, 65535, 65535, 1305, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 504, 993, 65535, 1051, 65535, 65535, 557, 65535, 726, 65535, 1201, 201,
+	65535, 65535, 841, 1976, 1898, 938, 870, 65535, 65535, 859, 392, 65535, 65535, 1473, 65535, 378,
+	65535, 1601, 1903, 159, 1944, 65535, 65535, 49, 115, 1056, 1822, 1409, 445, 559, 452, 509,
+	65535, 1702, 1472, 481, 65535, 65535, 1370, 65535, 1800, 65535, 65535, 65535, 1528, 2042, 65535, 867,
+	65535, 65535, 162, 1195, 461, 65535, 65535, 65535, 584, 65535, 65535, 65535, 65535, 1078, 65535, 65535,
+	482, 65535, 1413, 65535, 1961, 1917, 65535, 65535, 97, 2085, 65535, 372, 1127, 65535, 932, 699,
+	370, 1347, 65535, 1937, 65535, 2054, 65535, 337, 1880, 65535, 530, 56, 914, 1925, 65535, 65535,
+	65535, 1857, 65535, 231, 1511, 919, 65535, 1457, 65535, 51, 65535, 1915, 715, 65535, 65535, 65535,
+	65535, 65535, 299, 1901, 65535, 65535, 65535, 65535, 1262, 1589, 65535, 65535, 331, 65535, 2123, 705,
+	65535, 709, 64, 405, 65535, 65535, 568, 1701, 65535, 1551, 1117, 65535, 65535, 65535, 65535, 65535,
+	632, 413, 65535, 336, 1395, 1547, 65535, 1674, 649, 65535, 800, 65535, 65535, 880, 65535, 65535,
+	65535, 65535, 65535, 65535, 1126, 65535, 65535, 1170, 93, 1808, 65535, 65535, 65535, 2096, 65535, 681,
+	1162, 65535, 65535, 1559, 65535, 298, 65535, 1215, 940, 1993, 2015, 1962, 1294, 1016, 65535, 517,
+	65535, 65535, 2019, 2022, 65535, 65535, 543, 1040, 1746, 65535, 703, 65535, 65535, 65535, 128, 65535,
+	65535, 65535, 474, 65535, 1805, 574, 1955, 65535, 539, 810, 65535, 65535, 65535, 65535, 65535, 1134,
+	1456, 900, 65535, 2048, 65535, 1545, 65535, 65535, 1990, 1899, 65535, 1690, 1804, 414, 2113, 1039,
+	65535, 65535, 65535, 1685, 65535, 65535, 65535, 1556, 65535, 65535, 65535, 65535, 799, 265, 65535, 1977,
+	433, 1905, 65535, 65535, 798, 65535, 65535, 65535, 65535, 65535, 317, 65535, 622, 65535, 636, 65535,
+	218, 65535, 1344, 180, 65535, 963, 1259, 853, 65535, 65535, 144, 65535, 1795, 1115, 65535, 105,
+	558, 65535, 442, 65535, 791, 1851, 65535, 321, 1431, 858, 65535, 1405, 65535, 1020, 65535, 65535,
+	65535, 65535, 1069, 1312, 1996, 1150, 1422, 2097, 65535, 65535, 1096, 68, 1791, 65535, 65535, 65535,
+	653, 567, 1646, 65535, 65535, 65535, 65535, 2081, 1844, 1286, 315, 65535, 1197, 1504, 1919, 65535,
+	917, 65535, 1106, 641, 223, 1086, 974, 65535, 65535, 65535, 65535, 1316, 65535, 65535, 65535, 65535,
+	65535, 1619, 65535, 1415, 65535, 865, 1174, 1, 65535, 65535, 65535, 65535, 65535, 187, 65535, 264,
+	1101, 605, 1627, 65535, 65535, 66, 1352, 65535, 1638, 65535, 1045, 786, 65535, 65535, 65535, 65535,
+	65535, 65535, 65535, 1060, 261, 499, 65535, 65535, 65535, 1151, 65535, 65535, 737, 642, 65535, 65535,
+	65535, 65535, 520, 65535, 65535, 65535, 784, 65535, 190, 34, 65535, 1737, 1227, 747, 65535, 1062,
+	1146, 65535, 922, 1945, 581, 65535, 65535, 1030, 1329, 237, 65535, 65535, 65535, 65535, 65535, 65535,
+	1847, 65535, 65535, 2001, 658, 933, 65535, 170, 65535, 262, 65535, 1997, 65535, 314, 65535, 1571,
+	322, 1235, 65535, 65535, 1251, 65535, 65535, 1298, 65535, 65535, 449, 1247, 65535, 1278, 541, 65535,
+	65535, 2016, 65535, 1742, 505, 65535, 27, 65535, 755, 65535, 65535, 65535, 65535, 130, 2013, 65535,
+	886, 1300, 246, 1441, 745, 65535, 1523, 65535, 326, 198, 65535, 855, 1283, 535, 1374, 816,
+	65535, 1823, 85, 65535, 65535, 645, 65535, 1731, 65535, 771, 674, 65535, 1273, 437, 65535, 65535,
+	805, 65535, 614, 830, 888, 65535, 114, 1713, 846, 65535, 65535, 1213, 1366, 1573, 65535, 794,
+	65535, 65535, 822, 65535, 207, 1612, 269, 65535, 65535, 1176, 65535, 1050, 65535, 65535, 364, 65535,
+	65535, 694, 2055, 65535, 65535, 1941, 1158, 929, 65535, 61, 1390, 247, 65535, 292, 65535, 1886,
+	92, 1826, 1220, 65535, 396, 1499, 1807, 65535, 432, 254, 1054, 65535, 73, 640, 65535, 65535,
+	65535, 2083, 718, 71, 65535, 65535, 65535, 65535, 1308, 65535, 1566, 65535, 65535, 1396, 1735, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 4, 65535, 65535, 1368, 1803, 1437, 872, 1233, 1061, 65535,
+	634, 65535, 65535, 65535, 353, 65535, 440, 2008, 1343, 489, 295, 575, 116, 77, 69, 1289,
+	787, 65535, 2031, 941, 65535, 65535, 1820, 65535, 65535, 65535, 102, 1072, 776, 983, 65535, 65535,
+	65535, 65535, 1087, 65535, 804, 600, 447, 677, 652, 1710, 1355, 65535, 65535, 155, 1774, 1022,
+	65535, 687, 65535, 466, 2112, 763, 1377, 65535, 65535, 33, 1798, 924, 402, 65535, 65535, 65535,
+	65535, 1446, 1793, 1537, 65535, 65535, 1137, 381, 65535, 65535, 2053, 1656, 2069, 1673, 720, 65535,
+	65535, 65535, 65535, 909, 975, 1631, 1854, 1141, 240, 2056, 65535, 65535, 911, 65535, 1858, 2111,
+	352, 65535, 1630, 1167, 65535, 65535, 65535, 1142, 65535, 478, 65535, 65535, 946, 646, 65535, 1459,
+	65535, 2040, 894, 65535, 1768, 65535, 607, 1102, 203, 1721, 1178, 65535, 916, 1455, 949, 1406,
+	618, 65535, 65535, 1371, 471, 1830, 65535, 1911, 976, 2095, 1894, 65535, 1843, 65535, 65535, 65535,
+	65535, 325, 1100, 934, 138, 1365, 65535, 1783, 1339, 65535, 1770, 1684, 65535, 1206, 1577, 65535,
+	65535, 997, 65535, 695, 65535, 495, 65535, 890, 1874, 65535, 1105, 332, 1760, 65535, 1659, 1485,
+	1998, 65535, 391, 1483, 1108, 1011, 928, 1325, 65535, 9, 1928, 564, 991, 1516, 65535, 2105,
+	1451, 65535, 184, 65535, 1949, 754, 792, 2041, 65535, 1979, 65535, 899, 1574, 980, 1861, 65535,
+	65535, 1875, 65535, 1381, 65535, 661, 1697, 956, 561, 2021, 65535, 65535, 65535, 65535, 65535, 1692,
+	1236, 65535, 351, 927, 65535, 65535, 65535, 65535, 22, 65535, 65535, 1228, 1301, 1157, 2009, 65535,
+	195, 65535, 65535, 65535, 1031, 65535, 65535, 65535, 65535, 1285, 328, 2093, 545, 1244, 1080, 65535,
+	1936, 1428, 65535, 65535, 65535, 1647, 65535, 1430, 628, 65535, 65535, 346, 65535, 1748, 1340, 65535,
+	65535, 1363, 1871, 65535, 409, 1439, 883, 766, 65535, 65535, 65535, 65535, 1331, 62, 65535, 65535,
+	1418, 2033, 65535, 65535, 124, 1489, 65535, 667, 1678, 1683, 1290, 757, 65535, 65535, 65535, 65535,
+	2080, 1738, 65535, 65535, 65535, 65535, 1620, 65535, 507, 65535, 1480, 1219, 65535, 915, 65535, 849,
+	1309, 369, 65535, 920, 65535, 1982, 2043, 854, 1139, 1186, 625, 987, 1565, 65535, 65535, 344,
+	1264, 65535, 65535, 257, 65535, 565, 1152, 65535, 65535, 2099, 1503, 65535, 1510, 134, 1250, 2082,
+	1869, 65535, 1856, 768, 65535, 65535, 65535, 1217, 65535, 65535, 65535, 2020, 99, 65535, 65535, 1179,
+	65535, 65535, 1182, 65535, 1755, 65535, 65535, 65535, 65535, 782, 65535, 1829, 65535, 65535, 971, 215,
+	65535, 1435, 65535, 1462, 65535, 47, 65535, 65535, 65535, 1210, 65535, 1622, 65535, 65535, 1882, 1199,
+	759, 422, 612, 65535, 1035, 65535, 1448, 65535, 65535, 65535, 65535, 65535, 65535, 807, 779, 24,
+	2115, 1163, 1122, 65535, 1004, 151, 65535, 318, 65535, 65535, 65535, 65535, 1252, 773, 831, 238,
+	65535, 65535, 1745, 65535, 65535, 65535, 65535, 2092, 65535, 65535, 65535, 1109, 383, 70, 1677, 1535,
+	65535, 65535, 65535, 65535, 2064, 65535, 65535, 1193, 1932, 503, 603, 65535, 906, 1753, 936, 65535,
+	165, 65535, 333, 58, 1657, 1704, 65535, 65535, 65535, 189, 65535, 60, 2061, 1263, 65535, 65535,
+	1859, 1732, 65535, 65535, 65535, 65535, 1190, 65535, 1200, 65535, 552, 815, 65535, 65535, 65535, 65535,
+	1335, 65535, 122, 65535, 1814, 65535, 1741, 65535, 534, 65535, 65535, 1720, 903, 65535, 729, 65535,
+	1987, 120, 866, 65535, 454, 65535, 65535, 65535, 65535, 1625, 1358, 1531, 65535, 732, 458, 65535,
+	485, 65535, 796, 65535, 744, 65535, 1834, 937, 65535, 592, 65535, 65535, 1715, 65535, 1424, 65535,
+	65535, 65535, 2003, 65535, 65535, 1493, 65535, 65535, 1292, 345, 65535, 1404, 65535, 65535, 65535, 65535,
+	65535, 2035, 2062, 65535, 65535, 65535, 996, 1027, 306, 926, 462, 65535, 65535, 260, 65535, 65535,
+	65535, 663, 1787, 65535, 65535, 1038, 654, 65535, 65535, 1801, 630, 921, 65535, 65535, 65535, 1019,
+	1667, 65535, 106, 65535, 1838, 65535, 65535, 1099, 65535, 1037, 2044, 65535, 65535, 65535, 65535, 65535,
+	65535, 1604, 1310, 65535, 1098, 65535, 501, 65535, 857, 716, 65535, 65535, 65535, 65535, 2078, 738,
+	2075, 65535, 65535, 1241, 65535, 1954, 65535, 65535, 1541, 65535, 39, 65535, 65535, 65535, 87, 172,
+	65535, 65535, 1211, 65535, 65535, 1469, 65535, 1920, 502, 65535, 65535, 65535, 65535, 65535, 65535, 529,
+	1508, 65535, 1270, 65535, 65535, 65535, 945, 633, 253, 1538, 65535, 1524, 65535, 188, 1908, 8,
+	65535, 65535, 2065, 65535, 659, 995, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2107, 65535, 65535,
+	1618, 1392, 65535, 65535, 16, 357, 65535, 65535, 65535, 724, 65535, 1863, 1991, 2098, 309, 65535,
+	615, 1743, 65535, 65535, 65535, 65535, 65535, 448, 65535, 1378, 65535, 101, 1718, 2087, 693, 65535,
+	202, 163, 65535, 65535, 65535, 952, 65535, 1443, 65535, 65535, 113, 65535, 65535, 65535, 121, 1876,
+	361, 65535, 65535, 169, 65535, 2023, 65535, 90, 65535, 597, 65535, 65535, 234, 1014, 518, 591,
+	65535, 65535, 65535, 65535, 1923, 65535, 65535, 65535, 65535, 65535, 1833, 1840, 65535, 65535, 65535, 1515,
+	65535, 65535, 65535, 877, 65535, 65535, 844, 65535, 65535, 2049, 1276, 65535, 566, 1948, 65535, 887,
+	65535, 847, 65535, 713, 639, 65535, 65535, 65535, 1853, 65535, 1817, 65535, 1983, 23, 65535, 65535,
+	65535, 1375, 100, 65535, 1761, 966, 74, 65535, 65535, 65535, 1754, 65535, 1640, 65535, 65535, 65535,
+	65535, 65535, 1610, 65535, 1346, 1725, 2117, 65535, 1267, 65535, 912, 65535, 65535, 65535, 65535, 418,
+	65535, 65535, 65535, 1763, 65535, 65535, 540, 65535, 65535, 65535, 1765, 65535, 65535, 65535, 582, 65535,
+	472, 65535, 425, 589, 65535, 664, 1689, 65535, 1740, 1554, 65535, 577, 65535, 65535, 450, 65535,
+	65535, 764, 1672, 65535, 65535, 388, 1260, 196, 1572, 65535, 65535, 1379, 279, 65535, 527, 65535,
+	65535, 65535, 65535, 65535, 65535, 1850, 65535, 1389, 65535, 65535, 117, 25, 65535, 772, 65535, 1341,
+	882, 1327, 1629, 65535, 65535, 65535, 1317, 439, 65535, 65535, 65535, 2005, 65535, 2086, 1023, 1772,
+	65535, 65535, 1338, 377, 65535, 259, 76, 12, 65535, 65535, 451, 65535, 65535, 65535, 65535, 1686,
+	1125, 65535, 103, 164, 1486, 1328, 19, 65535, 1595, 65535, 1616, 65535, 65535, 65535, 446, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 86, 65535, 83, 1700, 65535, 1269, 65535, 65535,
+	1257, 248, 65535, 770, 65535, 998, 968, 1013, 291, 65535, 2058, 65535, 65535, 65535, 1143, 1926,
+	426, 1345, 65535, 1238, 65535, 497, 65535, 65535, 65535, 65535, 18, 524, 984, 65535, 1546, 1401,
+	65535, 619, 65535, 65535, 303, 65535, 523, 65535, 480, 555, 1330, 1970, 65535, 806, 65535, 219,
+	65535, 354, 676, 2103, 723, 1946, 1232, 65535, 65535, 1487, 1444, 75, 1496, 65535, 1514, 342,
+	1287, 65535, 65535, 1076, 65535, 1687, 1209, 404, 65535, 1512, 65535, 965, 65535, 168, 65535, 222,
+	368, 65535, 65535, 1361, 65535, 65535, 1476, 803, 1711, 1293, 1411, 1534, 65535, 65535, 65535, 1889,
+	1351, 65535, 65535, 907, 65535, 65535, 594, 65535, 1967, 390, 65535, 65535, 65535, 1350, 65535, 65535,
+	1003, 119, 65535, 1694, 2004, 627, 1471, 65535, 1029, 1536, 954, 65535, 1698, 1320, 65535, 1809,
+	80, 65535, 1821, 65535, 1477, 1463, 1144, 301, 689, 65535, 65535, 1130, 2084, 65535, 217, 65535,
+	65535, 1492, 611, 65535, 65535, 330, 65535, 65535, 65535, 65535, 65535, 65535, 1921, 1171, 65535, 512,
+	65535, 65535, 1272, 65535, 95, 1777, 65535, 65535, 1693, 65535, 65535, 65535, 2072, 50, 65535, 864,
+	65535, 1481, 65535, 65535, 65535, 65535, 65535, 150, 1160, 1302, 82, 1624, 290, 65535, 65535, 1009,
+	65535, 660, 1815, 65535, 178, 1111, 273, 538, 26, 881, 1032, 842, 1498, 65535, 65535, 498,
+	29, 65535, 65535, 3, 65535, 1494, 65535, 65535, 1600, 65535, 65535, 1717, 1968, 65535, 65535, 1478,
+	1419, 848, 63, 583, 1059, 65535, 65535, 765, 1266, 386, 65535, 1841, 65535, 65535, 65535, 65535,
+	65535, 431, 1502, 65535, 1359, 65535, 1041, 65535, 278, 455, 347, 65535, 65535, 65535, 1518, 65535,
+	65535, 10, 65535, 65535, 65535, 1762, 1025, 65535, 65535, 578, 65535, 986, 65535, 491, 65535, 741,
+	1633, 1382, 65535, 749, 868, 1845, 65535, 96, 108, 65535, 65535, 65535, 65535, 406, 736, 65535,
+	751, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 230, 1246, 65535, 65535, 579, 1315,
+	778, 65535, 65535, 1490, 1909, 1414, 1782, 65535, 643, 65535, 1707, 65535, 1708, 65535, 1497, 1579,
+	65535, 1169, 136, 65535, 65535, 216, 1449, 493, 65535, 1542, 1433, 142, 1597, 65535, 1688, 324,
+	65535, 65535, 181, 828, 477, 65535, 1767, 1896, 1214, 65535, 65535, 65535, 65535, 1155, 2027, 143,
+	65535, 1147, 1161, 338, 65535, 65535, 65535, 341, 65535, 1207, 366, 65535, 65535, 1175, 65535, 65535,
+	65535, 727, 789, 1464, 1897, 65535, 65535, 139, 1064, 65535, 1676, 1408, 1773, 65535, 65535, 65535,
+	65535, 154, 613, 54, 65535, 65535, 65535, 65535, 65535, 879, 1181, 1530, 2067, 65535, 65535, 65535,
+	362, 698, 65535, 930, 1432, 65535, 65535, 65535, 65535, 680, 65535, 65535, 65535, 65535, 65535, 679,
+	32, 1008, 65535, 65535, 65535, 1648, 981, 2106, 65535, 1603, 476, 65535, 65535, 429, 20, 65535,
+	1081, 1837, 989, 183, 623, 1605, 65535, 65535, 65535, 2010, 631, 1024, 65535, 65535, 65535, 176,
+	637, 46, 65535, 65535, 65535, 944, 65535, 1828, 1584, 65535, 65535, 65535, 148, 65535, 7, 65535,
+	210, 1564, 65535, 951, 65535, 1567, 1906, 65535, 65535, 65535, 710, 1123, 1988, 825, 65535, 748,
+	65535, 65535, 1093, 1918, 1637, 604, 65535, 65535, 65535, 648, 1818, 65535, 65535, 1887, 65535, 65535,
+	65535, 1453, 65535, 65535, 65535, 1957, 1553, 569, 1608, 685, 1757, 65535, 1654, 65535, 65535, 65535,
+	624, 65535, 1517, 67, 1311, 65535, 65535, 266, 2076, 65535, 65535, 65535, 65535, 1671, 1910, 1842,
+	65535, 65535, 385, 599, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1522, 65535,
+	717, 65535, 812, 65535, 65535, 65535, 1103, 65535, 65535, 2025, 65535, 65535, 943, 65535, 1240, 519,
+	233, 65535, 268, 65535, 1092, 65535, 53, 65535, 1655, 829, 235, 635, 1205, 313, 2050, 65535,
+	65535, 65535, 65535, 65535, 65535, 1849, 65535, 1751, 65535, 1426, 212, 65535, 367, 65535, 1852, 65535,
+	1786, 157, 65535, 506, 1639, 65535, 761, 65535, 1223, 65535, 65535, 65535, 1090, 65535, 65535, 1888,
+	65535, 783, 1082, 65535, 6, 65535, 1540, 969, 1474, 1792, 252, 65535, 1191, 65535, 65535, 1047,
+	1771, 1447, 834, 1583, 289, 65535, 531, 65535, 65535, 65535, 65535, 408, 65535, 65535, 205, 65535,
+	1812, 65535, 65535, 2108, 1402, 65535, 65535, 153, 65535, 1364, 1769, 696, 1116, 65535, 550, 65535,
+	288, 1892, 483, 65535, 735, 1088, 444, 65535, 1079, 488, 65535, 1509, 2068, 1865, 65535, 1204,
+	65535, 65535, 891, 1334, 536, 65535, 65535, 562, 135, 65535, 1367, 65535, 65535, 1609, 65535, 962,
+	65535, 65535, 1752, 2122, 65535, 905, 65535, 65535, 428, 65535, 1736, 65535, 686, 871, 65535, 1593,
+	65535, 208, 65535, 1322, 1184, 1288, 374, 284, 65535, 1192, 65535, 65535, 65535, 65535, 1225, 743,
+	65535, 65535, 65535, 65535, 756, 65535, 65535, 556, 862, 1094, 65535, 65535, 65535, 65535, 2057, 1012,
+	781, 171, 65535, 65535, 65535, 65535, 1230, 65535, 707, 1649, 65535, 65535, 1543, 657, 140, 874,
+	65535, 827, 65535, 484, 65535, 65535, 112, 1730, 145, 403, 554, 2006, 65535, 65535, 1585, 65535,
+	1645, 166, 65535, 1569, 65535, 65535, 65535, 65535, 65535, 1893, 901, 673, 65535, 65535, 65535, 902,
+	65535, 65535, 1243, 672, 65535, 1895, 1026, 65535, 1070, 953, 65535, 65535, 65535, 2124, 65535, 65535,
+	65535, 1002, 65535, 908, 107, 373, 65535, 1017, 65535, 65535, 1068, 670, 44, 1939, 65535, 65535,
+	1696, 65535, 1277, 683, 2, 2037, 65535, 1613, 98, 638, 65535, 1323, 65535, 65535, 65535, 48,
+	1709, 1557, 1766, 65535, 296, 394, 2018, 1824, 65535, 752, 525, 464, 65535, 65535, 1063, 65535,
+	964, 65535, 304, 453, 65535, 267, 522, 65535, 226, 1058, 1005, 65535, 427, 65535, 110, 65535,
+	65535, 65535, 65535, 1036, 65535, 1943, 65535, 65535, 430, 65535, 65535, 1427, 65535, 65535, 65535, 65535,
+	263, 65535, 785, 65535, 65535, 65535, 675, 1271, 65535, 750, 2110, 65535, 1053, 65535, 875, 551,
+	65535, 1306, 65535, 65, 65535, 850, 65535, 1974, 65535, 65535, 1965, 1992, 65535, 602, 65535, 65535,
+	1806, 1075, 990, 65535, 885, 65535, 1942, 28, 1438, 470, 65535, 1348, 1400, 65535, 65535, 65535,
+	11, 1668, 65535, 65535, 65535, 1501, 297, 65535, 65535, 65535, 65535, 65535, 65535, 572, 65535, 65535,
+	2059, 65535, 706, 65535, 65535, 245, 65535, 590, 65535, 65535, 1831, 236, 1336, 1728, 1860, 845,
+	65535, 65535, 1935, 65535, 249, 320, 1747, 1712, 65535, 185, 65535, 65535, 65535, 1138, 65535, 65535,
+	30, 65535, 65535, 1586, 65535, 1930, 1548, 2024, 1275, 1779, 111, 65535, 1018, 65535, 1420, 1445,
+	200, 682, 65535, 65535, 1999, 1749, 52, 1635, 1836, 356, 65535, 1074, 560, 65535, 65535, 45,
+	456, 65535, 65535, 65535, 65535, 1388, 65535, 573, 1229, 65535, 65535, 65535, 994, 147, 339, 1506,
+	65535, 1172, 1394, 65535, 65535, 65535, 65535, 65535, 65535, 739, 1796, 479, 826, 65535, 65535, 511,
+	37, 65535, 1239, 129, 1714, 65535, 224, 65535, 1110, 65535, 904, 65535, 65535, 1855, 65535, 1083,
+	1891, 1231, 1484, 1802, 851, 65535, 65535, 2066, 65535, 65535, 1166, 65535, 1594, 876, 1550, 65535,
+	1864, 131, 65535, 65535, 65535, 65535, 199, 65535, 65535, 939, 65535, 65535, 65535, 65535, 508, 349,
+	65535, 65535, 1242, 65535, 65535, 65535, 935, 1682, 740, 1966, 1984, 1403, 1973, 65535, 132, 65535,
+	65535, 2052, 65535, 65535, 843, 65535, 1825, 65535, 65535, 65535, 65535, 897, 1393, 65535, 1452, 1124,
+	175, 65535, 65535, 65535, 580, 65535, 65535, 65535, 65535, 1488, 1222, 225, 1188, 1373, 65535, 65535,
+	65535, 197, 65535, 311, 65535, 65535, 65535, 160, 65535, 65535, 1611, 443, 925, 758, 65535, 65535,
+	65535, 360, 537, 65535, 662, 856, 704, 65535, 65535, 65535, 65535, 65535, 838, 65535, 65535, 65535,
+	65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1729, 601, 65535, 65535, 65535, 1734, 65535, 65535,
+	1726, 1159, 65535, 1043, 65535, 65535, 65535, 65535, 1177, 65535, 1532, 513, 65535, 1249, 1958, 65535,
+	65535, 65535, 65535, 1189, 65535, 0, 305, 65535, 616, 436, 65535, 1663, 896, 65535, 728, 65535,
+	65535, 276, 424, 1587, 587, 2102, 65535, 813, 576, 1084, 889, 1980, 688, 1592, 1436, 1706,
+	94, 1071, 59, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2051, 65535, 836, 65535, 1114,
+	65535, 1460, 65535, 1482, 65535, 65535, 1636, 232, 1397, 65535, 1986, 972, 1756, 65535, 65535, 152,
+	65535, 2070, 1750, 242, 65535, 65535, 65535, 286, 243, 173, 343, 65535, 1819, 214, 837, 133,
+	65535, 1164, 65535, 835, 65535, 65535, 492, 65535, 65535, 65535, 1454, 65535, 65535, 65535, 65535, 1938,
+	65535, 65535, 65535, 1121, 1307, 1776, 1467, 65535, 65535, 65535, 65535, 1703, 65535, 65535, 65535, 65535,
+	65535, 285, 65535, 65535, 65535, 666, 65535, 65535, 65535, 65535, 1870, 1450, 463, 931, 1136, 714,
+	988, 780, 1461, 65535, 84, 348, 65535, 65535, 467, 1421, 1933, 65535, 65535, 65535, 397, 65535,
+	65535, 65535, 65535, 65535, 65535, 17, 65535, 179, 1385, 596, 307, 823, 399, 1261, 1268, 65535,
+	1434, 65535, 1202, 65535, 65535, 1526, 1212, 65535, 1194, 1224, 1904, 65535, 65535, 65535, 2109, 65535,
+	1660, 127, 1651, 400, 1386, 1643, 65535, 973, 36, 78, 274, 2002, 65535, 1495, 1208, 692,
+	65535, 1165, 65535, 65535, 1699, 389, 65535, 65535, 65535, 65535, 1544, 126, 1758, 1614, 327, 832,
+	2090, 65535, 1681, 65535, 65535, 65535, 65535, 1360, 1407, 65535, 1623, 469, 272, 65535, 65535, 608,
+	65535, 1468, 65535, 620, 1931, 65535, 270, 323, 65535, 393, 65535, 42, 358, 65535, 65535, 65535,
+	1129, 1599, 1848, 65535, 1956, 1582, 1458, 533, 398, 382, 65535, 1120, 65535, 1281, 65535, 2039,
+};
+
+static inline unsigned int
+hash_entity(const char *str, size_t len)
+{
+	unsigned int h = 2166136261u;
+	size_t i;
+
+	for (i = 0; i < len; ++i) {
+		h ^= (unsigned char)str[i];
+		h *= 16777619u;
+	}
+
+	return h;
+}
+
+static inline unsigned int
+mix_entity(unsigned int h)
+{
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return h;
+}
+
+/* find_entity • the entity named str[0..len) (no '&' or ';'), or NULL */
+static const struct html_ent *
+find_entity(const char *str, size_t len)
+{
+	const struct html_ent *ent;
+	unsigned int h, slot;
+
+	if (len == 0 || len > HTML_ENTITY_MAX_LENGTH)
+		return NULL;
+
+	h = hash_entity(str, len);
+	slot = html_entity_slots[mix_entity(h ^ html_entity_disp[h % 1024]) & 4095];
+
+	if (slot == 0xffff)
+		return NULL;
+
+	ent = &html_entities[slot];
+	if (strncmp(ent->entity, str, len) != 0 || ent->entity[len] != '\0')
+		return NULL;
+
+	return ent;
+}
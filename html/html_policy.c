@@ -0,0 +1,345 @@
+#include "buffer.h"
+#include "html.h"
+#include "chartype.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* nodes are addressed with 16 bits; node 0 is the root */
+#define POLICY_MAX_NODES 0xffff
+
+enum {
+	POLICY_EXACT = (1 << 0),	/* a rule ends here */
+	POLICY_SUBDOMAINS = (1 << 1),	/* "*." rule: anything further left matches */
+};
+
+/*
+ * Trie alphabet: letters are case-folded to 1-26, digits are 27-36,
+ * then '-', '.', '+' and '_'. Any other byte (0) never matches.
+ */
+#define POLICY_CLASSES 41
+
+static const uint8_t policy_class[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 0, 37, 38, 0,
+	27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 0, 0, 0, 0, 0, 0,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 0, 0, 0, 40,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+struct policy_node {
+	uint16_t next[POLICY_CLASSES];	/* 0: no edge */
+	uint8_t flags;
+};
+
+struct policy_trie {
+	struct policy_node *nodes;
+	size_t count;
+	size_t asize;
+};
+
+struct sdhtml_policy {
+	struct policy_trie schemes;
+	struct policy_trie hosts;	/* reversed host names */
+	struct buf *proxy;
+	unsigned int flags;
+};
+
+static inline int
+is_scheme_char(uint8_t c)
+{
+	return sd_isalnum(c) || c == '+' || c == '-' || c == '.';
+}
+
+/* is_delim • ends the part of a URL before the path */
+static inline int
+is_delim(uint8_t c)
+{
+	return c == '/' || c == '?' || c == '#' || c == '\\';
+}
+
+static inline int
+is_unreserved(uint8_t c)
+{
+	return sd_isalnum(c) || c == '-' || c == '.' || c == '_' || c == '~';
+}
+
+/********************
+ * TRIE             *
+ ********************/
+
+static int
+trie_init(struct policy_trie *trie)
+{
+	trie->nodes = calloc(8, sizeof(struct policy_node));
+	if (!trie->nodes)
+		return -1;
+
+	trie->count = 1;
+	trie->asize = 8;
+	return 0;
+}
+
+/* trie_step • child of `node` for byte c, created when `grow` is set.
+ * Returns 0 when there is none */
+static uint16_t
+trie_step(struct policy_trie *trie, uint16_t node, uint8_t c, int grow)
+{
+	uint8_t k = policy_class[c];
+	uint16_t child;
+
+	if (k == 0)
+		return 0;
+
+	child = trie->nodes[node].next[k];
+	if (child || !grow)
+		return child;
+
+	if (trie->count == POLICY_MAX_NODES)
+		return 0;
+
+	if (trie->count == trie->asize) {
+		size_t asize = trie->asize * 2;
+		struct policy_node *nodes = realloc(trie->nodes, asize * sizeof(struct policy_node));
+
+		if (!nodes)
+			return 0;
+
+		memset(nodes + trie->asize, 0x0, (asize - trie->asize) * sizeof(struct policy_node));
+		trie->nodes = nodes;
+		trie->asize = asize;
+	}
+
+	child = (uint16_t)trie->count++;
+	trie->nodes[node].next[k] = child;
+	return child;
+}
+
+/* host_match • walks the host right to left through the reversed host
+ * trie, stopping early on a "*." rule */
+static int
+host_match(const struct policy_trie *trie, const uint8_t *host, size_t size)
+{
+	uint16_t node = 0;
+
+	if (size && host[size - 1] == '.')
+		size--;
+
+	if (size == 0)
+		return 0;
+
+	while (size > 0) {
+		uint8_t k = policy_class[host[--size]];
+
+		if (k == 0 || (node = trie->nodes[node].next[k]) == 0)
+			return 0;
+
+		if (size > 0 && host[size] == '.' &&
+			(trie->nodes[node].flags & POLICY_SUBDOMAINS))
+			return 1;
+	}
+
+	return (trie->nodes[node].flags & POLICY_EXACT) != 0;
+}
+
+/********************
+ * POLICY           *
+ ********************/
+
+struct sdhtml_policy *
+sdhtml_policy_new(unsigned int flags)
+{
+	struct sdhtml_policy *policy;
+
+	policy = malloc(sizeof(struct sdhtml_policy));
+	if (!policy)
+		return NULL;
+
+	memset(policy, 0x0, sizeof(struct sdhtml_policy));
+	policy->flags = flags;
+
+	if (trie_init(&policy->schemes) < 0 || trie_init(&policy->hosts) < 0) {
+		sdhtml_policy_free(policy);
+		return NULL;
+	}
+
+	return policy;
+}
+
+void
+sdhtml_policy_free(struct sdhtml_policy *policy)
+{
+	if (!policy)
+		return;
+
+	free(policy->schemes.nodes);
+	free(policy->hosts.nodes);
+	bufrelease(policy->proxy);
+	free(policy);
+}
+
+int
+sdhtml_policy_allow_scheme(struct sdhtml_policy *policy, const char *scheme)
+{
+	size_t i, len = strlen(scheme);
+	uint16_t node = 0;
+
+	if (len == 0 || !sd_isalpha(scheme[0]))
+		return -1;
+
+	for (i = 0; i < len; ++i) {
+		if (!is_scheme_char((uint8_t)scheme[i]))
+			return -1;
+
+		if ((node = trie_step(&policy->schemes, node, (uint8_t)scheme[i], 1)) == 0)
+			return -1;
+	}
+
+	policy->schemes.nodes[node].flags |= POLICY_EXACT;
+	return 0;
+}
+
+int
+sdhtml_policy_allow_host(struct sdhtml_policy *policy, const char *host)
+{
+	size_t len = strlen(host), end = 0;
+	uint8_t flag = POLICY_EXACT;
+	uint16_t node = 0;
+
+	if (len > 2 && host[0] == '*' && host[1] == '.') {
+		flag = POLICY_SUBDOMAINS;
+		end = 1;	/* keep the dot: it is matched as a label boundary */
+	}
+
+	if (len > end && host[len - 1] == '.')
+		len--;
+
+	if (len <= end)
+		return -1;
+
+	while (len > end) {
+		if ((node = trie_step(&policy->hosts, node, (uint8_t)host[--len], 1)) == 0)
+			return -1;
+	}
+
+	policy->hosts.nodes[node].flags |= flag;
+	return 0;
+}
+
+int
+sdhtml_policy_set_proxy(struct sdhtml_policy *policy, const char *prefix)
+{
+	if (!prefix || !prefix[0]) {
+		bufrelease(policy->proxy);
+		policy->proxy = NULL;
+		return 0;
+	}
+
+	if (!policy->proxy && (policy->proxy = bufnew(64)) == NULL)
+		return -1;
+
+	policy->proxy->size = 0;
+	bufputs(policy->proxy, prefix);
+	return 0;
+}
+
+enum sdhtml_link_verdict
+sdhtml_policy_check(const struct sdhtml_policy *policy, const uint8_t *url, size_t size)
+{
+	size_t i = 0, auth_end, host_beg, host_end;
+	uint16_t node = 0;
+	int known = 1;
+
+	/* scheme: a letter, then letters, digits, '+', '-' or '.' up to a ':' */
+	if (size && sd_isalpha(url[0])) {
+		for (; i < size && is_scheme_char(url[i]); ++i) {
+			if (known && (node = policy->schemes.nodes[node].next[policy_class[url[i]]]) == 0)
+				known = 0;
+		}
+	}
+
+	if (i > 0 && i < size && url[i] == ':') {
+		if (!known || !(policy->schemes.nodes[node].flags & POLICY_EXACT))
+			return SDHTML_LINK_DENY;
+		i++;
+	} else {
+		/* a ':' before the path means a scheme we could not parse
+		 * ("java\tscript:"), never a relative link */
+		for (i = 0; i < size && !is_delim(url[i]); ++i) {
+			if (url[i] == ':')
+				return SDHTML_LINK_DENY;
+		}
+
+		if (!(policy->flags & SDHTML_POLICY_RELATIVE))
+			return SDHTML_LINK_DENY;
+
+		i = 0;
+	}
+
+	/* no authority, or no host rules: nothing left to check */
+	if (policy->hosts.count == 1 || i + 2 > size || url[i] != '/' || url[i + 1] != '/')
+		return SDHTML_LINK_ALLOW;
+
+	i += 2;
+	for (auth_end = i; auth_end < size && !is_delim(url[auth_end]); ++auth_end);
+
+	/* the host follows the last userinfo '@' and ends at the port */
+	host_beg = i;
+	for (; i < auth_end; ++i) {
+		if (url[i] == '@')
+			host_beg = i + 1;
+	}
+
+	for (host_end = host_beg; host_end < auth_end && url[host_end] != ':'; ++host_end);
+
+	if (host_match(&policy->hosts, url + host_beg, host_end - host_beg))
+		return SDHTML_LINK_ALLOW;
+
+	return policy->proxy ? SDHTML_LINK_PROXY : SDHTML_LINK_DENY;
+}
+
+void
+sdhtml_policy_rewrite(struct buf *ob, const struct sdhtml_policy *policy, const uint8_t *url, size_t size)
+{
+	static const char hex_chars[] = "0123456789ABCDEF";
+	size_t i = 0, org;
+
+	if (!policy->proxy) {
+		bufput(ob, url, size);
+		return;
+	}
+
+	bufgrow(ob, ob->size + policy->proxy->size + size * 3);
+	bufput(ob, policy->proxy->data, policy->proxy->size);
+
+	/* the original URL goes in as one query component */
+	while (i < size) {
+		org = i;
+		while (i < size && is_unreserved(url[i]))
+			i++;
+
+		if (i > org)
+			bufput(ob, url + org, i - org);
+
+		if (i >= size)
+			break;
+
+		bufputc(ob, '%');
+		bufputc(ob, hex_chars[(url[i] >> 4) & 0xf]);
+		bufputc(ob, hex_chars[url[i] & 0xf]);
+		i++;
+	}
+}
+
+/* vim: set filetype=c: */
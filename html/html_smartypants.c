@@ -16,34 +16,29 @@
 
 #include "buffer.h"
 #include "html.h"
+#include "scan.h"
+#include "chartype.h"
 
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <ctype.h>
 
 #if defined(_WIN32)
 #define snprintf	_snprintf		
 #endif
 
-struct smartypants_data {
-	int in_squote;
-	int in_dquote;
-};
-
-static size_t smartypants_cb__ltag(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
-static size_t smartypants_cb__dquote(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
-static size_t smartypants_cb__amp(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
-static size_t smartypants_cb__period(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
-static size_t smartypants_cb__number(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
-static size_t smartypants_cb__dash(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
-static size_t smartypants_cb__parens(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
-static size_t smartypants_cb__squote(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
-static size_t smartypants_cb__backtick(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
-static size_t smartypants_cb__escape(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
+static size_t smartypants_cb__dquote(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
+static size_t smartypants_cb__amp(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
+static size_t smartypants_cb__period(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
+static size_t smartypants_cb__number(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
+static size_t smartypants_cb__dash(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
+static size_t smartypants_cb__parens(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
+static size_t smartypants_cb__squote(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
+static size_t smartypants_cb__backtick(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
+static size_t smartypants_cb__escape(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size);
 
 static size_t (*smartypants_cb_ptrs[])
-	(struct buf *, struct smartypants_data *, uint8_t, const uint8_t *, size_t) =
+	(struct buf *, struct sdhtml_smartypants *, uint8_t, const uint8_t *, size_t) =
 {
 	NULL,					/* 0 */
 	smartypants_cb__dash,	/* 1 */
@@ -53,7 +48,7 @@ static size_t (*smartypants_cb_ptrs[])
 	smartypants_cb__amp,	/* 5 */
 	smartypants_cb__period,	/* 6 */
 	smartypants_cb__number,	/* 7 */
-	smartypants_cb__ltag,	/* 8 */
+	NULL,					/* 8: '<', see smartypants_run */
 	smartypants_cb__backtick, /* 9 */
 	smartypants_cb__escape, /* 10 */
 };
@@ -77,10 +72,42 @@ static const uint8_t smartypants_cb_chars[] = {
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
+static const struct sd_charset smartypants_cb_set = {
+	smartypants_cb_chars, "\"&'(-.13<\\`", 11
+};
+
+#define HTML_TEXT_ESCAPED(c) \
+	((c) == '<' || (c) == '>' || (c) == '&' || (c) == '\'' || (c) == '"')
+
+/* bytes sdhtml_smartypants_text stops at: the smartypants triggers, plus
+ * the bytes escape_html rewrites */
+static const uint8_t smartypants_text_chars[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 1, 0,
+	0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const struct sd_charset smartypants_text_set = {
+	smartypants_text_chars, "\"&'(-.13<>\\`", 12
+};
+
 static inline int
 word_boundary(uint8_t c)
 {
-	return c == 0 || isspace(c) || ispunct(c);
+	return c == 0 || sd_isspace(c) || sd_ispunct(c);
 }
 
 static int
@@ -101,10 +128,10 @@ smartypants_quotes(struct buf *ob, uint8_t previous_char, uint8_t next_char, uin
 }
 
 static size_t
-smartypants_cb__squote(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+smartypants_cb__squote(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
 	if (size >= 2) {
-		uint8_t t1 = tolower(text[1]);
+		uint8_t t1 = sd_tolower(text[1]);
 
 		if (t1 == '\'') {
 			if (smartypants_quotes(ob, previous_char, size >= 3 ? text[2] : 0, 'd', &smrt->in_dquote))
@@ -112,25 +139,25 @@ smartypants_cb__squote(struct buf *ob, struct smartypants_data *smrt, uint8_t pr
 		}
 
 		if ((t1 == 's' || t1 == 't' || t1 == 'm' || t1 == 'd') &&
-			(size == 3 || word_boundary(text[2]))) {
+			(size == 2 || word_boundary(text[2]))) {
 			BUFPUTSL(ob, "&rsquo;");
 			return 0;
 		}
 
 		if (size >= 3) {
-			uint8_t t2 = tolower(text[2]);
+			uint8_t t2 = sd_tolower(text[2]);
 
 			if (((t1 == 'r' && t2 == 'e') ||
 				(t1 == 'l' && t2 == 'l') ||
 				(t1 == 'v' && t2 == 'e')) &&
-				(size == 4 || word_boundary(text[3]))) {
+				(size == 3 || word_boundary(text[3]))) {
 				BUFPUTSL(ob, "&rsquo;");
 				return 0;
 			}
 		}
 	}
 
-	if (smartypants_quotes(ob, previous_char, size > 0 ? text[1] : 0, 's', &smrt->in_squote))
+	if (smartypants_quotes(ob, previous_char, size > 1 ? text[1] : 0, 's', &smrt->in_squote))
 		return 0;
 
 	bufputc(ob, text[0]);
@@ -138,11 +165,11 @@ smartypants_cb__squote(struct buf *ob, struct smartypants_data *smrt, uint8_t pr
 }
 
 static size_t
-smartypants_cb__parens(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+smartypants_cb__parens(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
 	if (size >= 3) {
-		uint8_t t1 = tolower(text[1]);
-		uint8_t t2 = tolower(text[2]);
+		uint8_t t1 = sd_tolower(text[1]);
+		uint8_t t2 = sd_tolower(text[2]);
 
 		if (t1 == 'c' && t2 == ')') {
 			BUFPUTSL(ob, "&copy;");
@@ -165,7 +192,7 @@ smartypants_cb__parens(struct buf *ob, struct smartypants_data *smrt, uint8_t pr
 }
 
 static size_t
-smartypants_cb__dash(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+smartypants_cb__dash(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
 	if (size >= 3 && text[1] == '-' && text[2] == '-') {
 		BUFPUTSL(ob, "&mdash;");
@@ -182,7 +209,7 @@ smartypants_cb__dash(struct buf *ob, struct smartypants_data *smrt, uint8_t prev
 }
 
 static size_t
-smartypants_cb__amp(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+smartypants_cb__amp(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
 	if (size >= 6 && memcmp(text, "&quot;", 6) == 0) {
 		if (smartypants_quotes(ob, previous_char, size >= 7 ? text[6] : 0, 'd', &smrt->in_dquote))
@@ -197,7 +224,7 @@ smartypants_cb__amp(struct buf *ob, struct smartypants_data *smrt, uint8_t previ
 }
 
 static size_t
-smartypants_cb__period(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+smartypants_cb__period(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
 	if (size >= 3 && text[1] == '.' && text[2] == '.') {
 		BUFPUTSL(ob, "&hellip;");
@@ -214,7 +241,7 @@ smartypants_cb__period(struct buf *ob, struct smartypants_data *smrt, uint8_t pr
 }
 
 static size_t
-smartypants_cb__backtick(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+smartypants_cb__backtick(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
 	if (size >= 2 && text[1] == '`') {
 		if (smartypants_quotes(ob, previous_char, size >= 3 ? text[2] : 0, 'd', &smrt->in_dquote))
@@ -225,7 +252,7 @@ smartypants_cb__backtick(struct buf *ob, struct smartypants_data *smrt, uint8_t
 }
 
 static size_t
-smartypants_cb__number(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+smartypants_cb__number(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
 	if (word_boundary(previous_char) && size >= 3) {
 		if (text[0] == '1' && text[1] == '/' && text[2] == '2') {
@@ -237,7 +264,7 @@ smartypants_cb__number(struct buf *ob, struct smartypants_data *smrt, uint8_t pr
 
 		if (text[0] == '1' && text[1] == '/' && text[2] == '4') {
 			if (size == 3 || word_boundary(text[3]) ||
-				(size >= 5 && tolower(text[3]) == 't' && tolower(text[4]) == 'h')) {
+				(size >= 5 && sd_tolower(text[3]) == 't' && sd_tolower(text[4]) == 'h')) {
 				BUFPUTSL(ob, "&frac14;");
 				return 2;
 			}
@@ -245,7 +272,7 @@ smartypants_cb__number(struct buf *ob, struct smartypants_data *smrt, uint8_t pr
 
 		if (text[0] == '3' && text[1] == '/' && text[2] == '4') {
 			if (size == 3 || word_boundary(text[3]) ||
-				(size >= 6 && tolower(text[3]) == 't' && tolower(text[4]) == 'h' && tolower(text[5]) == 's')) {
+				(size >= 6 && sd_tolower(text[3]) == 't' && sd_tolower(text[4]) == 'h' && sd_tolower(text[5]) == 's')) {
 				BUFPUTSL(ob, "&frac34;");
 				return 2;
 			}
@@ -257,56 +284,35 @@ smartypants_cb__number(struct buf *ob, struct smartypants_data *smrt, uint8_t pr
 }
 
 static size_t
-smartypants_cb__dquote(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+smartypants_cb__dquote(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
-	if (!smartypants_quotes(ob, previous_char, size > 0 ? text[1] : 0, 'd', &smrt->in_dquote))
+	if (!smartypants_quotes(ob, previous_char, size > 1 ? text[1] : 0, 'd', &smrt->in_dquote))
 		BUFPUTSL(ob, "&quot;");
 
 	return 0;
 }
 
-static size_t
-smartypants_cb__ltag(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
-{
-	static const char *skip_tags[] = {
-	  "pre", "code", "var", "samp", "kbd", "math", "script", "style"
-	};
-	static const size_t skip_tags_count = 8;
-
-	size_t tag, i = 0;
+static const char *skip_tags[] = {
+  "pre", "code", "var", "samp", "kbd", "math", "script", "style"
+};
+static const size_t skip_tags_count = 8;
 
-	while (i < size && text[i] != '>')
-		i++;
+/* smartypants_skip_tag • index of the skip tag opened at `text`, or -1 */
+static int
+smartypants_skip_tag(const uint8_t *text, size_t size)
+{
+	size_t tag;
 
 	for (tag = 0; tag < skip_tags_count; ++tag) {
 		if (sdhtml_is_tag(text, size, skip_tags[tag]) == HTML_TAG_OPEN)
-			break;
+			return (int)tag;
 	}
 
-	if (tag < skip_tags_count) {
-		for (;;) {
-			while (i < size && text[i] != '<')
-				i++;
-
-			if (i == size)
-				break;
-
-			if (sdhtml_is_tag(text + i, size - i, skip_tags[tag]) == HTML_TAG_CLOSE)
-				break;
-
-			i++;
-		}
-
-		while (i < size && text[i] != '>')
-			i++;
-	}
-
-	bufput(ob, text, i + 1);
-	return i;
+	return -1;
 }
 
 static size_t
-smartypants_cb__escape(struct buf *ob, struct smartypants_data *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
+smartypants_cb__escape(struct buf *ob, struct sdhtml_smartypants *smrt, uint8_t previous_char, const uint8_t *text, size_t size)
 {
 	if (size < 2)
 		return 0;
@@ -357,33 +363,263 @@ static struct {
 };
 #endif
 
+/* bytes a trigger may look at past itself: "&quot;" and "3/4ths" read
+ * seven, sdhtml_is_tag on "</script>" nine */
+#define SMARTYPANTS_LOOKAHEAD 16
+
+enum smartypants_state {
+	SMARTYPANTS_TEXT,
+	SMARTYPANTS_TAG,	/* inside a tag, up to its '>' */
+	SMARTYPANTS_SKIP,	/* inside a skip tag, up to its closing tag */
+	SMARTYPANTS_CLOSE,	/* inside that closing tag, up to its '>' */
+};
+
+struct sdhtml_smartypants_stream {
+	struct sdhtml_smartypants smrt;
+	enum smartypants_state state;
+	int skip_tag;
+	uint8_t previous_char;
+	struct buf *hold;
+};
+
+/* smartypants_run • transforms `text`, returning how much of it was
+ * consumed. Unless `final`, it stops at the first trigger that has less
+ * than SMARTYPANTS_LOOKAHEAD bytes after it, so that its callback sees
+ * the same bytes it would on the whole document */
+static size_t
+smartypants_run(struct buf *ob, struct sdhtml_smartypants_stream *st, const uint8_t *text, size_t size, int final)
+{
+	const uint8_t *end;
+	size_t i = 0, org;
+	uint8_t action;
+
+	while (i < size) {
+		org = i;
+
+		switch (st->state) {
+		case SMARTYPANTS_TAG:
+		case SMARTYPANTS_CLOSE:
+			end = memchr(text + i, '>', size - i);
+			i = end ? (size_t)(end - text) + 1 : size;
+			bufput(ob, text + org, i - org);
+
+			if (end)
+				st->state = (st->state == SMARTYPANTS_TAG && st->skip_tag >= 0) ?
+					SMARTYPANTS_SKIP : SMARTYPANTS_TEXT;
+			continue;
+
+		case SMARTYPANTS_SKIP:
+			end = memchr(text + i, '<', size - i);
+			i = end ? (size_t)(end - text) : size;
+			bufput(ob, text + org, i - org);
+
+			if (i == size || (!final && size - i < SMARTYPANTS_LOOKAHEAD))
+				goto out;
+
+			if (sdhtml_is_tag(text + i, size - i, skip_tags[st->skip_tag]) == HTML_TAG_CLOSE)
+				st->state = SMARTYPANTS_CLOSE;
+
+			bufputc(ob, '<');
+			i++;
+			continue;
+
+		case SMARTYPANTS_TEXT:
+			i += sd_scan(text + i, size - i, &smartypants_cb_set);
+			bufput(ob, text + org, i - org);
+
+			if (i == size || (!final && size - i < SMARTYPANTS_LOOKAHEAD))
+				goto out;
+
+			if (text[i] == '<') {
+				st->skip_tag = smartypants_skip_tag(text + i, size - i);
+				st->state = SMARTYPANTS_TAG;
+				continue;
+			}
+
+			action = smartypants_cb_chars[text[i]];
+			i += smartypants_cb_ptrs[(int)action]
+				(ob, &st->smrt, i ? text[i - 1] : st->previous_char, text + i, size - i) + 1;
+			continue;
+		}
+	}
+
+out:
+	if (i > 0)
+		st->previous_char = text[i - 1];
+
+	return i;
+}
+
 void
 sdhtml_smartypants(struct buf *ob, const uint8_t *text, size_t size)
 {
-	size_t i;
-	struct smartypants_data smrt = {0, 0};
+	struct sdhtml_smartypants_stream st;
 
 	if (!text)
 		return;
 
+	memset(&st, 0x0, sizeof(st));
 	bufgrow(ob, size);
+	smartypants_run(ob, &st, text, size, 1);
+}
 
-	for (i = 0; i < size; ++i) {
-		size_t org;
-		uint8_t action = 0;
+struct sdhtml_smartypants_stream *
+sdhtml_smartypants_new(void)
+{
+	struct sdhtml_smartypants_stream *st;
 
+	st = malloc(sizeof(struct sdhtml_smartypants_stream));
+	if (!st)
+		return NULL;
+
+	memset(st, 0x0, sizeof(struct sdhtml_smartypants_stream));
+
+	st->hold = bufnew(2 * SMARTYPANTS_LOOKAHEAD);
+	if (!st->hold) {
+		free(st);
+		return NULL;
+	}
+
+	return st;
+}
+
+void
+sdhtml_smartypants_feed(struct buf *ob, struct sdhtml_smartypants_stream *st, const uint8_t *data, size_t size)
+{
+	struct buf *hold = st->hold;
+	size_t used, n, back;
+
+	while (size) {
+		if (!hold->size) {
+			used = smartypants_run(ob, st, data, size, 0);
+			bufput(hold, data + used, size - used);
+			return;
+		}
+
+		/* the held trigger gets its lookahead from the head of the chunk;
+		 * whatever of the chunk it does not consume goes back to it */
+		n = size < SMARTYPANTS_LOOKAHEAD ? size : SMARTYPANTS_LOOKAHEAD;
+		bufput(hold, data, n);
+		data += n;
+		size -= n;
+
+		used = smartypants_run(ob, st, hold->data, hold->size, 0);
+
+		if (used + n >= hold->size) {
+			back = hold->size - used;
+			data -= back;
+			size += back;
+			hold->size = 0;
+		}
+		else
+			bufslurp(hold, used);
+	}
+}
+
+void
+sdhtml_smartypants_finish(struct buf *ob, struct sdhtml_smartypants_stream *st)
+{
+	struct buf *hold = st->hold;
+
+	smartypants_run(ob, st, hold->data, hold->size, 1);
+
+	memset(st, 0x0, sizeof(struct sdhtml_smartypants_stream));
+	hold->size = 0;
+	st->hold = hold;
+}
+
+void
+sdhtml_smartypants_free(struct sdhtml_smartypants_stream *st)
+{
+	if (!st)
+		return;
+
+	bufrelease(st->hold);
+	free(st);
+}
+
+/*
+ * Text mode: `text` is raw, as the renderer receives it, and is escaped
+ * for HTML on the way out. The result matches running sdhtml_smartypants
+ * over the escaped text: that pass sees '"' as "&quot;" (still a double
+ * quote), but the apostrophe only as "&#39;", which it leaves alone.
+ */
+void
+sdhtml_smartypants_text(struct buf *ob, struct sdhtml_smartypants *smrt, const uint8_t *text, size_t size)
+{
+	uint8_t previous_char = ob->size ? ob->data[ob->size - 1] : 0;
+	size_t i = 0, org;
+
+	if (!size)
+		return;
+
+	bufgrow(ob, ob->size + size);
+
+	/* second half of a "``" or of a backslash escape */
+	if (smrt->tail_ob == ob && smrt->tail_at == ob->size) {
+		if (smrt->tail == '`' && text[0] == '`') {
+			if (smartypants_quotes(ob, previous_char, size >= 2 ? text[1] : 0, 'd', &smrt->in_dquote))
+				i = 1;
+		}
+		else if (smrt->tail == '\\' && (text[0] == '\\' || text[0] == '.' || text[0] == '-' || text[0] == '`')) {
+			ob->data[ob->size - 1] = text[0];
+			i = 1;
+		}
+	}
+
+	smrt->tail_ob = NULL;
+
+	for (; i < size; ++i) {
 		org = i;
-		while (i < size && (action = smartypants_cb_chars[text[i]]) == 0)
-			i++;
+		i += sd_scan(text + i, size - i, &smartypants_text_set);
 
 		if (i > org)
 			bufput(ob, text + org, i - org);
 
-		if (i < size) {
-			i += smartypants_cb_ptrs[(int)action]
-				(ob, &smrt, i ? text[i - 1] : 0, text + i, size - i);
+		if (i >= size)
+			break;
+
+		if (i > 0)
+			previous_char = text[i - 1];
+
+		switch (text[i]) {
+		case '<': BUFPUTSL(ob, "&lt;"); break;
+		case '>': BUFPUTSL(ob, "&gt;"); break;
+		case '&': BUFPUTSL(ob, "&amp;"); break;
+		case '\'': BUFPUTSL(ob, "&#39;"); break;
+
+		case '"':
+			if (!smartypants_quotes(ob, previous_char, i + 1 < size ? text[i + 1] : 0, 'd', &smrt->in_dquote))
+				BUFPUTSL(ob, "&quot;");
+			break;
+
+		case '\\':
+			/* escaped, the next byte would start with '&'; at the end
+			 * of the run it is a newline or a tag */
+			if (i + 1 == size || HTML_TEXT_ESCAPED(text[i + 1])) {
+				bufputc(ob, '\\');
+				if (i + 1 == size) {
+					smrt->tail = '\\';
+					smrt->tail_ob = ob;
+					smrt->tail_at = ob->size;
+				}
+				break;
+			}
+			/* fall through */
+
+		case '`':
+			if (i + 1 == size) {
+				smrt->tail = '`';
+				smrt->tail_ob = ob;
+				smrt->tail_at = ob->size;
+				break;
+			}
+			/* fall through */
+
+		default:
+			i += smartypants_cb_ptrs[(int)smartypants_cb_chars[text[i]]]
+				(ob, smrt, previous_char, text + i, size - i);
 		}
 	}
 }
 
-
@@ -0,0 +1,384 @@
+#include "markdown.h"
+#include "text.h"
+#include "chartype.h"
+
+#include <string.h>
+
+#include "houdini.h"
+
+/*
+ * Every callback writes text that is already folded: no space at the
+ * start of a buffer or of a line, never two in a row. The text given to
+ * span and block callbacks was written by the callbacks below, so it is
+ * copied as is. Block callbacks put their text on lines of its own, so
+ * nested blocks come out one per line.
+ */
+
+/* end_line • drops the trailing spaces and ends the current line */
+static void
+end_line(struct buf *ob)
+{
+	while (ob->size && ob->data[ob->size - 1] == ' ')
+		ob->size--;
+
+	if (ob->size && ob->data[ob->size - 1] != '\n')
+		bufputc(ob, '\n');
+}
+
+/* put_text • appends `data` with every run of whitespace as one space.
+ * Single spaces between words are copied along with them */
+static void
+put_text(struct buf *ob, const uint8_t *data, size_t size)
+{
+	size_t i = 0, org;
+
+	while (i < size) {
+		if (sd_isspace(data[i])) {
+			while (i < size && sd_isspace(data[i]))
+				i++;
+
+			if (ob->size && !sd_isspace(ob->data[ob->size - 1]))
+				bufputc(ob, ' ');
+			continue;
+		}
+
+		org = i;
+		while (i < size && (!sd_isspace(data[i]) ||
+			(data[i] == ' ' && i + 1 < size && !sd_isspace(data[i + 1]))))
+			i++;
+
+		bufput(ob, data + org, i - org);
+	}
+}
+
+/* put_block • appends the text of a block on lines of its own; the text
+ * is already folded, only its ends need trimming */
+static void
+put_block(struct buf *ob, const uint8_t *data, size_t size)
+{
+	while (size && sd_isspace(data[0])) {
+		data++;
+		size--;
+	}
+
+	while (size && sd_isspace(data[size - 1]))
+		size--;
+
+	if (!size)
+		return;
+
+	end_line(ob);
+	bufput(ob, data, size);
+	bufputc(ob, '\n');
+}
+
+/* unescape_text • decodes the entities of `data`. Non-breaking spaces
+ * ("&nbsp;", "&#160;") come out as plain ones, so that they keep words
+ * apart */
+static void
+unescape_text(struct buf *ob, const uint8_t *data, size_t size)
+{
+	size_t org = ob->size, i, j;
+
+	houdini_unescape_html(ob, data, size);
+
+	for (i = j = org; i < ob->size; ++i, ++j) {
+		if (ob->data[i] == 0xC2 && i + 1 < ob->size && ob->data[i + 1] == 0xA0) {
+			ob->data[j] = ' ';
+			i++;
+		}
+		else
+			ob->data[j] = ob->data[i];
+	}
+
+	ob->size = j;
+}
+
+/* count_words • on folded text every word but the last one is followed
+ * by exactly one space or newline */
+static size_t
+count_words(const uint8_t *data, size_t size)
+{
+	size_t i, words = 0;
+
+	while (size && sd_isspace(data[0])) {
+		data++;
+		size--;
+	}
+
+	if (!size)
+		return 0;
+
+	for (i = 0; i < size; ++i)
+		words += (data[i] == ' ') | (data[i] == '\n');
+
+	return words + !sd_isspace(data[size - 1]);
+}
+
+static void
+text_blockcode(struct buf *ob, const struct buf *text, const struct buf *lang, void *opaque)
+{
+	struct sdtext_renderopt *options = opaque;
+
+	options->stats.code_blocks++;
+
+	if (!text)
+		return;
+
+	end_line(ob);
+	put_text(ob, text->data, text->size);
+	end_line(ob);
+}
+
+static void
+text_block(struct buf *ob, const struct buf *text, void *opaque)
+{
+	if (text)
+		put_block(ob, text->data, text->size);
+}
+
+/* text_blockhtml • the text between the tags, with entities decoded.
+ * Every tag counts as a space, so that "<p>a</p><p>b</p>" keeps its
+ * words apart */
+static void
+text_blockhtml(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct buf *work;
+	size_t i = 0, org;
+	const uint8_t *end;
+
+	if (!text)
+		return;
+
+	work = bufnew(64);
+	if (!work)
+		return;
+
+	while (i < text->size) {
+		org = i;
+		end = memchr(text->data + i, '<', text->size - i);
+		i = end ? (size_t)(end - text->data) : text->size;
+
+		if (i > org)
+			unescape_text(work, text->data + org, i - org);
+
+		if (i >= text->size)
+			break;
+
+		end = memchr(text->data + i, '>', text->size - i);
+		i = end ? (size_t)(end - text->data) + 1 : text->size;
+		bufputc(work, ' ');
+	}
+
+	end_line(ob);
+	put_text(ob, work->data, work->size);
+	end_line(ob);
+	bufrelease(work);
+}
+
+static void
+text_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+{
+	text_block(ob, text, opaque);
+}
+
+static void
+text_hrule(struct buf *ob, void *opaque)
+{
+	end_line(ob);
+}
+
+static void
+text_list(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	text_block(ob, text, opaque);
+}
+
+static void
+text_table(struct buf *ob, const struct buf *header, const struct buf *body, void *opaque)
+{
+	text_block(ob, header, opaque);
+	text_block(ob, body, opaque);
+}
+
+static void
+text_tablecell(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	if (!text || !text->size)
+		return;
+
+	if (ob->size && !sd_isspace(ob->data[ob->size - 1]))
+		bufputc(ob, ' ');
+
+	bufput(ob, text->data, text->size);
+}
+
+static int
+text_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, void *opaque)
+{
+	struct sdtext_renderopt *options = opaque;
+
+	if (!link || !link->size)
+		return 0;
+
+	options->stats.links++;
+
+	/* the visible text of an autolink is the URL itself, as in
+	 * rndr_autolink */
+	if (bufprefix(link, "mailto:") == 0)
+		put_text(ob, link->data + 7, link->size - 7);
+	else
+		put_text(ob, link->data, link->size);
+
+	return 1;
+}
+
+static int
+text_span(struct buf *ob, const struct buf *text, void *opaque)
+{
+	if (!text || !text->size)
+		return 0;
+
+	bufput(ob, text->data, text->size);
+	return 1;
+}
+
+static int
+text_codespan(struct buf *ob, const struct buf *text, void *opaque)
+{
+	if (text)
+		put_text(ob, text->data, text->size);
+	return 1;
+}
+
+static int
+text_image(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *alt, void *opaque)
+{
+	struct sdtext_renderopt *options = opaque;
+
+	options->stats.images++;
+	return 1;
+}
+
+static int
+text_linebreak(struct buf *ob, void *opaque)
+{
+	if (ob->size && !sd_isspace(ob->data[ob->size - 1]))
+		bufputc(ob, ' ');
+	return 1;
+}
+
+static int
+text_link(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
+{
+	struct sdtext_renderopt *options = opaque;
+
+	options->stats.links++;
+
+	if (content)
+		bufput(ob, content->data, content->size);
+	return 1;
+}
+
+static int
+text_raw_html(struct buf *ob, const struct buf *text, void *opaque)
+{
+	return 1;
+}
+
+/* text_entity • decoded; "&#10;", "&nbsp;" and the like fold as any
+ * whitespace */
+static void
+text_entity(struct buf *ob, const struct buf *entity, void *opaque)
+{
+	size_t org = ob->size;
+
+	unescape_text(ob, entity->data, entity->size);
+
+	if (ob->size == org + 1 && sd_isspace(ob->data[org])) {
+		ob->size = org;
+		if (ob->size && !sd_isspace(ob->data[ob->size - 1]))
+			bufputc(ob, ' ');
+	}
+}
+
+static void
+text_normal_text(struct buf *ob, const struct buf *text, void *opaque)
+{
+	if (text)
+		put_text(ob, text->data, text->size);
+}
+
+static void
+text_doc_header(struct buf *ob, void *opaque)
+{
+	struct sdtext_renderopt *options = opaque;
+
+	memset(&options->stats, 0x0, sizeof(options->stats));
+	options->doc_start = ob->size;
+}
+
+/* text_doc_footer • the words are counted once, over the finished text,
+ * so that a word split by inline markup ("un*usual*") counts once */
+static void
+text_doc_footer(struct buf *ob, void *opaque)
+{
+	struct sdtext_renderopt *options = opaque;
+
+	if (options->doc_start < ob->size)
+		options->stats.words = count_words(ob->data + options->doc_start,
+			ob->size - options->doc_start);
+}
+
+void
+sdtext_renderer(struct sd_callbacks *callbacks, struct sdtext_renderopt *options)
+{
+	static const struct sd_callbacks cb_default = {
+		text_blockcode,
+		text_block,
+		text_blockhtml,
+		text_header,
+		text_hrule,
+		text_list,
+		text_list,
+		text_block,
+		text_table,
+		text_block,
+		text_tablecell,
+
+		text_autolink,
+		text_codespan,
+		text_span,
+		text_span,
+		text_image,
+		text_linebreak,
+		text_link,
+		text_raw_html,
+		text_span,
+		text_span,
+		text_span,
+
+		text_entity,
+		text_normal_text,
+
+		text_doc_header,
+		text_doc_footer,
+	};
+
+	memset(options, 0x0, sizeof(struct sdtext_renderopt));
+	memcpy(callbacks, &cb_default, sizeof(struct sd_callbacks));
+}
+
+unsigned int
+sdtext_reading_time(const struct sdtext_stats *stats, unsigned int words_per_minute)
+{
+	size_t seconds;
+
+	if (!words_per_minute)
+		words_per_minute = SDTEXT_WORDS_PER_MINUTE;
+
+	seconds = (stats->words * 60 + words_per_minute - 1) / words_per_minute;
+	return seconds > (unsigned int)-1 ? (unsigned int)-1 : (unsigned int)seconds;
+}
+
+/* vim: set filetype=c: */
@@ -0,0 +1,48 @@
+#ifndef UPSKIRT_TEXT_H
+#define UPSKIRT_TEXT_H
+
+#include "markdown.h"
+#include "buffer.h"
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* words read per minute when sdtext_reading_time is given 0 */
+#define SDTEXT_WORDS_PER_MINUTE 200
+
+/* sdtext_stats • counted while rendering, reset at the start of every
+ * render */
+struct sdtext_stats {
+	size_t words;		/* runs of non-space in the text written, code included */
+	size_t code_blocks;
+	size_t links;		/* links and autolinks */
+	size_t images;
+};
+
+struct sdtext_renderopt {
+	struct sdtext_stats stats;
+
+	/* where this render started writing in the output buffer */
+	size_t doc_start;
+};
+
+/* sdtext_renderer • plain text for search indexing: only the visible
+ * text is written, with entities decoded, URLs and HTML tags dropped,
+ * and whitespace folded to single spaces inside a block and single
+ * newlines between blocks */
+extern void
+sdtext_renderer(struct sd_callbacks *callbacks, struct sdtext_renderopt *options_ptr);
+
+/* sdtext_reading_time • seconds needed to read the counted words, rounded
+ * up; 0 words per minute uses SDTEXT_WORDS_PER_MINUTE */
+extern unsigned int
+sdtext_reading_time(const struct sdtext_stats *stats, unsigned int words_per_minute);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
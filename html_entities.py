@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+# html_entities.py • writes html/html_entities.h from html_entities.gperf
+#
+# The lookup is a hash-and-displace perfect hash: FNV-1a picks one of
+# BUCKETS buckets, and the displacement of the bucket, mixed into the
+# hash, picks a slot among SLOTS. Each lookup costs one hash and at most
+# one strncmp. The keyword list stays in gperf format, so gperf can still
+# read it, but the output is the same on every machine.
+#
+# usage: python3 html_entities.py html_entities.gperf > html/html_entities.h
+
+import sys
+
+SLOTS = 4096
+BUCKETS = 1024
+EMPTY = 0xffff
+
+
+def fnv(name):
+	h = 2166136261
+	for c in name:
+		h = ((h ^ c) * 16777619) & 0xffffffff
+	return h
+
+
+def mix(h):
+	h ^= h >> 16
+	h = (h * 0x85ebca6b) & 0xffffffff
+	h ^= h >> 13
+	h = (h * 0xc2b2ae35) & 0xffffffff
+	h ^= h >> 16
+	return h
+
+
+def parse(path):
+	"""(name, utf8) pairs of the keyword section, sorted by name"""
+	entities = []
+	section = 0
+
+	for line in open(path, 'rb').read().split(b'\n'):
+		if line == b'%%':
+			section += 1
+			continue
+
+		if section != 1 or not line:
+			continue
+
+		name, length, utf8 = [f.strip() for f in line.split(b',', 2)]
+		utf8 = bytes(int(utf8[i + 2:i + 4], 16) for i in range(1, len(utf8) - 1, 4))
+
+		if len(utf8) != int(length):
+			sys.exit('%s: bad length for %s' % (path, name.decode()))
+
+		entities.append((name, utf8))
+
+	return sorted(entities)
+
+
+def build(entities):
+	"""displacement of every bucket, entity of every slot"""
+	buckets = [[] for _ in range(BUCKETS)]
+	disp = [0] * BUCKETS
+	slots = [EMPTY] * SLOTS
+
+	for i, (name, _) in enumerate(entities):
+		buckets[fnv(name) % BUCKETS].append(i)
+
+	# the fullest buckets are placed first, while the table is empty
+	for b in sorted(range(BUCKETS), key=lambda b: -len(buckets[b])):
+		if not buckets[b]:
+			continue
+
+		d = 0
+		while True:
+			idx = [mix(fnv(entities[i][0]) ^ d) & (SLOTS - 1) for i in buckets[b]]
+			if len(set(idx)) == len(idx) and all(slots[x] == EMPTY for x in idx):
+				break
+			d += 1
+			if d > EMPTY:
+				sys.exit('no displacement for bucket %d' % b)
+
+		for x, i in zip(idx, buckets[b]):
+			slots[x] = i
+		disp[b] = d
+
+	return disp, slots
+
+
+def table(values):
+	return ''.join('\t' + ', '.join(str(v) for v in values[r:r + 16]) + ',\n'
+		for r in range(0, len(values), 16))
+
+
+def main():
+	entities = parse(sys.argv[1] if len(sys.argv) > 1 else 'html_entities.gperf')
+	disp, slots = build(entities)
+	w = sys.stdout.write
+
+	w('/*\n'
+	  ' * HTML5 named character references, from the WHATWG list (the ones\n'
+	  ' * terminated by \';\'). Generated by html_entities.py from\n'
+	  ' * html_entities.gperf with `make html_entities`: do not edit.\n'
+	  ' */\n\n')
+
+	w('#define HTML_ENTITY_COUNT %d\n' % len(entities))
+	w('#define HTML_ENTITY_MAX_LENGTH %d\n\n' % max(len(n) for n, _ in entities))
+
+	w('struct html_ent {\n'
+	  '\tconst char *entity;\n'
+	  '\tunsigned char utf8_len;\n'
+	  '\tconst char *utf8;\n'
+	  '};\n\n')
+
+	w('static const struct html_ent html_entities[HTML_ENTITY_COUNT] = {\n')
+	for name, utf8 in entities:
+		w('\t{ "%s", %d, "%s" },\n' % (name.decode(), len(utf8),
+			''.join('\\x%02X' % c for c in utf8)))
+	w('};\n\n')
+
+	w('/* bucket displacements, indexed by hash %% %d */\n' % BUCKETS)
+	w('static const unsigned short html_entity_disp[%d] = {\n' % BUCKETS)
+	w(table(disp))
+	w('};\n\n')
+
+	w('/* slot -> entity, 0xffff when empty */\n')
+	w('static const unsigned short html_entity_slots[%d] = {\n' % SLOTS)
+	w(table(slots))
+	w('};\n\n')
+
+	w('''static inline unsigned int
+hash_entity(const char *str, size_t len)
+{
+	unsigned int h = 2166136261u;
+	size_t i;
+
+	for (i = 0; i < len; ++i) {
+		h ^= (unsigned char)str[i];
+		h *= 16777619u;
+	}
+
+	return h;
+}
+
+static inline unsigned int
+mix_entity(unsigned int h)
+{
+	h ^= h >> 16;
+	h *= 0x85ebca6bu;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35u;
+	h ^= h >> 16;
+	return h;
+}
+
+/* find_entity • the entity named str[0..len) (no '&' or ';'), or NULL */
+static const struct html_ent *
+find_entity(const char *str, size_t len)
+{
+	const struct html_ent *ent;
+	unsigned int h, slot;
+
+	if (len == 0 || len > HTML_ENTITY_MAX_LENGTH)
+		return NULL;
+
+	h = hash_entity(str, len);
+	slot = html_entity_slots[mix_entity(h ^ html_entity_disp[h %% %d]) & %d];
+
+	if (slot == 0xffff)
+		return NULL;
+
+	ent = &html_entities[slot];
+	if (strncmp(ent->entity, str, len) != 0 || ent->entity[len] != '\\0')
+		return NULL;
+
+	return ent;
+}
+''' % (BUCKETS, SLOTS - 1))
+
+
+if __name__ == '__main__':
+	main()
@@ -16,11 +16,11 @@
 
 #include "buffer.h"
 #include "autolink.h"
+#include "chartype.h"
 
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
-#include <ctype.h>
 
 #if defined(_WIN32)
 #define strncasecmp	_strnicmp
@@ -29,23 +29,43 @@
 int
 sd_autolink_issafe(const uint8_t *link, size_t link_len)
 {
-	static const size_t valid_uris_count = 5;
-	static const char *valid_uris[] = {
-		"/", "http://", "https://", "ftp://", "mailto:"
-	};
+	const char *prefix;
+	size_t len;
 
-	size_t i;
+	if (link_len == 0)
+		return 0;
+
+	/* the first byte picks the only prefix that can match */
+	switch (link[0]) {
+	case '/':
+		prefix = "/";
+		break;
 
-	for (i = 0; i < valid_uris_count; ++i) {
-		size_t len = strlen(valid_uris[i]);
+	case 'h':
+	case 'H':
+		prefix = (link_len > 4 && (link[4] == 's' || link[4] == 'S')) ?
+			"https://" : "http://";
+		break;
 
-		if (link_len > len &&
-			strncasecmp((char *)link, valid_uris[i], len) == 0 &&
-			isalnum(link[len]))
-			return 1;
+	case 'f':
+	case 'F':
+		prefix = "ftp://";
+		break;
+
+	case 'm':
+	case 'M':
+		prefix = "mailto:";
+		break;
+
+	default:
+		return 0;
 	}
 
-	return 0;
+	len = strlen(prefix);
+
+	return link_len > len &&
+		strncasecmp((char *)link, prefix, len) == 0 &&
+		sd_isalnum(link[len]);
 }
 
 static size_t
@@ -67,7 +87,7 @@ autolink_delim(uint8_t *data, size_t link_end, size_t max_rewind, size_t size)
 		else if (data[link_end - 1] == ';') {
 			size_t new_end = link_end - 2;
 
-			while (new_end > 0 && isalpha(data[new_end]))
+			while (new_end > 0 && sd_isalpha(data[new_end]))
 				new_end--;
 
 			if (new_end < link_end - 2 && data[new_end] == '&')
@@ -137,12 +157,12 @@ check_domain(uint8_t *data, size_t size, int allow_short)
 {
 	size_t i, np = 0;
 
-	if (!isalnum(data[0]))
+	if (!sd_isalnum(data[0]))
 		return 0;
 
 	for (i = 1; i < size - 1; ++i) {
 		if (data[i] == '.') np++;
-		else if (!isalnum(data[i]) && data[i] != '-') break;
+		else if (!sd_isalnum(data[i]) && data[i] != '-') break;
 	}
 
 	if (allow_short) {
@@ -169,7 +189,7 @@ sd_autolink__www(
 {
 	size_t link_end;
 
-	if (max_rewind > 0 && !ispunct(data[-1]) && !isspace(data[-1]))
+	if (max_rewind > 0 && !sd_ispunct(data[-1]) && !sd_isspace(data[-1]))
 		return 0;
 
 	if (size < 4 || memcmp(data, "www.", strlen("www.")) != 0)
@@ -180,7 +200,7 @@ sd_autolink__www(
 	if (link_end == 0)
 		return 0;
 
-	while (link_end < size && !isspace(data[link_end]))
+	while (link_end < size && !sd_isspace(data[link_end]))
 		link_end++;
 
 	link_end = autolink_delim(data, link_end, max_rewind, size);
@@ -209,7 +229,7 @@ sd_autolink__email(
 	for (rewind = 0; rewind < max_rewind; ++rewind) {
 		uint8_t c = data[-rewind - 1];
 
-		if (isalnum(c))
+		if (sd_isalnum(c))
 			continue;
 
 		if (strchr(".+-_", c) != NULL)
@@ -224,7 +244,7 @@ sd_autolink__email(
 	for (link_end = 0; link_end < size; ++link_end) {
 		uint8_t c = data[link_end];
 
-		if (isalnum(c))
+		if (sd_isalnum(c))
 			continue;
 
 		if (c == '@')
@@ -236,7 +256,7 @@ sd_autolink__email(
 	}
 
 	if (link_end < 2 || nb != 1 || np == 0 ||
-		!isalpha(data[link_end - 1]))
+		!sd_isalpha(data[link_end - 1]))
 		return 0;
 
 	link_end = autolink_delim(data, link_end, max_rewind, size);
@@ -264,7 +284,7 @@ sd_autolink__url(
 	if (size < 4 || data[1] != '/' || data[2] != '/')
 		return 0;
 
-	while (rewind < max_rewind && isalpha(data[-rewind - 1]))
+	while (rewind < max_rewind && sd_isalpha(data[-rewind - 1]))
 		rewind++;
 
 	if (!sd_autolink_issafe(data - rewind, size + rewind))
@@ -281,7 +301,7 @@ sd_autolink__url(
 		return 0;
 
 	link_end += domain_len;
-	while (link_end < size && !isspace(data[link_end]))
+	while (link_end < size && !sd_isspace(data[link_end]))
 		link_end++;
 
 	link_end = autolink_delim(data, link_end, max_rewind, size);
@@ -0,0 +1,74 @@
+#ifndef UPSKIRT_CHARTYPE_H
+#define UPSKIRT_CHARTYPE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* character classes of the C locale, fixed at compile time so the output
+ * does not depend on the host application's setlocale() */
+enum sd_ctype {
+	SD_CT_SPACE = (1 << 0),	/* ' ', \t, \n, \v, \f, \r */
+	SD_CT_DIGIT = (1 << 1),
+	SD_CT_XDIGIT = (1 << 2),
+	SD_CT_UPPER = (1 << 3),
+	SD_CT_LOWER = (1 << 4),
+	SD_CT_PUNCT = (1 << 5),
+};
+
+extern const uint8_t sd_ctype_table[256];
+
+#define SD_CT_ALPHA (SD_CT_UPPER | SD_CT_LOWER)
+#define SD_CT_ALNUM (SD_CT_ALPHA | SD_CT_DIGIT)
+
+static inline int
+sd_isspace(uint8_t c)
+{
+	return sd_ctype_table[c] & SD_CT_SPACE;
+}
+
+static inline int
+sd_isdigit(uint8_t c)
+{
+	return sd_ctype_table[c] & SD_CT_DIGIT;
+}
+
+static inline int
+sd_isxdigit(uint8_t c)
+{
+	return sd_ctype_table[c] & SD_CT_XDIGIT;
+}
+
+static inline int
+sd_isalpha(uint8_t c)
+{
+	return sd_ctype_table[c] & SD_CT_ALPHA;
+}
+
+static inline int
+sd_isalnum(uint8_t c)
+{
+	return sd_ctype_table[c] & SD_CT_ALNUM;
+}
+
+static inline int
+sd_ispunct(uint8_t c)
+{
+	return sd_ctype_table[c] & SD_CT_PUNCT;
+}
+
+static inline uint8_t
+sd_tolower(uint8_t c)
+{
+	return (sd_ctype_table[c] & SD_CT_UPPER) ? (uint8_t)(c + ('a' - 'A')) : c;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/* vim: set filetype=c: */
@@ -19,10 +19,12 @@
 
 #include "markdown.h"
 #include "stack.h"
+#include "chartype.h"
+#include "scan.h"
+#include "timer.h"
 
 #include <assert.h>
 #include <string.h>
-#include <ctype.h>
 #include <stdio.h>
 
 #if defined(_WIN32)
@@ -34,6 +36,21 @@
 #define BUFFER_BLOCK 0
 #define BUFFER_SPAN 1
 
+/* default retention policy for the work buffer pools: pooled buffers
+ * holding more than this many bytes are released after every render */
+#define WORK_BUF_RETAIN (64 * 1024)
+#define WORK_BUF_TRIM_EVERY 1
+
+/* STAT_INC • bumps a render statistic, when they are being collected */
+#define STAT_INC(rndr, field) do { if ((rndr)->stats) (rndr)->stats->field++; } while (0)
+
+/* number of parser steps between two checks of the render budget */
+#define BUDGET_CHECK_EVERY 256
+
+/* bytes looked at by the long scans of the parser (emphasis, link text,
+ * HTML block end) between two checks of the deadline */
+#define BUDGET_SCAN_EVERY (64 * 1024)
+
 #define MKD_LI_END 8	/* internal list flag */
 
 #define gperf_case_strncmp(s1, s2, n) strncasecmp(s1, s2, n)
@@ -112,10 +129,36 @@ struct sd_markdown {
 
 	struct link_ref *refs[REF_TABLE_SIZE];
 	uint8_t active_char[256];
+	struct sd_charset active_set;
+	uint8_t plain_char[256];
+	struct sd_charset plain_set;
 	struct stack work_bufs[2];
 	unsigned int ext_flags;
 	size_t max_nesting;
 	int in_link_body;
+
+	size_t max_retained;
+	unsigned int trim_every;
+	unsigned int renders;
+
+	struct sd_budget budget;
+	size_t budget_tick;
+	size_t budget_chunk;
+	size_t steps;
+	size_t scanned;
+	uint64_t deadline;
+	struct buf *ob_root;
+	size_t ob_start;
+	int truncated;
+
+	struct sd_render_stats *stats;
+
+	struct sd_block_cache *cache;
+	uint64_t cache_key;		/* extensions, callbacks and renderer flags, hashed */
+	struct buf *cache_refs;	/* ids of the references a cached block looked up */
+	int cache_record;
+
+	struct extract *extract;	/* set by sd_markdown_extract_links and sd_markdown_outline */
 };
 
 /***************************
@@ -136,8 +179,12 @@ rndr_newbuf(struct sd_markdown *rndr, int type)
 	} else {
 		work = bufnew(buf_size[type]);
 		stack_push(pool, work);
+		STAT_INC(rndr, allocs);
 	}
 
+	if (rndr->stats && pool->size > rndr->stats->peak_bufs[type])
+		rndr->stats->peak_bufs[type] = pool->size;
+
 	return work;
 }
 
@@ -147,6 +194,114 @@ rndr_popbuf(struct sd_markdown *rndr, int type)
 	rndr->work_bufs[type].size--;
 }
 
+/* stats_nesting • records the nesting depth reached */
+static inline void
+stats_nesting(struct sd_markdown *rndr)
+{
+	size_t depth;
+
+	if (!rndr->stats)
+		return;
+
+	depth = rndr->work_bufs[BUFFER_SPAN].size + rndr->work_bufs[BUFFER_BLOCK].size;
+	if (depth > rndr->stats->max_nesting)
+		rndr->stats->max_nesting = depth;
+}
+
+/* budget_output • bytes written so far: the output, and the work
+ * buffers of the blocks and spans still open, which are only appended to
+ * the output once they close. The work buffers of list items also hold
+ * their source, so this may count more than was written */
+static size_t
+budget_output(struct sd_markdown *rndr)
+{
+	size_t total = rndr->ob_root->size - rndr->ob_start;
+	size_t i, type;
+
+	for (type = 0; type < 2; ++type) {
+		struct stack *pool = &rndr->work_bufs[type];
+
+		for (i = 0; i < pool->size; ++i)
+			total += ((struct buf *)pool->item[i])->size;
+	}
+
+	return total;
+}
+
+/* budget_refill • slow path of the budget check, run every few steps */
+static int
+budget_refill(struct sd_markdown *rndr)
+{
+	struct sd_budget *budget = &rndr->budget;
+
+	rndr->steps += rndr->budget_chunk;
+	rndr->budget_chunk = BUDGET_CHECK_EVERY;
+
+	if (budget->max_steps) {
+		if (rndr->steps >= budget->max_steps)
+			rndr->truncated = 1;
+		else if (budget->max_steps - rndr->steps < BUDGET_CHECK_EVERY)
+			rndr->budget_chunk = budget->max_steps - rndr->steps;
+	}
+
+	if (budget->max_output && budget_output(rndr) >= budget->max_output)
+		rndr->truncated = 1;
+
+	if (rndr->deadline && sd_timer_ns() >= rndr->deadline)
+		rndr->truncated = 1;
+
+	rndr->budget_tick = rndr->budget_chunk;
+	return rndr->truncated;
+}
+
+/* budget_exhausted • accounts for one parser step, returns whether the
+ * render has run out of budget */
+static inline int
+budget_exhausted(struct sd_markdown *rndr)
+{
+	if (rndr->truncated)
+		return 1;
+
+	if (--rndr->budget_tick)
+		return 0;
+
+	return budget_refill(rndr);
+}
+
+/* budget_scanned • accounts for a scan of `len` bytes, returns whether
+ * the render has run out of budget. A single step may scan the rest of
+ * the document, so the deadline is also checked every few scanned bytes */
+static inline int
+budget_scanned(struct sd_markdown *rndr, size_t len)
+{
+	if (!rndr->deadline || rndr->truncated)
+		return rndr->truncated;
+
+	rndr->scanned += len;
+	if (rndr->scanned < BUDGET_SCAN_EVERY)
+		return 0;
+
+	rndr->scanned = 0;
+	if (sd_timer_ns() >= rndr->deadline)
+		rndr->truncated = 1;
+
+	return rndr->truncated;
+}
+
+/* pool_trim • releases the data of every pooled buffer above max_size */
+static void
+pool_trim(struct stack *pool, size_t max_size)
+{
+	size_t i;
+
+	for (i = 0; i < pool->asize; ++i) {
+		struct buf *work = pool->item[i];
+
+		if (work && work->asize > max_size)
+			bufreset(work);
+	}
+}
+
 static void
 unscape_text(struct buf *ob, struct buf *src)
 {
@@ -174,7 +329,7 @@ hash_link_ref(const uint8_t *link_ref, size_t length)
 	unsigned int hash = 0;
 
 	for (i = 0; i < length; ++i)
-		hash = tolower(link_ref[i]) + (hash << 6) + (hash << 16) - hash;
+		hash = sd_tolower(link_ref[i]) + (hash << 6) + (hash << 16) - hash;
 
 	return hash;
 }
@@ -197,9 +352,8 @@ add_link_ref(
 }
 
 static struct link_ref *
-find_link_ref(struct link_ref **references, uint8_t *name, size_t length)
+find_link_ref_id(struct link_ref **references, unsigned int hash)
 {
-	unsigned int hash = hash_link_ref(name, length);
 	struct link_ref *ref = NULL;
 
 	ref = references[hash % REF_TABLE_SIZE];
@@ -214,6 +368,27 @@ find_link_ref(struct link_ref **references, uint8_t *name, size_t length)
 	return NULL;
 }
 
+static struct link_ref *
+find_link_ref(struct link_ref **references, uint8_t *name, size_t length)
+{
+	return find_link_ref_id(references, hash_link_ref(name, length));
+}
+
+/* note_link_ref • records, once, the id of a reference looked up while
+ * a block is rendered for the block cache */
+static void
+note_link_ref(struct sd_markdown *rndr, unsigned int id)
+{
+	struct buf *ids = rndr->cache_refs;
+	size_t i;
+
+	for (i = 0; i + sizeof(id) <= ids->size; i += sizeof(id))
+		if (memcmp(ids->data + i, &id, sizeof(id)) == 0)
+			return;
+
+	bufput(ids, &id, sizeof(id));
+}
+
 static void
 free_link_refs(struct link_ref **references)
 {
@@ -263,7 +438,7 @@ is_mail_autolink(uint8_t *data, size_t size)
 
 	/* address is assumed to be: [-@._a-zA-Z0-9]+ with exactly one '@' */
 	for (i = 0; i < size; ++i) {
-		if (isalnum(data[i]))
+		if (sd_isalnum(data[i]))
 			continue;
 
 		switch (data[i]) {
@@ -299,14 +474,14 @@ tag_length(uint8_t *data, size_t size, enum mkd_autolink *autolink)
 	if (data[0] != '<') return 0;
 	i = (data[1] == '/') ? 2 : 1;
 
-	if (!isalnum(data[i]))
+	if (!sd_isalnum(data[i]))
 		return 0;
 
 	/* scheme test */
 	*autolink = MKDA_NOT_AUTOLINK;
 
 	/* try to find the beginning of an URI */
-	while (i < size && (isalnum(data[i]) || data[i] == '.' || data[i] == '+' || data[i] == '-'))
+	while (i < size && (sd_isalnum(data[i]) || data[i] == '.' || data[i] == '+' || data[i] == '-'))
 		i++;
 
 	if (i > 1 && data[i] == '@') {
@@ -348,6 +523,30 @@ tag_length(uint8_t *data, size_t size, enum mkd_autolink *autolink)
 	return i + 1;
 }
 
+/* autolink_candidate • cheap shape check run before an autolink trigger
+ * flushes the text and calls its handler: 'w', ':' and '@' are common in
+ * prose and rarely start a link. Mirrors the first tests of sd_autolink__* */
+static inline int
+autolink_candidate(uint8_t action, const uint8_t *data, size_t offset, size_t size)
+{
+	switch (action) {
+	case MD_CHAR_AUTOLINK_WWW:
+		if (offset > 0 && !sd_ispunct(data[-1]) && !sd_isspace(data[-1]))
+			return 0;
+		return size >= 4 && memcmp(data, "www.", 4) == 0;
+
+	case MD_CHAR_AUTOLINK_EMAIL:
+		return offset > 0 &&
+			(sd_isalnum(data[-1]) || strchr(".+-_", data[-1]) != NULL);
+
+	case MD_CHAR_AUTOLINK_URL:
+		return size >= 4 && data[1] == '/' && data[2] == '/';
+
+	default:
+		return 1;
+	}
+}
+
 /* parse_inline • parses inline markdown elements */
 static void
 parse_inline(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
@@ -355,17 +554,33 @@ parse_inline(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t siz
 	size_t i = 0, end = 0;
 	uint8_t action = 0;
 	struct buf work = { 0, 0, 0, 0 };
+	int out_of_budget;
 
 	if (rndr->work_bufs[BUFFER_SPAN].size +
 		rndr->work_bufs[BUFFER_BLOCK].size > rndr->max_nesting)
 		return;
 
+	stats_nesting(rndr);
+
 	while (i < size) {
 		/* copying inactive chars into the output */
-		while (end < size && (action = rndr->active_char[data[end]]) == 0) {
+		for (;;) {
+			end += sd_scan(data + end, size - end, &rndr->active_set);
+			if (end >= size)
+				break;
+
+			action = rndr->active_char[data[end]];
+			if (action < MD_CHAR_AUTOLINK_URL || action > MD_CHAR_AUTOLINK_WWW ||
+				autolink_candidate(action, data + end, end, size - end))
+				break;
+
 			end++;
 		}
 
+		/* out of budget: the text before the next trigger is still
+		 * written, the rest of the span is dropped */
+		out_of_budget = end < size && budget_exhausted(rndr);
+
 		if (rndr->cb.normal_text) {
 			work.data = data + i;
 			work.size = end - i;
@@ -374,12 +589,21 @@ parse_inline(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t siz
 		else
 			bufput(ob, data + i, end - i);
 
-		if (end >= size) break;
+		if (end >= size || out_of_budget) break;
 		i = end;
 
 		end = markdown_char_ptrs[(int)action](ob, rndr, data + i, i, size - i);
-		if (!end) /* no action from the callback */
+
+		if (rndr->stats) {
+			rndr->stats->triggers[action - 1]++;
+			if (!end)
+				rndr->stats->wasted[action - 1]++;
+		}
+		if (!end) { /* no action from the callback */
+			if (rndr->truncated)
+				break;
 			end = i + 1;
+		}
 		else {
 			i += end;
 			end = i;
@@ -478,6 +702,16 @@ find_emph_char(uint8_t *data, size_t size, uint8_t c)
 	return 0;
 }
 
+/* emph_scan • find_emph_char, charging the bytes it looked at to the
+ * budget; finds nothing once the budget has run out */
+static size_t
+emph_scan(struct sd_markdown *rndr, uint8_t *data, size_t size, uint8_t c)
+{
+	size_t len = find_emph_char(data, size, c);
+
+	return budget_scanned(rndr, len ? len : size) ? 0 : len;
+}
+
 /* parse_emph1 • parsing single emphase */
 /* closed by a symbol not preceded by whitespace and not followed by symbol */
 static size_t
@@ -493,7 +727,7 @@ parse_emph1(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 	if (size > 1 && data[0] == c && data[1] == c) i = 1;
 
 	while (i < size) {
-		len = find_emph_char(data + i, size - i, c);
+		len = emph_scan(rndr, data + i, size - i, c);
 		if (!len) return 0;
 		i += len;
 		if (i >= size) return 0;
@@ -501,7 +735,7 @@ parse_emph1(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 		if (data[i] == c && !_isspace(data[i - 1])) {
 
 			if (rndr->ext_flags & MKDEXT_NO_INTRA_EMPHASIS) {
-				if (i + 1 < size && isalnum(data[i + 1]))
+				if (i + 1 < size && sd_isalnum(data[i + 1]))
 					continue;
 			}
 
@@ -531,7 +765,7 @@ parse_emph2(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 		return 0;
 
 	while (i < size) {
-		len = find_emph_char(data + i, size - i, c);
+		len = emph_scan(rndr, data + i, size - i, c);
 		if (!len) return 0;
 		i += len;
 
@@ -556,7 +790,7 @@ parse_emph3(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size
 	int r;
 
 	while (i < size) {
-		len = find_emph_char(data + i, size - i, c);
+		len = emph_scan(rndr, data + i, size - i, c);
 		if (!len) return 0;
 		i += len;
 
@@ -721,7 +955,7 @@ char_entity(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offs
 	if (end < size && data[end] == '#')
 		end++;
 
-	while (end < size && isalnum(data[end]))
+	while (end < size && sd_isalnum(data[end]))
 		end++;
 
 	if (end < size && data[end] == ';')
@@ -837,23 +1071,23 @@ char_autolink_url(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_
 	return link_len;
 }
 
-/* char_link • '[': parsing a link or an image */
+/* find_link • looks for the end of the link or image whose text starts
+ * at data[0] ('['); the text ends at *txt_e, `link` and `title` are the
+ * raw target and title, from the link itself or from its reference, and
+ * NULL when missing. Returns the length of the link, 0 if there is none.
+ * The target and title of an inline link, and the reference id of a text
+ * spanning lines, take span buffers, which the caller releases */
 static size_t
-char_link(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offset, size_t size)
+find_link(struct sd_markdown *rndr, uint8_t *data, size_t size,
+	size_t *txt_e, struct buf **link, struct buf **title)
 {
-	int is_img = (offset && data[-1] == '!'), level;
-	size_t i = 1, txt_e, link_b = 0, link_e = 0, title_b = 0, title_e = 0;
-	struct buf *content = 0;
-	struct buf *link = 0;
-	struct buf *title = 0;
-	struct buf *u_link = 0;
-	size_t org_work_size = rndr->work_bufs[BUFFER_SPAN].size;
-	int text_has_nl = 0, ret = 0;
+	size_t i = 1, link_b = 0, link_e = 0, title_b = 0, title_e = 0;
+	int text_has_nl = 0, level;
 	int in_title = 0, qtype = 0;
+	struct buf id = { 0, 0, 0, 0 };
+	struct link_ref *lr;
 
-	/* checking whether the correct renderer exists */
-	if ((is_img && !rndr->cb.image) || (!is_img && !rndr->cb.link))
-		goto cleanup;
+	*link = *title = NULL;
 
 	/* looking for the matching closing bracket */
 	for (level = 1; i < size; i++) {
@@ -873,10 +1107,10 @@ char_link(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offset
 		}
 	}
 
-	if (i >= size)
-		goto cleanup;
+	if (budget_scanned(rndr, i) || i >= size)
+		return 0;
 
-	txt_e = i;
+	*txt_e = i;
 	i++;
 
 	/* skip any amount of whitespace or newline */
@@ -902,7 +1136,7 @@ char_link(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offset
 			else i++;
 		}
 
-		if (i >= size) goto cleanup;
+		if (i >= size) return 0;
 		link_e = i;
 
 		/* looking for title end if present */
@@ -919,7 +1153,7 @@ char_link(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offset
 				else i++;
 			}
 
-			if (i >= size) goto cleanup;
+			if (i >= size) return 0;
 
 			/* skipping whitespaces after title */
 			title_e = i - 1;
@@ -943,100 +1177,93 @@ char_link(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offset
 
 		/* building escaped link and title */
 		if (link_e > link_b) {
-			link = rndr_newbuf(rndr, BUFFER_SPAN);
-			bufput(link, data + link_b, link_e - link_b);
+			*link = rndr_newbuf(rndr, BUFFER_SPAN);
+			bufput(*link, data + link_b, link_e - link_b);
 		}
 
 		if (title_e > title_b) {
-			title = rndr_newbuf(rndr, BUFFER_SPAN);
-			bufput(title, data + title_b, title_e - title_b);
+			*title = rndr_newbuf(rndr, BUFFER_SPAN);
+			bufput(*title, data + title_b, title_e - title_b);
 		}
 
-		i++;
+		return i + 1;
 	}
 
 	/* reference style link */
-	else if (i < size && data[i] == '[') {
-		struct buf id = { 0, 0, 0, 0 };
-		struct link_ref *lr;
-
+	if (i < size && data[i] == '[') {
 		/* looking for the id */
 		i++;
 		link_b = i;
 		while (i < size && data[i] != ']') i++;
-		if (i >= size) goto cleanup;
+		if (i >= size) return 0;
 		link_e = i;
+		i++;
+	}
 
-		/* finding the link_ref */
-		if (link_b == link_e) {
-			if (text_has_nl) {
-				struct buf *b = rndr_newbuf(rndr, BUFFER_SPAN);
-				size_t j;
-
-				for (j = 1; j < txt_e; j++) {
-					if (data[j] != '\n')
-						bufputc(b, data[j]);
-					else if (data[j - 1] != ' ')
-						bufputc(b, ' ');
-				}
+	/* shortcut reference style link: rewinding the whitespace */
+	else {
+		link_b = link_e = 0;
+		i = *txt_e + 1;
+	}
 
-				id.data = b->data;
-				id.size = b->size;
-			} else {
-				id.data = data + 1;
-				id.size = txt_e - 1;
-			}
-		} else {
-			id.data = data + link_b;
-			id.size = link_e - link_b;
+	/* crafting the id */
+	if (link_b < link_e) {
+		id.data = data + link_b;
+		id.size = link_e - link_b;
+	} else if (text_has_nl) {
+		struct buf *b = rndr_newbuf(rndr, BUFFER_SPAN);
+		size_t j;
+
+		for (j = 1; j < *txt_e; j++) {
+			if (data[j] != '\n')
+				bufputc(b, data[j]);
+			else if (data[j - 1] != ' ')
+				bufputc(b, ' ');
 		}
 
-		lr = find_link_ref(rndr->refs, id.data, id.size);
-		if (!lr)
-			goto cleanup;
-
-		/* keeping link and title from link_ref */
-		link = lr->link;
-		title = lr->title;
-		i++;
+		id.data = b->data;
+		id.size = b->size;
+	} else {
+		id.data = data + 1;
+		id.size = *txt_e - 1;
 	}
 
-	/* shortcut reference style link */
-	else {
-		struct buf id = { 0, 0, 0, 0 };
-		struct link_ref *lr;
-
-		/* crafting the id */
-		if (text_has_nl) {
-			struct buf *b = rndr_newbuf(rndr, BUFFER_SPAN);
-			size_t j;
-
-			for (j = 1; j < txt_e; j++) {
-				if (data[j] != '\n')
-					bufputc(b, data[j]);
-				else if (data[j - 1] != ' ')
-					bufputc(b, ' ');
-			}
+	/* finding the link_ref */
+	lr = find_link_ref(rndr->refs, id.data, id.size);
 
-			id.data = b->data;
-			id.size = b->size;
-		} else {
-			id.data = data + 1;
-			id.size = txt_e - 1;
-		}
+	if (rndr->cache_record)
+		note_link_ref(rndr, hash_link_ref(id.data, id.size));
 
-		/* finding the link_ref */
-		lr = find_link_ref(rndr->refs, id.data, id.size);
-		if (!lr)
-			goto cleanup;
+	if (!lr)
+		return 0;
 
-		/* keeping link and title from link_ref */
-		link = lr->link;
-		title = lr->title;
+	/* keeping link and title from link_ref */
+	*link = lr->link;
+	*title = lr->title;
 
-		/* rewinding the whitespace */
-		i = txt_e + 1;
-	}
+	return i;
+}
+
+/* char_link • '[': parsing a link or an image */
+static size_t
+char_link(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t offset, size_t size)
+{
+	int is_img = (offset && data[-1] == '!');
+	size_t i, txt_e;
+	struct buf *link = 0;
+	struct buf *title = 0;
+	struct buf *content = 0;
+	struct buf *u_link = 0;
+	size_t org_work_size = rndr->work_bufs[BUFFER_SPAN].size;
+	int ret = 0;
+
+	/* checking whether the correct renderer exists */
+	if ((is_img && !rndr->cb.image) || (!is_img && !rndr->cb.link))
+		return 0;
+
+	i = find_link(rndr, data, size, &txt_e, &link, &title);
+	if (!i)
+		goto cleanup;
 
 	/* building content: img alt is escaped, link content is parsed */
 	if (txt_e > 1) {
@@ -1382,6 +1609,16 @@ prefix_uli(uint8_t *data, size_t size)
 static void parse_block(struct buf *ob, struct sd_markdown *rndr,
 			uint8_t *data, size_t size);
 
+/* hooks of sd_markdown_extract_links and sd_markdown_outline, called by
+ * the block parsers when md->extract is set */
+static void extract_open(struct sd_markdown *rndr);
+static void extract_chunk(struct sd_markdown *rndr, size_t work, const uint8_t *src);
+static void extract_enter(struct sd_markdown *rndr, const uint8_t *data, size_t size);
+static void extract_close(struct sd_markdown *rndr);
+static void extract_text(struct sd_markdown *rndr, uint8_t *data, size_t size);
+static void extract_header(struct sd_markdown *rndr, const struct buf *text, int level,
+			const uint8_t *src, size_t src_size);
+
 
 /* parse_blockquote • handles parsing of a blockquote fragment */
 static size_t
@@ -1392,6 +1629,9 @@ parse_blockquote(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 	struct buf *out = 0;
 
 	out = rndr_newbuf(rndr, BUFFER_BLOCK);
+	if (rndr->extract)
+		extract_open(rndr);
+
 	beg = 0;
 	while (beg < size) {
 		for (end = beg + 1; end < size && data[end - 1] != '\n'; end++);
@@ -1409,6 +1649,9 @@ parse_blockquote(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 
 		if (beg < end) { /* copy into the in-place working buffer */
 			/* bufput(work, data + beg, end - beg); */
+			if (rndr->extract)
+				extract_chunk(rndr, work_size, data + beg);
+
 			if (!work_data)
 				work_data = data + beg;
 			else if (data + beg != work_data + work_size)
@@ -1418,7 +1661,15 @@ parse_blockquote(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 		beg = end;
 	}
 
+	if (rndr->extract)
+		extract_enter(rndr, work_data, work_size);
+
 	parse_block(out, rndr, work_data, work_size);
+
+	if (rndr->extract)
+		extract_close(rndr);
+
+	STAT_INC(rndr, blocks[MKDB_BLOCKQUOTE]);
 	if (rndr->cb.blockquote)
 		rndr->cb.blockquote(ob, out, rndr->opaque);
 	rndr_popbuf(rndr, BUFFER_BLOCK);
@@ -1461,7 +1712,7 @@ parse_paragraph(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 		 * let's check to see if there's some kind of block starting
 		 * here
 		 */
-		if ((rndr->ext_flags & MKDEXT_LAX_SPACING) && !isalnum(data[i])) {
+		if ((rndr->ext_flags & MKDEXT_LAX_SPACING) && !sd_isalnum(data[i])) {
 			if (prefix_oli(data + i, size - i) ||
 				prefix_uli(data + i, size - i)) {
 				end = i;
@@ -1491,11 +1742,16 @@ parse_paragraph(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 		work.size--;
 
 	if (!level) {
-		struct buf *tmp = rndr_newbuf(rndr, BUFFER_BLOCK);
-		parse_inline(tmp, rndr, work.data, work.size);
-		if (rndr->cb.paragraph)
+		STAT_INC(rndr, blocks[MKDB_PARAGRAPH]);
+		if (rndr->extract)
+			extract_text(rndr, work.data, work.size);
+
+		if (rndr->cb.paragraph) {
+			struct buf *tmp = rndr_newbuf(rndr, BUFFER_BLOCK);
+			parse_inline(tmp, rndr, work.data, work.size);
 			rndr->cb.paragraph(ob, tmp, rndr->opaque);
-		rndr_popbuf(rndr, BUFFER_BLOCK);
+			rndr_popbuf(rndr, BUFFER_BLOCK);
+		}
 	} else {
 		struct buf *header_work;
 
@@ -1512,26 +1768,39 @@ parse_paragraph(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 				work.size -= 1;
 
 			if (work.size > 0) {
-				struct buf *tmp = rndr_newbuf(rndr, BUFFER_BLOCK);
-				parse_inline(tmp, rndr, work.data, work.size);
+				STAT_INC(rndr, blocks[MKDB_PARAGRAPH]);
+				if (rndr->extract)
+					extract_text(rndr, work.data, work.size);
 
-				if (rndr->cb.paragraph)
+				if (rndr->cb.paragraph) {
+					struct buf *tmp = rndr_newbuf(rndr, BUFFER_BLOCK);
+					parse_inline(tmp, rndr, work.data, work.size);
 					rndr->cb.paragraph(ob, tmp, rndr->opaque);
+					rndr_popbuf(rndr, BUFFER_BLOCK);
+				}
 
-				rndr_popbuf(rndr, BUFFER_BLOCK);
 				work.data += beg;
 				work.size = i - beg;
 			}
 			else work.size = i;
 		}
 
-		header_work = rndr_newbuf(rndr, BUFFER_SPAN);
-		parse_inline(header_work, rndr, work.data, work.size);
+		STAT_INC(rndr, blocks[MKDB_HEADER]);
+		if (rndr->extract)
+			extract_text(rndr, work.data, work.size);
 
-		if (rndr->cb.header)
+		if (rndr->cb.header) {
+			header_work = rndr_newbuf(rndr, BUFFER_SPAN);
+			parse_inline(header_work, rndr, work.data, work.size);
 			rndr->cb.header(ob, header_work, (int)level, rndr->opaque);
 
-		rndr_popbuf(rndr, BUFFER_SPAN);
+			/* the header takes its line and the underline */
+			if (rndr->extract)
+				extract_header(rndr, header_work, (int)level, work.data,
+					end - (size_t)(work.data - data) - (data[end - 1] == '\n'));
+
+			rndr_popbuf(rndr, BUFFER_SPAN);
+		}
 	}
 
 	return end;
@@ -1562,7 +1831,8 @@ parse_fencedcode(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 
 		for (end = beg + 1; end < size && data[end - 1] != '\n'; end++);
 
-		if (beg < end) {
+		/* nothing to copy when nobody renders the code */
+		if (beg < end && rndr->cb.blockcode) {
 			/* verbatim copy to the working buffer,
 				escaping entities */
 			if (is_empty(data + beg, end - beg))
@@ -1575,6 +1845,7 @@ parse_fencedcode(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 	if (work->size && work->data[work->size - 1] != '\n')
 		bufputc(work, '\n');
 
+	STAT_INC(rndr, blocks[MKDB_BLOCKCODE]);
 	if (rndr->cb.blockcode)
 		rndr->cb.blockcode(ob, work, lang.size ? &lang : NULL, rndr->opaque);
 
@@ -1601,7 +1872,7 @@ parse_blockcode(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 			/* non-empty non-prefixed line breaks the pre */
 			break;
 
-		if (beg < end) {
+		if (beg < end && rndr->cb.blockcode) {
 			/* verbatim copy to the working buffer,
 				escaping entities */
 			if (is_empty(data + beg, end - beg))
@@ -1616,6 +1887,7 @@ parse_blockcode(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 
 	bufputc(work, '\n');
 
+	STAT_INC(rndr, blocks[MKDB_BLOCKCODE]);
 	if (rndr->cb.blockcode)
 		rndr->cb.blockcode(ob, work, NULL, rndr->opaque);
 
@@ -1652,6 +1924,11 @@ parse_listitem(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t s
 	work = rndr_newbuf(rndr, BUFFER_SPAN);
 	inter = rndr_newbuf(rndr, BUFFER_SPAN);
 
+	if (rndr->extract) {
+		extract_open(rndr);
+		extract_chunk(rndr, 0, data + beg);
+	}
+
 	/* putting the first line into the working buffer */
 	bufput(work, data + beg, end - beg);
 	beg = end;
@@ -1725,6 +2002,9 @@ parse_listitem(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t s
 		in_empty = 0;
 
 		/* adding the line without prefix into the working buffer */
+		if (rndr->extract)
+			extract_chunk(rndr, work->size, data + beg + i);
+
 		bufput(work, data + beg + i, end - beg - i);
 		beg = end;
 	}
@@ -1733,6 +2013,9 @@ parse_listitem(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t s
 	if (has_inside_empty)
 		*flags |= MKD_LI_BLOCK;
 
+	if (rndr->extract)
+		extract_enter(rndr, work->data, work->size);
+
 	if (*flags & MKD_LI_BLOCK) {
 		/* intermediate render of block li */
 		if (sublist && sublist < work->size) {
@@ -1742,16 +2025,28 @@ parse_listitem(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t s
 		else
 			parse_block(inter, rndr, work->data, work->size);
 	} else {
-		/* intermediate render of inline li */
+		/* intermediate render of inline li; the text is only
+		 * parsed for a listitem callback, the sublist always is */
 		if (sublist && sublist < work->size) {
-			parse_inline(inter, rndr, work->data, sublist);
+			if (rndr->extract)
+				extract_text(rndr, work->data, sublist);
+			if (rndr->cb.listitem)
+				parse_inline(inter, rndr, work->data, sublist);
 			parse_block(inter, rndr, work->data + sublist, work->size - sublist);
 		}
-		else
-			parse_inline(inter, rndr, work->data, work->size);
+		else {
+			if (rndr->extract)
+				extract_text(rndr, work->data, work->size);
+			if (rndr->cb.listitem)
+				parse_inline(inter, rndr, work->data, work->size);
+		}
 	}
 
+	if (rndr->extract)
+		extract_close(rndr);
+
 	/* render of li itself */
+	STAT_INC(rndr, blocks[MKDB_LISTITEM]);
 	if (rndr->cb.listitem)
 		rndr->cb.listitem(ob, inter, *flags, rndr->opaque);
 
@@ -1770,7 +2065,7 @@ parse_list(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size,
 
 	work = rndr_newbuf(rndr, BUFFER_BLOCK);
 
-	while (i < size) {
+	while (i < size && !rndr->truncated) {
 		j = parse_listitem(work, rndr, data + i, size - i, &flags);
 		i += j;
 
@@ -1778,6 +2073,7 @@ parse_list(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size,
 			break;
 	}
 
+	STAT_INC(rndr, blocks[MKDB_LIST]);
 	if (rndr->cb.list)
 		rndr->cb.list(ob, work, flags, rndr->opaque);
 	rndr_popbuf(rndr, BUFFER_BLOCK);
@@ -1806,14 +2102,20 @@ parse_atxheader(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 		end--;
 
 	if (end > i) {
-		struct buf *work = rndr_newbuf(rndr, BUFFER_SPAN);
+		STAT_INC(rndr, blocks[MKDB_HEADER]);
+		if (rndr->extract)
+			extract_text(rndr, data + i, end - i);
 
-		parse_inline(work, rndr, data + i, end - i);
-
-		if (rndr->cb.header)
+		if (rndr->cb.header) {
+			struct buf *work = rndr_newbuf(rndr, BUFFER_SPAN);
+			parse_inline(work, rndr, data + i, end - i);
 			rndr->cb.header(ob, work, (int)level, rndr->opaque);
 
-		rndr_popbuf(rndr, BUFFER_SPAN);
+			if (rndr->extract)
+				extract_header(rndr, work, (int)level, data, skip);
+
+			rndr_popbuf(rndr, BUFFER_SPAN);
+		}
 	}
 
 	return skip;
@@ -1964,12 +2266,15 @@ parse_htmlblock(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t
 
 	/* if not found, trying a second pass looking for indented match */
 	/* but not if tag is "ins" or "del" (following original Markdown.pl) */
-	if (!tag_end && strcmp(curtag, "ins") != 0 && strcmp(curtag, "del") != 0) {
+	if (!tag_end && strcmp(curtag, "ins") != 0 && strcmp(curtag, "del") != 0 &&
+		!budget_scanned(rndr, size)) {
 		tag_end = htmlblock_end(curtag, rndr, data, size, 0);
 	}
 
-	if (!tag_end)
+	if (!tag_end) {
+		budget_scanned(rndr, size);
 		return 0;
+	}
 
 	/* the end of the block has been found */
 	work.size = tag_end;
@@ -1992,7 +2297,7 @@ parse_table_row(
 	size_t i = 0, col;
 	struct buf *row_work = 0;
 
-	if (!rndr->cb.table_cell || !rndr->cb.table_row)
+	if (!rndr->cb.table || !rndr->cb.table_cell || !rndr->cb.table_row)
 		return;
 
 	row_work = rndr_newbuf(rndr, BUFFER_SPAN);
@@ -2004,8 +2309,6 @@ parse_table_row(
 		size_t cell_start, cell_end;
 		struct buf *cell_work;
 
-		cell_work = rndr_newbuf(rndr, BUFFER_SPAN);
-
 		while (i < size && _isspace(data[i]))
 			i++;
 
@@ -2019,19 +2322,28 @@ parse_table_row(
 		while (cell_end > cell_start && _isspace(data[cell_end]))
 			cell_end--;
 
-		parse_inline(cell_work, rndr, data + cell_start, 1 + cell_end - cell_start);
-		rndr->cb.table_cell(row_work, cell_work, col_data[col] | header_flag, rndr->opaque);
+		/* extraction only takes the source of the cell */
+		if (rndr->extract)
+			extract_text(rndr, data + cell_start, 1 + cell_end - cell_start);
+		else {
+			cell_work = rndr_newbuf(rndr, BUFFER_SPAN);
+			parse_inline(cell_work, rndr, data + cell_start, 1 + cell_end - cell_start);
+			rndr->cb.table_cell(row_work, cell_work, col_data[col] | header_flag, rndr->opaque);
+			rndr_popbuf(rndr, BUFFER_SPAN);
+		}
 
-		rndr_popbuf(rndr, BUFFER_SPAN);
+		STAT_INC(rndr, blocks[MKDB_TABLE_CELL]);
 		i++;
 	}
 
 	for (; col < columns; ++col) {
 		struct buf empty_cell = { 0, 0, 0, 0 };
 		rndr->cb.table_cell(row_work, &empty_cell, col_data[col] | header_flag, rndr->opaque);
+		STAT_INC(rndr, blocks[MKDB_TABLE_CELL]);
 	}
 
 	rndr->cb.table_row(ob, row_work, rndr->opaque);
+	STAT_INC(rndr, blocks[MKDB_TABLE_ROW]);
 
 	rndr_popbuf(rndr, BUFFER_SPAN);
 }
@@ -2173,6 +2485,7 @@ parse_table(
 			i++;
 		}
 
+		STAT_INC(rndr, blocks[MKDB_TABLE]);
 		if (rndr->cb.table)
 			rndr->cb.table(ob, header_work, body_work, rndr->opaque);
 	}
@@ -2183,85 +2496,481 @@ parse_table(
 	return i;
 }
 
-/* parse_block • parsing of one block, returning next uint8_t to parse */
+/* parse_block_at • parsing of the block starting at `data`, returning
+ * the number of bytes it takes; an hrule may take one past `size` */
+static size_t
+parse_block_at(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
+{
+	size_t i;
+
+	if (is_atxheader(rndr, data, size))
+		return parse_atxheader(ob, rndr, data, size);
+
+	if (data[0] == '<' && rndr->cb.blockhtml &&
+		(i = parse_htmlblock(ob, rndr, data, size, 1)) != 0) {
+		STAT_INC(rndr, blocks[MKDB_BLOCKHTML]);
+		return i;
+	}
+
+	if ((i = is_empty(data, size)) != 0)
+		return i;
+
+	if (is_hrule(data, size)) {
+		STAT_INC(rndr, blocks[MKDB_HRULE]);
+		if (rndr->cb.hrule)
+			rndr->cb.hrule(ob, rndr->opaque);
+
+		for (i = 0; i < size && data[i] != '\n'; i++);
+		return i + 1;
+	}
+
+	if ((rndr->ext_flags & MKDEXT_FENCED_CODE) != 0 &&
+		(i = parse_fencedcode(ob, rndr, data, size)) != 0)
+		return i;
+
+	if ((rndr->ext_flags & MKDEXT_TABLES) != 0 &&
+		(i = parse_table(ob, rndr, data, size)) != 0)
+		return i;
+
+	if (prefix_quote(data, size))
+		return parse_blockquote(ob, rndr, data, size);
+
+	if (prefix_code(data, size))
+		return parse_blockcode(ob, rndr, data, size);
+
+	if (prefix_uli(data, size))
+		return parse_list(ob, rndr, data, size, 0);
+
+	if (prefix_oli(data, size))
+		return parse_list(ob, rndr, data, size, MKD_LIST_ORDERED);
+
+	return parse_paragraph(ob, rndr, data, size);
+}
+
+/* parse_block • parsing of the blocks of `data` */
 static void
 parse_block(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
 {
-	size_t beg, end, i;
-	uint8_t *txt_data;
-	beg = 0;
+	size_t beg = 0;
 
 	if (rndr->work_bufs[BUFFER_SPAN].size +
 		rndr->work_bufs[BUFFER_BLOCK].size > rndr->max_nesting)
 		return;
 
+	stats_nesting(rndr);
+
 	while (beg < size) {
-		txt_data = data + beg;
-		end = size - beg;
+		if (budget_exhausted(rndr))
+			break;
 
-		if (is_atxheader(rndr, txt_data, end))
-			beg += parse_atxheader(ob, rndr, txt_data, end);
+		beg += parse_block_at(ob, rndr, data + beg, size - beg);
+	}
+}
 
-		else if (data[beg] == '<' && rndr->cb.blockhtml &&
-				(i = parse_htmlblock(ob, rndr, txt_data, end, 1)) != 0)
-			beg += i;
 
-		else if ((i = is_empty(txt_data, end)) != 0)
-			beg += i;
+/***************
+ * BLOCK CACHE *
+ ***************/
 
-		else if (is_hrule(txt_data, end)) {
-			if (rndr->cb.hrule)
-				rndr->cb.hrule(ob, rndr->opaque);
+#define CACHE_BUCKETS 64
+
+/* blocks shorter than this render faster than they are looked up */
+#define CACHE_MIN_BLOCK 128
+
+/* cache_entry • a rendered top-level block, followed in memory by the ids
+ * of the references it looked up, its source, its output and what the
+ * references resolved to */
+struct cache_entry {
+	uint64_t hash;			/* of the first two lines, with md->cache_key */
+	struct cache_entry *next;	/* in the same bucket */
+	struct cache_entry *newer;
+	struct cache_entry *older;
+
+	size_t src_size;		/* text taken by the block */
+	size_t cmp_size;		/* ... and by the lines that ended it */
+	int at_end;			/* those lines ran into the end of the text */
+	int prev;			/* last output byte before the block, 256 for none */
+	size_t out_size;
+	size_t ref_count;
+	size_t refs_size;
+	size_t bytes;			/* counted against the cap */
+};
 
-			while (beg < size && data[beg] != '\n')
-				beg++;
+struct sd_block_cache {
+	struct cache_entry **buckets;
+	size_t bucket_count;
+	struct cache_entry *newest;
+	struct cache_entry *oldest;
+	size_t max_bytes;
+	struct sd_block_cache_stats stats;
+};
 
-			beg++;
-		}
+#define ENTRY_IDS(e) ((unsigned int *)((e) + 1))
+#define ENTRY_SRC(e) ((uint8_t *)(ENTRY_IDS(e) + (e)->ref_count))
+#define ENTRY_OUT(e) (ENTRY_SRC(e) + (e)->cmp_size)
+#define ENTRY_REFS(e) (ENTRY_OUT(e) + (e)->out_size)
 
-		else if ((rndr->ext_flags & MKDEXT_FENCED_CODE) != 0 &&
-			(i = parse_fencedcode(ob, rndr, txt_data, end)) != 0)
-			beg += i;
+/* cache_hash • FNV-1a, carried on from `hash` */
+static uint64_t
+cache_hash(uint64_t hash, const uint8_t *data, size_t size)
+{
+	size_t i;
 
-		else if ((rndr->ext_flags & MKDEXT_TABLES) != 0 &&
-			(i = parse_table(ob, rndr, txt_data, end)) != 0)
-			beg += i;
+	for (i = 0; i < size; ++i) {
+		hash ^= data[i];
+		hash *= 1099511628211ULL;
+	}
 
-		else if (prefix_quote(txt_data, end))
-			beg += parse_blockquote(ob, rndr, txt_data, end);
+	return hash;
+}
 
-		else if (prefix_code(txt_data, end))
-			beg += parse_blockcode(ob, rndr, txt_data, end);
+/* cache_line_hash • the key of the block starting at `data`: its first
+ * two lines, which the compared text of an entry always holds, and
+ * everything of md its output depends on */
+static uint64_t
+cache_line_hash(struct sd_markdown *rndr, const uint8_t *data, size_t size)
+{
+	const uint8_t *end = memchr(data, '\n', size);
 
-		else if (prefix_uli(txt_data, end))
-			beg += parse_list(ob, rndr, txt_data, end, 0);
+	if (end && end + 1 < data + size)
+		end = memchr(end + 1, '\n', data + size - end - 1);
 
-		else if (prefix_oli(txt_data, end))
-			beg += parse_list(ob, rndr, txt_data, end, MKD_LIST_ORDERED);
+	return cache_hash(rndr->cache_key, data, end ? (size_t)(end - data) : size);
+}
 
-		else
-			beg += parse_paragraph(ob, rndr, txt_data, end);
+/* cache_resolve • what the references of `ids` resolve to in the current
+ * document, found or not, link and title */
+static void
+cache_resolve(struct buf *ob, struct sd_markdown *rndr, const unsigned int *ids, size_t count)
+{
+	struct link_ref *ref;
+	size_t i, size;
+
+	for (i = 0; i < count; ++i) {
+		ref = find_link_ref_id(rndr->refs, ids[i]);
+		bufputc(ob, ref ? 1 + (ref->title != NULL) : 0);
+
+		if (!ref)
+			continue;
+
+		size = ref->link ? ref->link->size : 0;
+		bufput(ob, &size, sizeof(size));
+		if (size)
+			bufput(ob, ref->link->data, size);
+
+		if (ref->title) {
+			bufput(ob, &ref->title->size, sizeof(size));
+			bufput(ob, ref->title->data, ref->title->size);
+		}
 	}
 }
 
+static void
+cache_unlink(struct sd_block_cache *cache, struct cache_entry *entry)
+{
+	struct cache_entry **slot = &cache->buckets[entry->hash & (cache->bucket_count - 1)];
 
+	while (*slot != entry)
+		slot = &(*slot)->next;
 
-/*********************
- * REFERENCE PARSING *
- *********************/
+	*slot = entry->next;
 
-/* is_ref • returns whether a line is a reference or not */
-static int
-is_ref(const uint8_t *data, size_t beg, size_t end, size_t *last, struct link_ref **refs)
-{
-/*	int n; */
-	size_t i = 0;
-	size_t id_offset, id_end;
-	size_t link_offset, link_end;
-	size_t title_offset, title_end;
-	size_t line_end;
+	if (entry->newer)
+		entry->newer->older = entry->older;
+	else
+		cache->newest = entry->older;
 
-	/* up to 3 optional leading spaces */
+	if (entry->older)
+		entry->older->newer = entry->newer;
+	else
+		cache->oldest = entry->newer;
+
+	cache->stats.entries--;
+	cache->stats.bytes -= entry->bytes;
+}
+
+/* cache_touch • makes `entry` the most recently used one */
+static void
+cache_touch(struct sd_block_cache *cache, struct cache_entry *entry)
+{
+	if (cache->newest == entry)
+		return;
+
+	entry->newer->older = entry->older;
+	if (entry->older)
+		entry->older->newer = entry->newer;
+	else
+		cache->oldest = entry->newer;
+
+	entry->newer = NULL;
+	entry->older = cache->newest;
+	cache->newest->newer = entry;
+	cache->newest = entry;
+}
+
+/* cache_rehash • doubles the bucket table once there are as many entries
+ * as buckets; without memory the chains just get longer */
+static void
+cache_rehash(struct sd_block_cache *cache)
+{
+	struct cache_entry **buckets, *entry, *next;
+	size_t i, count = cache->bucket_count * 2;
+
+	buckets = calloc(count, sizeof(struct cache_entry *));
+	if (!buckets)
+		return;
+
+	for (i = 0; i < cache->bucket_count; ++i)
+		for (entry = cache->buckets[i]; entry; entry = next) {
+			next = entry->next;
+			entry->next = buckets[entry->hash & (count - 1)];
+			buckets[entry->hash & (count - 1)] = entry;
+		}
+
+	free(cache->buckets);
+	cache->buckets = buckets;
+	cache->bucket_count = count;
+}
+
+/* cache_find • the entry for the block starting at `data`: same first
+ * line, same source up to the lines that ended it, same output byte
+ * before it (renderers separate blocks depending on it), and the
+ * references it used resolving as they did */
+static struct cache_entry *
+cache_find(struct sd_markdown *rndr, uint8_t *data, size_t size, uint64_t hash, int prev)
+{
+	struct sd_block_cache *cache = rndr->cache;
+	struct cache_entry *entry;
+	struct buf *refs;
+	int same;
+
+	for (entry = cache->buckets[hash & (cache->bucket_count - 1)]; entry; entry = entry->next) {
+		if (entry->hash != hash || entry->prev != prev || entry->cmp_size > size ||
+			(entry->at_end && entry->cmp_size != size) ||
+			memcmp(ENTRY_SRC(entry), data, entry->cmp_size) != 0)
+			continue;
+
+		if (!entry->ref_count)
+			return entry;
+
+		refs = rndr_newbuf(rndr, BUFFER_SPAN);
+		cache_resolve(refs, rndr, ENTRY_IDS(entry), entry->ref_count);
+		same = refs->size == entry->refs_size &&
+			memcmp(refs->data, ENTRY_REFS(entry), refs->size) == 0;
+		rndr_popbuf(rndr, BUFFER_SPAN);
+
+		if (same)
+			return entry;
+	}
+
+	return NULL;
+}
+
+/* cache_add • keeps the output of a block just rendered, dropping the
+ * least recently used blocks to make room */
+static void
+cache_add(struct sd_markdown *rndr, uint64_t hash, int prev, uint8_t *data,
+	size_t src_size, size_t cmp_size, int at_end, const uint8_t *out, size_t out_size)
+{
+	struct sd_block_cache *cache = rndr->cache;
+	struct cache_entry *entry;
+	struct buf *refs;
+	size_t ref_count = rndr->cache_refs->size / sizeof(unsigned int), bytes;
+
+	refs = rndr_newbuf(rndr, BUFFER_SPAN);
+	cache_resolve(refs, rndr, (unsigned int *)rndr->cache_refs->data, ref_count);
+
+	bytes = sizeof(struct cache_entry) + ref_count * sizeof(unsigned int) +
+		cmp_size + out_size + refs->size;
+
+	if (bytes > cache->max_bytes || (entry = malloc(bytes)) == NULL) {
+		rndr_popbuf(rndr, BUFFER_SPAN);
+		return;
+	}
+
+	entry->hash = hash;
+	entry->src_size = src_size;
+	entry->cmp_size = cmp_size;
+	entry->at_end = at_end;
+	entry->prev = prev;
+	entry->out_size = out_size;
+	entry->ref_count = ref_count;
+	entry->refs_size = refs->size;
+	entry->bytes = bytes;
+
+	if (ref_count) {
+		memcpy(ENTRY_IDS(entry), rndr->cache_refs->data, ref_count * sizeof(unsigned int));
+		memcpy(ENTRY_REFS(entry), refs->data, refs->size);
+	}
+
+	memcpy(ENTRY_SRC(entry), data, cmp_size);
+	if (out_size)
+		memcpy(ENTRY_OUT(entry), out, out_size);
+	rndr_popbuf(rndr, BUFFER_SPAN);
+
+	while (cache->oldest && cache->stats.bytes + bytes > cache->max_bytes) {
+		struct cache_entry *old = cache->oldest;
+
+		cache_unlink(cache, old);
+		free(old);
+		cache->stats.evictions++;
+	}
+
+	if (cache->stats.entries >= cache->bucket_count)
+		cache_rehash(cache);
+
+	entry->next = cache->buckets[hash & (cache->bucket_count - 1)];
+	cache->buckets[hash & (cache->bucket_count - 1)] = entry;
+
+	entry->newer = NULL;
+	entry->older = cache->newest;
+	if (cache->newest)
+		cache->newest->newer = entry;
+	else
+		cache->oldest = entry;
+	cache->newest = entry;
+
+	cache->stats.entries++;
+	cache->stats.bytes += bytes;
+}
+
+/* cache_context • the end of the lines a block parser may have looked at
+ * past the block: the empty lines, the next line and the one after it,
+ * which prefix_uli checks for a header underline. `next` gets the start
+ * of the next line */
+static size_t
+cache_context(uint8_t *data, size_t size, size_t end, size_t *next)
+{
+	size_t i, lines;
+
+	while (end < size && (i = is_empty(data + end, size - end)) != 0)
+		end += i;
+
+	*next = end;
+
+	for (lines = 0; lines < 2 && end < size; lines++) {
+		while (end < size && data[end] != '\n')
+			end++;
+
+		if (end < size)
+			end++;
+	}
+
+	return end;
+}
+
+/* cache_open_ended • whether the end of the block [beg, end) may depend
+ * on text past `next`, the start of the line that follows it: an HTML
+ * block ends at a closing tag anywhere further, so a block followed by
+ * one may end elsewhere, and so may a paragraph meeting one inside with
+ * MKDEXT_LAX_SPACING */
+static int
+cache_open_ended(struct sd_markdown *rndr, uint8_t *data, size_t size,
+	size_t beg, size_t end, size_t next)
+{
+	if (!rndr->cb.blockhtml)
+		return 0;
+
+	if (next < size && data[next] == '<')
+		return 1;
+
+	if (rndr->ext_flags & MKDEXT_LAX_SPACING)
+		while (beg < end) {
+			if (data[beg] == '<')
+				return 1;
+
+			while (beg < end && data[beg] != '\n')
+				beg++;
+			beg++;
+		}
+
+	return 0;
+}
+
+/* parse_block_cached • parse_block for the top level, reusing the output
+ * of blocks found in the cache. HTML blocks and open-ended blocks are
+ * always parsed, and so are short blocks */
+static void
+parse_block_cached(struct buf *ob, struct sd_markdown *rndr, uint8_t *data, size_t size)
+{
+	struct sd_block_cache *cache = rndr->cache;
+	struct cache_entry *entry;
+	size_t beg = 0, i, ctx, next, org;
+	uint64_t hash;
+	int prev;
+
+	stats_nesting(rndr);
+
+	while (beg < size) {
+		if (budget_exhausted(rndr))
+			break;
+
+		if ((i = is_empty(data + beg, size - beg)) != 0) {
+			beg += i;
+			continue;
+		}
+
+		if (data[beg] == '<' && rndr->cb.blockhtml) {
+			beg += parse_block_at(ob, rndr, data + beg, size - beg);
+			continue;
+		}
+
+		hash = cache_line_hash(rndr, data + beg, size - beg);
+		prev = ob->size ? ob->data[ob->size - 1] : 256;
+
+		entry = cache_find(rndr, data + beg, size - beg, hash, prev);
+		if (entry) {
+			cache->stats.hits++;
+			cache_touch(cache, entry);
+			bufput(ob, ENTRY_OUT(entry), entry->out_size);
+			beg += entry->src_size;
+			continue;
+		}
+
+		cache->stats.misses++;
+
+		org = ob->size;
+		rndr->cache_refs->size = 0;
+		rndr->cache_record = 1;
+
+		i = parse_block_at(ob, rndr, data + beg, size - beg);
+
+		rndr->cache_record = 0;
+
+		if (i > size - beg)
+			i = size - beg;
+
+		ctx = cache_context(data, size, beg + i, &next);
+
+		/* blocks that went back over the output before them are
+		 * not kept either */
+		if (i >= CACHE_MIN_BLOCK && !rndr->truncated && ob->size >= org &&
+			(!org || ob->data[org - 1] == prev) &&
+			!cache_open_ended(rndr, data, size, beg, beg + i, next))
+			cache_add(rndr, hash, prev, data + beg, i, ctx - beg, ctx == size,
+				ob->data + org, ob->size - org);
+
+		beg += i;
+	}
+}
+
+
+/*********************
+ * REFERENCE PARSING *
+ *********************/
+
+/* is_ref • returns whether a line is a reference or not */
+static int
+is_ref(const uint8_t *data, size_t beg, size_t end, size_t *last, struct link_ref **refs)
+{
+/*	int n; */
+	size_t i = 0;
+	size_t id_offset, id_end;
+	size_t link_offset, link_end;
+	size_t title_offset, title_end;
+	size_t line_end;
+
+	/* up to 3 optional leading spaces */
 	if (beg + 3 >= end) return 0;
 	if (data[beg] == ' ') { i = 1;
 	if (data[beg + 1] == ' ') { i = 2;
@@ -2364,16 +3073,112 @@ is_ref(const uint8_t *data, size_t beg, size_t end, size_t *last, struct link_re
 	return 1;
 }
 
-static void expand_tabs(struct buf *ob, const uint8_t *line, size_t size)
+/* line endings, for the scan of the pre-pass */
+static const uint8_t newline_chars[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const struct sd_charset newline_set = { newline_chars, "\n\r", 2 };
+
+/* text_map • where the pre-processed text comes from in the document:
+ * a mark where a line or an expanded tab changes the distance between
+ * the two */
+struct text_mark {
+	size_t text;
+	size_t doc;
+};
+
+struct text_map {
+	struct text_mark *marks;
+	size_t count, asize;
+	int error;
+};
+
+static void
+text_mark(struct text_map *map, size_t text, size_t doc)
+{
+	struct text_mark *mark;
+
+	if (map->count) {
+		mark = &map->marks[map->count - 1];
+		if (doc - mark->doc == text - mark->text)
+			return;
+	}
+
+	if (map->count == map->asize) {
+		size_t asize = map->asize ? map->asize * 2 : 64;
+
+		mark = realloc(map->marks, asize * sizeof(struct text_mark));
+		if (!mark) {
+			map->error = 1;
+			return;
+		}
+
+		map->marks = mark;
+		map->asize = asize;
+	}
+
+	mark = &map->marks[map->count++];
+	mark->text = text;
+	mark->doc = doc;
+}
+
+/* text_doc • the document offset of a text offset. The spaces of an
+ * expanded tab all map to the tab, and the newlines of a "\r\n" to
+ * the '\n' */
+static size_t
+text_doc(const struct text_map *map, size_t text, size_t doc_size)
+{
+	size_t lo = 0, hi = map->count, mid, doc;
+
+	if (!map->count)
+		return text < doc_size ? text : doc_size;
+
+	while (hi - lo > 1) {
+		mid = lo + (hi - lo) / 2;
+		if (map->marks[mid].text <= text)
+			lo = mid;
+		else
+			hi = mid;
+	}
+
+	doc = map->marks[lo].doc + (text - map->marks[lo].text);
+
+	if (lo + 1 < map->count && doc >= map->marks[lo + 1].doc)
+		doc = map->marks[lo + 1].doc - 1;
+
+	return doc < doc_size ? doc : doc_size;
+}
+
+/* expand_tabs • copies a line with its tabs expanded; with a map, the
+ * line starts at `doc` in the document */
+static void expand_tabs(struct buf *ob, const uint8_t *line, size_t size,
+	struct text_map *map, size_t doc)
 {
 	size_t  i = 0, tab = 0;
 
 	while (i < size) {
 		size_t org = i;
 
-		while (i < size && line[i] != '\t') {
-			i++; tab++;
-		}
+		const uint8_t *next = memchr(line + i, '\t', size - i);
+
+		i = next ? (size_t)(next - line) : size;
+		tab += i - org;
 
 		if (i > org)
 			bufput(ob, line + org, i - org);
@@ -2386,9 +3191,51 @@ static void expand_tabs(struct buf *ob, const uint8_t *line, size_t size)
 		} while (tab % 4);
 
 		i++;
+
+		if (map)
+			text_mark(map, ob->size, doc + i);
 	}
 }
 
+/* render_prepass • the first pass of a render: the references go to
+ * md->refs, the other lines to `text` with their tabs expanded and one
+ * '\n' per newline, and to `map` when there is one */
+static void
+render_prepass(struct buf *text, struct sd_markdown *md,
+	const uint8_t *document, size_t doc_size, struct text_map *map)
+{
+	static const char UTF8_BOM[] = {0xEF, 0xBB, 0xBF};
+	size_t beg = 0, end;
+
+	/* Skip a possible UTF-8 BOM, even though the Unicode standard
+	 * discourages having these in UTF-8 documents */
+	if (doc_size >= 3 && memcmp(document, UTF8_BOM, 3) == 0)
+		beg += 3;
+
+	while (beg < doc_size) /* iterating over lines */
+		if (is_ref(document, beg, doc_size, &end, md->refs))
+			beg = end;
+		else { /* skipping to the next line */
+			end = beg + sd_scan(document + beg, doc_size - beg, &newline_set);
+
+			if (map)
+				text_mark(map, text->size, beg);
+
+			/* adding the line body if present */
+			if (end > beg)
+				expand_tabs(text, document + beg, end - beg, map, beg);
+
+			while (end < doc_size && (document[end] == '\n' || document[end] == '\r')) {
+				/* add one \n per newline */
+				if (document[end] == '\n' || (end + 1 < doc_size && document[end + 1] != '\n'))
+					bufputc(text, '\n');
+				end++;
+			}
+
+			beg = end;
+		}
+}
+
 /**********************
  * EXPORTED FUNCTIONS *
  **********************/
@@ -2444,88 +3291,1214 @@ sd_markdown_new(
 	if (extensions & MKDEXT_SUPERSCRIPT)
 		md->active_char['^'] = MD_CHAR_SUPERSCRIPT;
 
+	sd_charset_init(&md->active_set, md->active_char);
+
+	/* bytes that may keep a document off the plain fast path */
+	memcpy(md->plain_char, md->active_char, 256);
+	md->plain_char['\n'] = 1;
+	md->plain_char['\t'] = 1;
+	md->plain_char['\r'] = 1;
+	if (extensions & MKDEXT_TABLES)
+		md->plain_char['|'] = 1;
+
+	sd_charset_init(&md->plain_set, md->plain_char);
+
 	/* Extension data */
 	md->ext_flags = extensions;
 	md->opaque = opaque;
 	md->max_nesting = max_nesting;
 	md->in_link_body = 0;
 
+	/* Work buffer retention */
+	md->max_retained = WORK_BUF_RETAIN;
+	md->trim_every = WORK_BUF_TRIM_EVERY;
+	md->renders = 0;
+
+	/* Render budget */
+	memset(&md->budget, 0x0, sizeof(struct sd_budget));
+	md->truncated = 0;
+
+	md->stats = NULL;
+
+	/* Block cache */
+	md->cache = NULL;
+	md->cache_key = 0;
+	md->cache_refs = NULL;
+	md->cache_record = 0;
+
+	md->extract = NULL;
+
 	return md;
 }
 
-void
-sd_markdown_render(struct buf *ob, const uint8_t *document, size_t doc_size, struct sd_markdown *md)
+/* render_start • resets the per-render state: budget, stats, output root */
+static void
+render_start(struct sd_markdown *md, struct buf *ob, size_t doc_size)
 {
-#define MARKDOWN_GROW(x) ((x) + ((x) >> 1))
-	static const char UTF8_BOM[] = {0xEF, 0xBB, 0xBF};
-
-	struct buf *text;
-	size_t beg, end;
-
-	text = bufnew(64);
-	if (!text)
-		return;
+	/* reset the budget; without limits the tick never runs out */
+	md->truncated = 0;
+	md->steps = 0;
+	md->scanned = 0;
+	md->ob_root = ob;
+	md->ob_start = ob->size;
+	md->deadline = 0;
+	md->budget_chunk = (size_t)-1;
+
+	if (md->budget.max_steps || md->budget.max_output || md->budget.max_time_us) {
+		md->budget_chunk = BUDGET_CHECK_EVERY;
+
+		if (md->budget.max_steps && md->budget.max_steps < BUDGET_CHECK_EVERY)
+			md->budget_chunk = md->budget.max_steps;
+
+		if (md->budget.max_time_us)
+			md->deadline = sd_timer_ns() + md->budget.max_time_us * 1000;
+	}
 
-	/* Preallocate enough space for our buffer to avoid expanding while copying */
-	bufgrow(text, doc_size);
+	md->budget_tick = md->budget_chunk;
 
 	/* reset the references table */
 	memset(&md->refs, 0x0, REF_TABLE_SIZE * sizeof(void *));
 
-	/* first pass: looking for references, copying everything else */
-	beg = 0;
+	if (md->stats) {
+		memset(md->stats, 0x0, sizeof(struct sd_render_stats));
+		md->stats->input_bytes = doc_size;
+	}
+}
 
-	/* Skip a possible UTF-8 BOM, even though the Unicode standard
-	 * discourages having these in UTF-8 documents */
-	if (doc_size >= 3 && memcmp(document, UTF8_BOM, 3) == 0)
-		beg += 3;
+/* render_end • closes the stats, frees the references and trims the work
+ * buffers; returns the render status */
+static int
+render_end(struct sd_markdown *md, struct buf *ob, uint64_t t_parse)
+{
+	if (md->stats) {
+		size_t i, type;
 
-	while (beg < doc_size) /* iterating over lines */
-		if (is_ref(document, beg, doc_size, &end, md->refs))
-			beg = end;
-		else { /* skipping to the next line */
-			end = beg;
-			while (end < doc_size && document[end] != '\n' && document[end] != '\r')
-				end++;
+		md->stats->parse_ns = sd_timer_ns() - t_parse;
+		md->stats->output_bytes = ob->size - md->ob_start;
 
-			/* adding the line body if present */
-			if (end > beg)
-				expand_tabs(text, document + beg, end - beg);
+		for (type = 0; type < 2; ++type) {
+			struct stack *pool = &md->work_bufs[type];
 
-			while (end < doc_size && (document[end] == '\n' || document[end] == '\r')) {
-				/* add one \n per newline */
-				if (document[end] == '\n' || (end + 1 < doc_size && document[end + 1] != '\n'))
-					bufputc(text, '\n');
-				end++;
+			for (i = 0; i < pool->asize; ++i) {
+				struct buf *work = pool->item[i];
+				if (work)
+					md->stats->pool_bytes += work->asize;
 			}
-
-			beg = end;
 		}
-
-	/* pre-grow the output buffer to minimize allocations */
-	bufgrow(ob, MARKDOWN_GROW(text->size));
-
-	/* second pass: actual rendering */
-	if (md->cb.doc_header)
-		md->cb.doc_header(ob, md->opaque);
-
-	if (text->size) {
-		/* adding a final newline if not already present */
-		if (text->data[text->size - 1] != '\n' &&  text->data[text->size - 1] != '\r')
-			bufputc(text, '\n');
-
-		parse_block(ob, md, text->data, text->size);
 	}
 
-	if (md->cb.doc_footer)
-		md->cb.doc_footer(ob, md->opaque);
-
-	/* clean-up */
-	bufrelease(text);
 	free_link_refs(md->refs);
 
 	assert(md->work_bufs[BUFFER_SPAN].size == 0);
 	assert(md->work_bufs[BUFFER_BLOCK].size == 0);
+
+	/* periodic trimming of the work buffers */
+	if (md->trim_every && ++md->renders >= md->trim_every)
+		sd_markdown_trim(md);
+
+	return md->truncated ? MKD_RENDER_TRUNCATED : MKD_RENDER_OK;
+}
+
+/* first bytes of a line that may start something else than a paragraph,
+ * or a reference definition; digits are checked with prefix_oli */
+static const uint8_t block_start_chars[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 1, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/* plain_line_start • whether the line at `data` can only continue or
+ * start a paragraph */
+static inline int
+plain_line_start(const uint8_t *data, size_t size)
+{
+	switch (block_start_chars[data[0]]) {
+	case 0:
+		return 1;
+	case 2:
+		return !prefix_oli((uint8_t *)data, size);
+	default:
+		return 0;
+	}
+}
+
+/* is_plain • whether the document has no markdown syntax at all: no
+ * block marker at the start of a line and no inline trigger that could
+ * fire, so that it renders as paragraphs of escaped text */
+static int
+is_plain(struct sd_markdown *md, const uint8_t *data, size_t size)
+{
+	size_t i = 0;
+	uint8_t action;
+
+	if (size && !plain_line_start(data, size))
+		return 0;
+
+	for (;;) {
+		i += sd_scan(data + i, size - i, &md->plain_set);
+		if (i >= size)
+			return 1;
+
+		action = md->active_char[data[i]];
+
+		if (data[i] == '\n') {
+			/* a hard break */
+			if (action && i >= 2 && data[i - 1] == ' ' && data[i - 2] == ' ')
+				return 0;
+
+			if (i + 1 < size && data[i + 1] != '\n' && !plain_line_start(data + i + 1, size - i - 1))
+				return 0;
+		}
+		else if (action < MD_CHAR_AUTOLINK_URL || action > MD_CHAR_AUTOLINK_WWW ||
+			autolink_candidate(action, data + i, i, size - i))
+			return 0;
+
+		i++;
+	}
+}
+
+/* render_plain • what parse_block and parse_inline do on a plain
+ * document: one paragraph per group of lines, its text cut into
+ * normal_text runs at the newlines the linebreak trigger stops at */
+static void
+render_plain(struct buf *ob, struct sd_markdown *md, const uint8_t *data, size_t size)
+{
+	size_t beg = 0, end, i, org;
+	struct buf work = { 0, 0, 0, 0 };
+	const uint8_t *nl;
+	int split = md->active_char['\n'] != 0;
+
+	if (md->cb.doc_header)
+		md->cb.doc_header(ob, md->opaque);
+
+	while (beg < size) {
+		struct buf *tmp;
+
+		if (data[beg] == '\n') {
+			beg++;
+			continue;
+		}
+
+		/* up to the first empty line */
+		for (end = beg; ; end++) {
+			nl = memchr(data + end, '\n', size - end);
+			end = nl ? (size_t)(nl - data) : size;
+
+			if (end + 1 >= size || data[end + 1] == '\n')
+				break;
+		}
+
+		if (!md->cb.paragraph) {
+			beg = end;
+			continue;
+		}
+
+		tmp = rndr_newbuf(md, BUFFER_BLOCK);
+
+		for (i = beg; i < end; ) {
+			org = i++;
+
+			nl = split ? memchr(data + i, '\n', end - i) : NULL;
+			i = nl ? (size_t)(nl - data) : end;
+
+			if (md->cb.normal_text) {
+				work.data = (uint8_t *)data + org;
+				work.size = i - org;
+				md->cb.normal_text(tmp, &work, md->opaque);
+			}
+			else
+				bufput(tmp, data + org, i - org);
+		}
+
+		md->cb.paragraph(ob, tmp, md->opaque);
+		rndr_popbuf(md, BUFFER_BLOCK);
+		beg = end;
+	}
+
+	if (md->cb.doc_footer)
+		md->cb.doc_footer(ob, md->opaque);
+}
+
+int
+sd_markdown_render(struct buf *ob, const uint8_t *document, size_t doc_size, struct sd_markdown *md)
+{
+#define MARKDOWN_GROW(x) ((x) + ((x) >> 1))
+
+	struct buf *text;
+	uint64_t t_start = 0, t_parse = 0;
+
+	render_start(md, ob, doc_size);
+
+	/* documents without any markdown skip the pre-pass and the parsers;
+	 * stats and budgets want the real thing */
+	if (!md->stats && md->budget_chunk == (size_t)-1 &&
+		is_plain(md, document, doc_size)) {
+		render_plain(ob, md, document, doc_size);
+		return render_end(md, ob, 0);
+	}
+
+	if (md->stats)
+		t_start = sd_timer_ns();
+
+	text = bufnew(64);
+	if (!text) {
+		render_end(md, ob, t_start);
+		return -1;
+	}
+
+	/* Preallocate enough space for our buffer to avoid expanding while copying */
+	bufgrow(text, doc_size);
+
+	/* first pass: looking for references, copying everything else */
+	render_prepass(text, md, document, doc_size, NULL);
+
+	/* pre-grow the output buffer to minimize allocations */
+	bufgrow(ob, MARKDOWN_GROW(text->size));
+
+	if (md->stats) {
+		md->stats->text_bytes = text->size;
+		t_parse = sd_timer_ns();
+		md->stats->prepass_ns = t_parse - t_start;
+	}
+
+	/* second pass: actual rendering */
+	if (md->cb.doc_header)
+		md->cb.doc_header(ob, md->opaque);
+
+	if (text->size) {
+		/* adding a final newline if not already present */
+		if (text->data[text->size - 1] != '\n' &&  text->data[text->size - 1] != '\r')
+			bufputc(text, '\n');
+
+		if (md->cache)
+			parse_block_cached(ob, md, text->data, text->size);
+		else
+			parse_block(ob, md, text->data, text->size);
+	}
+
+	if (md->cb.doc_footer)
+		md->cb.doc_footer(ob, md->opaque);
+
+	/* clean-up */
+	bufrelease(text);
+	return render_end(md, ob, t_parse);
+}
+
+int
+sd_markdown_render_inline(struct buf *ob, const uint8_t *text, size_t size,
+	const uint8_t *refs, size_t refs_size, struct sd_markdown *md)
+{
+	size_t beg = 0, end;
+	uint64_t t_parse = 0;
+
+	render_start(md, ob, size);
+
+	/* the reference definitions, every other line is ignored */
+	while (beg < refs_size) {
+		if (is_ref(refs, beg, refs_size, &end, md->refs)) {
+			beg = end;
+			continue;
+		}
+
+		beg += sd_scan(refs + beg, refs_size - beg, &newline_set);
+		while (beg < refs_size && (refs[beg] == '\n' || refs[beg] == '\r'))
+			beg++;
+	}
+
+	if (md->stats) {
+		md->stats->text_bytes = size;
+		t_parse = sd_timer_ns();
+	}
+
+	if (md->cb.doc_header)
+		md->cb.doc_header(ob, md->opaque);
+
+	/* parse_inline only reads its input */
+	parse_inline(ob, md, (uint8_t *)text, size);
+
+	if (md->cb.doc_footer)
+		md->cb.doc_footer(ob, md->opaque);
+
+	return render_end(md, ob, t_parse);
+}
+
+void
+sd_markdown_set_stats(struct sd_markdown *md, struct sd_render_stats *stats)
+{
+	md->stats = stats;
+}
+
+void
+sd_markdown_set_budget(struct sd_markdown *md, const struct sd_budget *budget)
+{
+	if (budget)
+		memcpy(&md->budget, budget, sizeof(struct sd_budget));
+	else
+		memset(&md->budget, 0x0, sizeof(struct sd_budget));
+}
+
+struct sd_block_cache *
+sd_block_cache_new(size_t max_bytes)
+{
+	struct sd_block_cache *cache;
+
+	cache = malloc(sizeof(struct sd_block_cache));
+	if (!cache)
+		return NULL;
+
+	memset(cache, 0x0, sizeof(struct sd_block_cache));
+
+	cache->buckets = calloc(CACHE_BUCKETS, sizeof(struct cache_entry *));
+	if (!cache->buckets) {
+		free(cache);
+		return NULL;
+	}
+
+	cache->bucket_count = CACHE_BUCKETS;
+	cache->max_bytes = max_bytes;
+	return cache;
+}
+
+void
+sd_block_cache_free(struct sd_block_cache *cache)
+{
+	struct cache_entry *entry, *older;
+
+	if (!cache)
+		return;
+
+	for (entry = cache->newest; entry; entry = older) {
+		older = entry->older;
+		free(entry);
+	}
+
+	free(cache->buckets);
+	free(cache);
+}
+
+void
+sd_block_cache_stats(const struct sd_block_cache *cache, struct sd_block_cache_stats *stats)
+{
+	memcpy(stats, &cache->stats, sizeof(struct sd_block_cache_stats));
+}
+
+void
+sd_markdown_set_cache(struct sd_markdown *md, struct sd_block_cache *cache, unsigned int render_flags)
+{
+	size_t params[3];
+
+	if (cache && !md->cache_refs) {
+		md->cache_refs = bufnew(64);
+		if (!md->cache_refs)
+			cache = NULL;
+	}
+
+	md->cache = cache;
+
+	/* two renderers with the same flags only share blocks when they
+	 * have the same callbacks */
+	params[0] = md->ext_flags;
+	params[1] = md->max_nesting;
+	params[2] = render_flags;
+
+	md->cache_key = cache_hash(14695981039346656037ULL,
+		(const uint8_t *)&md->cb, sizeof(struct sd_callbacks));
+	md->cache_key = cache_hash(md->cache_key, (const uint8_t *)params, sizeof(params));
+}
+
+void
+sd_markdown_set_retention(struct sd_markdown *md, size_t max_retained, unsigned int trim_every)
+{
+	md->max_retained = max_retained;
+	md->trim_every = trim_every;
+	md->renders = 0;
+}
+
+void
+sd_markdown_trim(struct sd_markdown *md)
+{
+	assert(md->work_bufs[BUFFER_SPAN].size == 0);
+	assert(md->work_bufs[BUFFER_BLOCK].size == 0);
+
+	pool_trim(&md->work_bufs[BUFFER_SPAN], md->max_retained);
+	pool_trim(&md->work_bufs[BUFFER_BLOCK], md->max_retained);
+	md->renders = 0;
+}
+
+void
+sd_markdown_estimate(struct sd_estimate *est, const uint8_t *document, size_t doc_size, struct sd_markdown *md)
+{
+	size_t beg = 0, end, i;
+	size_t para_size = 0, para_delims = 0;
+
+	memset(est, 0x0, sizeof(struct sd_estimate));
+	est->bytes = doc_size;
+
+	while (beg < doc_size) {
+		uint8_t *line = (uint8_t *)document + beg;
+		size_t depth = 0, pre;
+
+		est->lines++;
+
+		/* reference definitions are skipped by the pre-pass */
+		if (is_ref(document, beg, doc_size, &end, NULL)) {
+			est->references++;
+			beg = end;
+			while (beg < doc_size && (document[beg] == '\n' || document[beg] == '\r'))
+				beg++;
+			continue;
+		}
+
+		for (end = beg; end < doc_size && document[end] != '\n'; end++);
+
+		/* blank lines close the current paragraph: every delimiter
+		 * in it may have been matched against the whole of it */
+		for (i = beg; i < end && (document[i] == ' ' || document[i] == '\t' || document[i] == '\r'); i++);
+
+		if (i == end) {
+			est->worst_case += para_delims * para_size;
+			para_size = para_delims = 0;
+			beg = end + 1;
+			continue;
+		}
+
+		/* nesting of the line: quote prefixes, then list items */
+		i = 0;
+		while ((pre = prefix_quote(line + i, end - beg - i)) != 0) {
+			depth++;
+			i += pre;
+		}
+
+		if (prefix_uli(line + i, end - beg - i) || prefix_oli(line + i, end - beg - i)) {
+			for (pre = i; pre < end - beg && line[pre] == ' '; pre++);
+			depth += 1 + (pre - i) / 4;
+		}
+
+		if (depth > est->max_depth)
+			est->max_depth = depth;
+
+		/* HTML blocks look for their closing tag up to the end of the document */
+		if (beg + i < end && line[i] == '<' && md->cb.blockhtml) {
+			size_t t = i + 1;
+
+			while (beg + t < end && line[t] != '>' && line[t] != ' ')
+				t++;
+
+			if (beg + t < end && find_block_tag((char *)line + i + 1, (int)(t - i - 1))) {
+				est->html_blocks++;
+				est->worst_case += doc_size - beg;
+			}
+		}
+
+		/* inline constructs */
+		for (i = beg; i < end; ++i) {
+			uint8_t c = document[i];
+			uint8_t action = md->active_char[c];
+
+			if (action && autolink_candidate(action, document + i, i, doc_size - i))
+				est->active++;
+
+			if (c == '[' || c == ']') {
+				est->brackets++;
+				para_delims++;
+			}
+			else if (c == '`') {
+				if (i == beg || document[i - 1] != '`') {
+					est->backtick_runs++;
+					para_delims++;
+				}
+			}
+			else if (c == '|') {
+				if (md->ext_flags & MKDEXT_TABLES)
+					est->table_pipes++;
+			}
+			else if (action == MD_CHAR_EMPHASIS) {
+				est->emphasis++;
+				para_delims++;
+			}
+		}
+
+		para_size += end - beg + 1;
+		beg = end + 1;
+	}
+
+	est->worst_case += para_delims * para_size;
+
+	/* linear estimate: one pass for the pre-processing and the block
+	 * scan, plus the dispatch and buffer traffic of every trigger */
+	est->cost = 2 * doc_size + 8 * est->active + 16 * est->lines;
+	if (est->worst_case < est->cost)
+		est->worst_case = est->cost;
+}
+
+/* bytes stopping the link scan, without and with MKDEXT_AUTOLINK */
+static const uint8_t link_chars[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const uint8_t link_autolink_chars[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const struct sd_charset link_set = { link_chars, "<[\\`", 4 };
+static const struct sd_charset link_autolink_set = { link_autolink_chars, ":<@[\\`w", 7 };
+
+/* extract • the state of sd_markdown_extract_links and sd_markdown_outline
+ * while the block parser runs with md->extract set. Blockquotes move
+ * their lines in place and list items copy theirs into work buffers: the
+ * regions they fill are kept with the origin of every line, so that the
+ * pointers of the parser lead back to the document */
+struct extract_chunk {
+	size_t work;		/* offset in the region */
+	size_t text;		/* offset in the pre-processed text */
+};
+
+struct extract_region {
+	const uint8_t *data;	/* NULL until the region is parsed */
+	size_t size;
+	size_t chunk;		/* its first chunk */
+};
+
+struct extract {
+	struct text_map map;
+	const uint8_t *text;
+	size_t text_size;
+	size_t doc_size;
+
+	struct extract_chunk *chunks;
+	size_t chunk_count, chunk_asize;
+	struct extract_region *regions;
+	size_t region_count, region_asize;
+
+	struct sd_links *links;
+	struct sd_outline *outline;
+	int toc_id;
+	int error;
+};
+
+/* extract_offset • the text offset of a byte the parser points at: in
+ * the innermost region holding it, or in the pre-processed text */
+static size_t
+extract_offset(const struct extract *ex, const uint8_t *p)
+{
+	const struct extract_region *region;
+	size_t r = ex->region_count, lo, hi, mid, off;
+
+	while (r-- > 0) {
+		region = &ex->regions[r];
+		if (!region->data || p < region->data || p >= region->data + region->size)
+			continue;
+
+		off = (size_t)(p - region->data);
+		lo = region->chunk;
+		hi = (r + 1 < ex->region_count) ? ex->regions[r + 1].chunk : ex->chunk_count;
+
+		if (lo == hi)
+			break;
+
+		while (hi - lo > 1) {
+			mid = lo + (hi - lo) / 2;
+			if (ex->chunks[mid].work <= off)
+				lo = mid;
+			else
+				hi = mid;
+		}
+
+		return ex->chunks[lo].text + (off - ex->chunks[lo].work);
+	}
+
+	if (p >= ex->text && p < ex->text + ex->text_size)
+		return (size_t)(p - ex->text);
+
+	return ex->text_size;
+}
+
+/* extract_span • the document offset and size of `size` bytes the
+ * parser points at; they may run over several lines of a region */
+static void
+extract_span(const struct extract *ex, const uint8_t *p, size_t size,
+	size_t *offset, size_t *doc_size)
+{
+	size_t end;
+
+	*offset = text_doc(&ex->map, extract_offset(ex, p), ex->doc_size);
+
+	if (!size) {
+		*doc_size = 0;
+		return;
+	}
+
+	end = text_doc(&ex->map, extract_offset(ex, p + size - 1) + 1, ex->doc_size);
+	*doc_size = end > *offset ? end - *offset : 0;
+}
+
+/* extract_open • a blockquote or a list item starts filling a region */
+static void
+extract_open(struct sd_markdown *rndr)
+{
+	struct extract *ex = rndr->extract;
+	struct extract_region *region;
+
+	if (ex->region_count == ex->region_asize) {
+		size_t asize = ex->region_asize ? ex->region_asize * 2 : 16;
+
+		region = realloc(ex->regions, asize * sizeof(struct extract_region));
+		if (!region) {
+			ex->error = 1;
+			return;
+		}
+
+		ex->regions = region;
+		ex->region_asize = asize;
+	}
+
+	region = &ex->regions[ex->region_count++];
+	region->data = NULL;
+	region->size = 0;
+	region->chunk = ex->chunk_count;
+}
+
+/* extract_chunk • the bytes at `work` in the region being filled are
+ * copied from `src` */
+static void
+extract_chunk(struct sd_markdown *rndr, size_t work, const uint8_t *src)
+{
+	struct extract *ex = rndr->extract;
+	struct extract_chunk *chunk;
+
+	if (ex->chunk_count == ex->chunk_asize) {
+		size_t asize = ex->chunk_asize ? ex->chunk_asize * 2 : 64;
+
+		chunk = realloc(ex->chunks, asize * sizeof(struct extract_chunk));
+		if (!chunk) {
+			ex->error = 1;
+			return;
+		}
+
+		ex->chunks = chunk;
+		ex->chunk_asize = asize;
+	}
+
+	chunk = &ex->chunks[ex->chunk_count++];
+	chunk->work = work;
+	chunk->text = extract_offset(ex, src);
+}
+
+/* extract_enter • the region being filled is complete and parsed */
+static void
+extract_enter(struct sd_markdown *rndr, const uint8_t *data, size_t size)
+{
+	struct extract *ex = rndr->extract;
+
+	if (ex->region_count) {
+		ex->regions[ex->region_count - 1].data = data;
+		ex->regions[ex->region_count - 1].size = size;
+	}
+}
+
+/* extract_close • the region has been parsed */
+static void
+extract_close(struct sd_markdown *rndr)
+{
+	struct extract *ex = rndr->extract;
+
+	if (ex->region_count) {
+		ex->region_count--;
+		ex->chunk_count = ex->regions[ex->region_count].chunk;
+	}
+}
+
+/* links_add • appends a record of the `size` bytes at `src`, its text
+ * being at `text`; its target is what was written to links->data since
+ * `target` */
+static int
+links_add(struct extract *ex, enum mkd_link_type type,
+	const uint8_t *src, size_t size, const uint8_t *text, size_t text_size, size_t target)
+{
+	struct sd_links *links = ex->links;
+	struct sd_link *item;
+
+	if (links->count == links->asize) {
+		size_t asize = links->asize ? links->asize * 2 : 16;
+
+		item = realloc(links->items, asize * sizeof(struct sd_link));
+		if (!item)
+			return -1;
+
+		links->items = item;
+		links->asize = asize;
+	}
+
+	item = &links->items[links->count++];
+	item->type = type;
+	extract_span(ex, src, size, &item->offset, &item->size);
+	extract_span(ex, text, text_size, &item->text, &item->text_size);
+	item->target = target;
+	item->target_size = links->data->size - target;
+	return 0;
+}
+
+/* links_scan • the links of the inline text of a block. Inside a link text only images, links and <...> autolinks
+ * are looked for, as in char_link, and no deeper than max_nesting: the
+ * renderer drops the text of links nested deeper than that */
+static int
+links_scan(struct extract *ex, struct sd_markdown *md,
+	uint8_t *data, size_t size, size_t depth)
+{
+	struct sd_links *links = ex->links;
+	const struct sd_charset *set = (md->ext_flags & MKDEXT_AUTOLINK) ?
+		&link_autolink_set : &link_set;
+	size_t i = 0, end, txt_e, rewind, target, nb, run, org_work_size;
+	struct buf *link, *title, *work, tag;
+	enum mkd_autolink altype;
+	int is_img, ret = 0;
+
+	while (i < size && ret == 0) {
+		i += sd_scan(data + i, size - i, set);
+		if (i >= size)
+			break;
+
+		target = links->data->size;
+
+		switch (data[i]) {
+		case '\\':
+			/* escaped triggers are text, as in char_escape */
+			if (i + 1 < size && data[i + 1] && strchr("\\`[<:", data[i + 1]))
+				i += 2;
+			else
+				i++;
+			break;
+
+		case '`':
+			/* code span: up to the next run of as many backticks,
+			 * as in char_codespan */
+			for (nb = 0; i + nb < size && data[i + nb] == '`'; nb++);
+
+			for (run = 0, end = i + nb; end < size && run < nb; end++)
+				run = (data[end] == '`') ? run + 1 : 0;
+
+			i = (run < nb) ? i + 1 : end;
+			break;
+
+		case '[':
+			is_img = (i > 0 && data[i - 1] == '!');
+			org_work_size = md->work_bufs[BUFFER_SPAN].size;
+			end = find_link(md, data + i, size - i, &txt_e, &link, &title);
+
+			if (end && link)
+				unscape_text(links->data, link);
+
+			md->work_bufs[BUFFER_SPAN].size = org_work_size;
+
+			if (!end) {
+				i++;
+				break;
+			}
+
+			ret = links_add(ex, is_img ? MKDL_IMAGE : MKDL_LINK,
+				data + i - is_img, end + is_img, data + i + 1, txt_e - 1, target);
+
+			/* the text of a link is parsed, an image alt is not */
+			if (!is_img && ret == 0 && depth < md->max_nesting)
+				ret = links_scan(ex, md, data + i + 1, txt_e - 1, depth + 1);
+
+			i += end;
+			break;
+
+		case '<':
+			altype = MKDA_NOT_AUTOLINK;
+			end = tag_length(data + i, size - i, &altype);
+
+			if (end <= 2) {
+				i++;
+				break;
+			}
+
+			/* a tag: whatever is in it is not markdown */
+			if (altype != MKDA_NOT_AUTOLINK) {
+				tag.data = data + i + 1;
+				tag.size = end - 2;
+
+				if (altype == MKDA_EMAIL)
+					BUFPUTSL(links->data, "mailto:");
+				unscape_text(links->data, &tag);
+
+				ret = links_add(ex, MKDL_AUTOLINK, data + i, end,
+					data + i + 1, end - 2, target);
+			}
+
+			i += end;
+			break;
+
+		default:
+			if (depth || !autolink_candidate(md->active_char[data[i]], data + i, i, size - i)) {
+				i++;
+				break;
+			}
+
+			work = rndr_newbuf(md, BUFFER_SPAN);
+
+			if (data[i] == ':') {
+				end = sd_autolink__url(&rewind, work, data + i, i, size - i, 0);
+			} else if (data[i] == '@') {
+				end = sd_autolink__email(&rewind, work, data + i, i, size - i, 0);
+				BUFPUTSL(links->data, "mailto:");
+			} else {
+				end = sd_autolink__www(&rewind, work, data + i, i, size - i, 0);
+				BUFPUTSL(links->data, "http://");
+			}
+
+			if (end) {
+				bufput(links->data, work->data, work->size);
+				ret = links_add(ex, MKDL_AUTOLINK, data + i - rewind, rewind + end,
+					data + i - rewind, rewind + end, target);
+				i += end;
+			} else {
+				links->data->size = target;
+				i++;
+			}
+
+			rndr_popbuf(md, BUFFER_SPAN);
+			break;
+		}
+	}
+
+	return ret;
+}
+
+/* extract_text • the inline text of a paragraph, a header, a list item
+ * or a table cell */
+static void
+extract_text(struct sd_markdown *rndr, uint8_t *data, size_t size)
+{
+	struct extract *ex = rndr->extract;
+
+	if (ex->links && !ex->error && links_scan(ex, rndr, data, size, 0) < 0)
+		ex->error = 1;
+}
+
+/* outline_h_attributes • the text and the first id of a rendered header,
+ * read as handle_h_attributes in html.c reads them: the text stops at
+ * the first '{', then come ".class" and "#id" words. Returns whether
+ * there is an id, which may be empty */
+static int
+outline_h_attributes(const uint8_t *data, size_t size,
+	size_t *text_size, size_t *id, size_t *id_size)
+{
+	size_t i, attr;
+	int has_id = 0;
+
+	for (i = 0; i < size && data[i] != '{'; i++);
+	*text_size = i;
+
+	while (i + 1 < size) {
+		if (data[i + 1] == ' ') {
+			i++;
+			continue;
+		}
+
+		if (data[i + 1] != '.' && data[i + 1] != '#')
+			break;
+
+		attr = i + 2;
+		for (i = attr; i < size && data[i] != '}' && data[i] != '.' &&
+			data[i] != ' ' && data[i] != '#'; i++);
+
+		if (data[attr - 1] == '#' && !has_id) {
+			*id = attr;
+			*id_size = i - attr;
+			has_id = 1;
+		}
+	}
+
+	while (*text_size && sd_isspace(data[*text_size - 1]))
+		(*text_size)--;
+
+	return has_id;
+}
+
+/* extract_header • records a header, its text rendered by the span
+ * callbacks of md; `src` is the header in the source */
+static void
+extract_header(struct sd_markdown *rndr, const struct buf *text, int level,
+	const uint8_t *src, size_t src_size)
+{
+	struct extract *ex = rndr->extract;
+	struct sd_outline *outline = ex->outline;
+	struct sd_header *item;
+	size_t text_size, id = 0, id_size = 0;
+	int has_id = 0;
+
+	if (!outline || ex->error)
+		return;
+
+	if (outline->count == outline->asize) {
+		size_t asize = outline->asize ? outline->asize * 2 : 16;
+
+		item = realloc(outline->items, asize * sizeof(struct sd_header));
+		if (!item) {
+			ex->error = 1;
+			return;
+		}
+
+		outline->items = item;
+		outline->asize = asize;
+	}
+
+	item = &outline->items[outline->count++];
+	item->level = level;
+	extract_span(ex, src, src_size, &item->offset, &item->size);
+
+	text_size = text->size;
+	if (outline->flags & SD_OUTLINE_H_ATTRIBUTES)
+		has_id = outline_h_attributes(text->data, text->size, &text_size, &id, &id_size);
+
+	item->text = outline->data->size;
+	item->text_size = text_size;
+	bufput(outline->data, text->data, text_size);
+
+	item->id = outline->data->size;
+	item->id_size = id_size;
+	bufput(outline->data, text->data + id, id_size);
+
+	/* the HTML renderer numbers the headers without an id */
+	item->toc_id = has_id ? -1 : ex->toc_id++;
+}
+
+/* callbacks standing for the blocks of md that change how a document is
+ * parsed, or whose text is wanted, while writing nothing */
+static void
+extract_skip(struct buf *ob, const struct buf *text, void *opaque)
+{
+}
+
+static void
+extract_skip_level(struct buf *ob, const struct buf *text, int level, void *opaque)
+{
+}
+
+static void
+extract_skip_table(struct buf *ob, const struct buf *header, const struct buf *body, void *opaque)
+{
+}
+
+/* extract_callbacks • the span callbacks of md, and for the blocks only
+ * the ones the parser needs; the text of the headers is parsed with
+ * `headers`, that of table cells with `tables` */
+static void
+extract_callbacks(struct sd_callbacks *cb, struct sd_markdown *md, int headers, int tables)
+{
+	memcpy(cb, &md->cb, sizeof(struct sd_callbacks));
+
+	cb->blockcode = NULL;
+	cb->blockquote = NULL;
+	cb->blockhtml = md->cb.blockhtml ? extract_skip : NULL;
+	cb->header = headers ? extract_skip_level : NULL;
+	cb->hrule = NULL;
+	cb->list = NULL;
+	cb->listitem = NULL;
+	cb->paragraph = NULL;
+	cb->table = tables ? extract_skip_table : NULL;
+	cb->table_row = tables ? extract_skip : NULL;
+	cb->table_cell = tables ? extract_skip_level : NULL;
+	cb->doc_header = NULL;
+	cb->doc_footer = NULL;
+}
+
+/* extract_run • a render of `document` into `ob` with the callbacks `cb`
+ * in place of those of md, recording into `ex`. Returns the render
+ * status, or -1 when out of memory */
+static int
+extract_run(struct extract *ex, struct sd_markdown *md, const struct sd_callbacks *cb,
+	struct buf *ob, const uint8_t *document, size_t doc_size)
+{
+	struct sd_callbacks org;
+	struct buf *text;
+	uint64_t t_start = 0, t_parse = 0;
+	int ret;
+
+	render_start(md, ob, doc_size);
+
+	if (md->stats)
+		t_start = sd_timer_ns();
+
+	text = bufnew(64);
+	if (!text) {
+		render_end(md, ob, t_parse);
+		return -1;
+	}
+
+	bufgrow(text, doc_size);
+	render_prepass(text, md, document, doc_size, &ex->map);
+
+	if (text->size && text->data[text->size - 1] != '\n' && text->data[text->size - 1] != '\r')
+		bufputc(text, '\n');
+
+	if (md->stats) {
+		md->stats->text_bytes = text->size;
+		t_parse = sd_timer_ns();
+		md->stats->prepass_ns = t_parse - t_start;
+	}
+
+	ex->text = text->data;
+	ex->text_size = text->size;
+	ex->doc_size = doc_size;
+
+	memcpy(&org, &md->cb, sizeof(struct sd_callbacks));
+	memcpy(&md->cb, cb, sizeof(struct sd_callbacks));
+	md->extract = ex;
+
+	if (text->size && !ex->map.error)
+		parse_block(ob, md, text->data, text->size);
+
+	md->extract = NULL;
+	memcpy(&md->cb, &org, sizeof(struct sd_callbacks));
+
+	bufrelease(text);
+	free(ex->map.marks);
+	free(ex->chunks);
+	free(ex->regions);
+
+	ret = render_end(md, ob, t_parse);
+	return (ex->error || ex->map.error) ? -1 : ret;
+}
+
+struct sd_links *
+sd_links_new(void)
+{
+	struct sd_links *links;
+
+	links = malloc(sizeof(struct sd_links));
+	if (!links)
+		return NULL;
+
+	memset(links, 0x0, sizeof(struct sd_links));
+
+	links->data = bufnew(256);
+	if (!links->data) {
+		free(links);
+		return NULL;
+	}
+
+	return links;
+}
+
+void
+sd_links_free(struct sd_links *links)
+{
+	if (!links)
+		return;
+
+	bufrelease(links->data);
+	free(links->items);
+	free(links);
+}
+
+int
+sd_markdown_extract_links(struct sd_links *links, const uint8_t *document, size_t doc_size, struct sd_markdown *md)
+{
+	struct sd_callbacks cb;
+	struct extract ex;
+
+	links->count = 0;
+	links->data->size = 0;
+
+	memset(&ex, 0x0, sizeof(struct extract));
+	ex.links = links;
+
+	extract_callbacks(&cb, md, 0, (md->ext_flags & MKDEXT_TABLES) != 0);
+	return extract_run(&ex, md, &cb, links->data, document, doc_size);
+}
+
+struct sd_outline *
+sd_outline_new(unsigned int flags)
+{
+	struct sd_outline *outline;
+
+	outline = malloc(sizeof(struct sd_outline));
+	if (!outline)
+		return NULL;
+
+	memset(outline, 0x0, sizeof(struct sd_outline));
+	outline->flags = flags;
+
+	outline->data = bufnew(256);
+	if (!outline->data) {
+		free(outline);
+		return NULL;
+	}
+
+	return outline;
+}
+
+void
+sd_outline_free(struct sd_outline *outline)
+{
+	if (!outline)
+		return;
+
+	bufrelease(outline->data);
+	free(outline->items);
+	free(outline);
+}
+
+int
+sd_markdown_outline(struct sd_outline *outline, const uint8_t *document, size_t doc_size, struct sd_markdown *md)
+{
+	struct sd_callbacks cb;
+	struct extract ex;
+
+	outline->count = 0;
+	outline->data->size = 0;
+
+	memset(&ex, 0x0, sizeof(struct extract));
+	ex.outline = outline;
+
+	extract_callbacks(&cb, md, 1, 0);
+	return extract_run(&ex, md, &cb, outline->data, document, doc_size);
 }
 
 void
@@ -2542,6 +4515,7 @@ sd_markdown_free(struct sd_markdown *md)
 	stack_free(&md->work_bufs[BUFFER_SPAN]);
 	stack_free(&md->work_bufs[BUFFER_BLOCK]);
 
+	bufrelease(md->cache_refs);
 	free(md);
 }
 
@@ -61,9 +61,154 @@ enum mkd_extensions {
 	MKDEXT_LAX_SPACING = (1 << 8),
 };
 
+/* mkd_render_status - result of a render */
+enum mkd_render_status {
+	MKD_RENDER_OK = 0,
+	MKD_RENDER_TRUNCATED = 1,	/* the budget ran out, output is partial */
+};
+
+/* sd_budget - limits on the work done by a single render (0 = unlimited) */
+struct sd_budget {
+	size_t max_steps;		/* parsed blocks and inline triggers */
+	size_t max_output;		/* bytes appended to the output buffer */
+	uint64_t max_time_us;	/* time since the start of the render */
+};
+
+/* mkd_block_type - kinds of block, as counted in sd_render_stats */
+enum mkd_block_type {
+	MKDB_BLOCKCODE,
+	MKDB_BLOCKQUOTE,
+	MKDB_BLOCKHTML,
+	MKDB_HEADER,
+	MKDB_HRULE,
+	MKDB_LIST,
+	MKDB_LISTITEM,
+	MKDB_PARAGRAPH,
+	MKDB_TABLE,
+	MKDB_TABLE_ROW,
+	MKDB_TABLE_CELL,
+	MKDB_COUNT
+};
+
+/* mkd_span_type - inline triggers, as counted in sd_render_stats */
+enum mkd_span_type {
+	MKDS_EMPHASIS,
+	MKDS_CODESPAN,
+	MKDS_LINEBREAK,
+	MKDS_LINK,
+	MKDS_LANGLE,
+	MKDS_ESCAPE,
+	MKDS_ENTITY,
+	MKDS_AUTOLINK_URL,
+	MKDS_AUTOLINK_EMAIL,
+	MKDS_AUTOLINK_WWW,
+	MKDS_SUPERSCRIPT,
+	MKDS_COUNT
+};
+
+/* sd_render_stats - counters filled by sd_markdown_render */
+struct sd_render_stats {
+	size_t input_bytes;
+	size_t output_bytes;
+	size_t text_bytes;		/* document after the pre-pass */
+
+	size_t blocks[MKDB_COUNT];	/* blocks parsed */
+	size_t triggers[MKDS_COUNT];	/* inline triggers fired */
+	size_t wasted[MKDS_COUNT];	/* ... of which produced nothing */
+
+	size_t max_nesting;		/* deepest nesting reached */
+	size_t allocs;			/* work buffers allocated */
+	size_t pool_bytes;		/* bytes held by the work buffers */
+	size_t peak_bufs[2];	/* work buffers in use at once: block, span */
+
+	uint64_t prepass_ns;	/* reference pass and tab expansion */
+	uint64_t parse_ns;		/* block and inline parsing, with callbacks */
+};
+
+/* sd_block_cache_stats - counters of a block cache, since its creation */
+struct sd_block_cache_stats {
+	size_t hits;
+	size_t misses;
+	size_t evictions;		/* entries dropped to stay under the cap */
+	size_t entries;
+	size_t bytes;			/* held by the entries, counted against the cap */
+};
+
+/* sd_estimate - cost indicators gathered by sd_markdown_estimate */
+struct sd_estimate {
+	size_t bytes;
+	size_t lines;
+	size_t references;		/* reference definitions */
+	size_t html_blocks;		/* lines opening a known HTML block */
+	size_t max_depth;		/* deepest quote/list nesting */
+	size_t active;			/* bytes firing an inline trigger */
+	size_t emphasis;		/* emphasis delimiters */
+	size_t brackets;		/* '[' and ']' */
+	size_t backtick_runs;
+	size_t table_pipes;
+
+	size_t cost;			/* expected render cost, in byte-equivalents */
+	size_t worst_case;		/* upper bound if no delimiter finds its match */
+};
+
+/* mkd_link_type - kinds of link found by sd_markdown_extract_links */
+enum mkd_link_type {
+	MKDL_LINK,
+	MKDL_IMAGE,
+	MKDL_AUTOLINK,		/* <...>, and bare URLs with MKDEXT_AUTOLINK */
+};
+
+/* sd_link - one link, image or autolink. Offsets are in the source
+ * document; the target is in sd_links.data */
+struct sd_link {
+	enum mkd_link_type type;
+	size_t offset;			/* first byte: '[', '!', '<' or the URL */
+	size_t size;			/* source bytes up to the end of the link */
+	size_t text;			/* link text or image alt, in the source */
+	size_t text_size;
+	size_t target;			/* unescaped, references resolved */
+	size_t target_size;
+};
+
+/* sd_links - the records of sd_markdown_extract_links, in document order */
+struct sd_links {
+	struct sd_link *items;
+	size_t count;
+	size_t asize;
+	struct buf *data;		/* the targets, one after the other */
+};
+
+enum {
+	SD_OUTLINE_H_ATTRIBUTES = (1 << 0),	/* "{#id .class}" ends the header text */
+};
+
+/* sd_header - one header found by sd_markdown_outline */
+struct sd_header {
+	int level;
+	int toc_id;			/* n of the "toc_<n>" id of HTML_TOC, -1 with an {#id} */
+	size_t offset;			/* source bytes, setext underline included */
+	size_t size;
+	size_t text;			/* rendered by the span callbacks, in sd_outline.data */
+	size_t text_size;
+	size_t id;			/* the {#id} without its '#', in sd_outline.data */
+	size_t id_size;
+};
+
+/* sd_outline - the headers of a document, in document order */
+struct sd_outline {
+	struct sd_header *items;
+	size_t count;
+	size_t asize;
+	struct buf *data;		/* texts and ids, one after the other */
+	unsigned int flags;
+};
+
 /* sd_callbacks - functions for rendering parsed data */
 struct sd_callbacks {
-	/* block level callbacks - NULL skips the block */
+	/* block level callbacks - NULL skips the block. The text of a skipped
+	 * paragraph, header, list item, table or code block is not parsed
+	 * nor copied; blocks nested in a skipped list or blockquote still
+	 * are, and reach their own callbacks */
 	void (*blockcode)(struct buf *ob, const struct buf *text, const struct buf *lang, void *opaque);
 	void (*blockquote)(struct buf *ob, const struct buf *text, void *opaque);
 	void (*blockhtml)(struct buf *ob,const  struct buf *text, void *opaque);
@@ -100,6 +245,7 @@ struct sd_callbacks {
 };
 
 struct sd_markdown;
+struct sd_block_cache;
 
 /*********
  * FLAGS *
@@ -120,12 +266,130 @@ sd_markdown_new(
 	const struct sd_callbacks *callbacks,
 	void *opaque);
 
-extern void
+/* sd_markdown_render • renders `document` into `ob` through the callbacks
+ * of `md`. Returns MKD_RENDER_OK or MKD_RENDER_TRUNCATED, or -1 when out
+ * of memory */
+extern int
 sd_markdown_render(struct buf *ob, const uint8_t *document, size_t doc_size, struct sd_markdown *md);
 
+/* sd_markdown_render_inline • renders a one-line string (a title, a
+ * table field) with the span callbacks only: no pre-pass, no block
+ * parsing and no paragraph around it. Links may refer to the reference
+ * definitions in `refs`, which may be NULL; doc_header and doc_footer
+ * are still called */
+extern int
+sd_markdown_render_inline(struct buf *ob, const uint8_t *text, size_t size,
+	const uint8_t *refs, size_t refs_size, struct sd_markdown *md);
+
 extern void
 sd_markdown_free(struct sd_markdown *md);
 
+/* sd_markdown_set_retention • bounds the scratch memory kept between renders:
+ * every `trim_every` renders (0 = never), the pooled work buffers holding
+ * more than `max_retained` bytes are released */
+extern void
+sd_markdown_set_retention(struct sd_markdown *md, size_t max_retained, unsigned int trim_every);
+
+/* sd_markdown_trim • releases the oversized work buffers right away */
+extern void
+sd_markdown_trim(struct sd_markdown *md);
+
+/* sd_markdown_set_stats • makes every following render fill `stats`
+ * (NULL disables the counters) */
+extern void
+sd_markdown_set_stats(struct sd_markdown *md, struct sd_render_stats *stats);
+
+/* sd_markdown_estimate • cheap linear pre-scan of a document, counting the
+ * constructs that make a render expensive. Only the trigger table and
+ * the extensions of `md` are used; nothing is rendered */
+extern void
+sd_markdown_estimate(struct sd_estimate *est, const uint8_t *document, size_t doc_size, struct sd_markdown *md);
+
+/* sd_links_new • empty record list for sd_markdown_extract_links */
+extern struct sd_links *
+sd_links_new(void);
+
+extern void
+sd_links_free(struct sd_links *links);
+
+/* sd_markdown_extract_links • fills `links` with every link, image and
+ * autolink a render with `md` would find, without rendering anything:
+ * the blocks are parsed as in a render, and the text of paragraphs,
+ * headers, list items and table cells is scanned stopping only at '[',
+ * '<', '`', '\\' and the autolink triggers. Code blocks, code spans and
+ * HTML blocks are skipped, and link texts are looked into no deeper than
+ * max_nesting. Only the extensions, cb.blockhtml and the work buffers
+ * of `md` are used; budget and stats apply as in a render. Returns
+ * MKD_RENDER_OK or MKD_RENDER_TRUNCATED, or -1 when out of memory */
+extern int
+sd_markdown_extract_links(struct sd_links *links, const uint8_t *document, size_t doc_size, struct sd_markdown *md);
+
+/* sd_outline_new • empty header list for sd_markdown_outline; flags are
+ * SD_OUTLINE_* */
+extern struct sd_outline *
+sd_outline_new(unsigned int flags);
+
+extern void
+sd_outline_free(struct sd_outline *outline);
+
+/* sd_markdown_outline • fills `outline` with the headers a render with
+ * `md` would write, without rendering the rest: the blocks are parsed as
+ * in a render, with the block callbacks of `md` left out, and only
+ * header text goes through the span callbacks. Budget and stats apply
+ * as in a render. Returns MKD_RENDER_OK or MKD_RENDER_TRUNCATED, or -1
+ * when out of memory */
+extern int
+sd_markdown_outline(struct sd_outline *outline, const uint8_t *document, size_t doc_size, struct sd_markdown *md);
+
+/* sd_markdown_set_budget • caps the work of every following render (NULL
+ * removes the caps). The budget is checked every few parser steps; once
+ * it runs out, the span being parsed is cut at the next inline trigger,
+ * the blocks still open are closed and sd_markdown_render returns
+ * MKD_RENDER_TRUNCATED. The caps are coarse: max_output counts the
+ * output and the work buffers of the open blocks (list items keep their
+ * source there too, so it may trip early), and between two checks a
+ * render may write a few hundred steps of output past it. max_time_us is
+ * also checked every 64KB looked at by the searches that may run to the
+ * end of the document (emphasis, link text, end of an HTML block), so a
+ * render returns at most about one linear pass over the document past
+ * the deadline: the pre-pass, a block being copied, or one such search.
+ * With a 10ms deadline, 1.2MB of nested quotes or wide tables returns
+ * after 35-40ms and pathological emphasis, brackets or HTML after 10-12ms */
+extern void
+sd_markdown_set_budget(struct sd_markdown *md, const struct sd_budget *budget);
+
+/* sd_block_cache_new • empty cache of rendered top-level blocks, holding
+ * up to `max_bytes` of source, output and bookkeeping; the least recently
+ * used blocks are dropped first. A cache may be shared by several
+ * sd_markdown, but it is not locked */
+extern struct sd_block_cache *
+sd_block_cache_new(size_t max_bytes);
+
+extern void
+sd_block_cache_free(struct sd_block_cache *cache);
+
+extern void
+sd_block_cache_stats(const struct sd_block_cache *cache, struct sd_block_cache_stats *stats);
+
+/* sd_markdown_set_cache • makes every following render reuse the output
+ * of top-level blocks already rendered through `cache` (NULL disables
+ * it). Blocks are matched on their source after the pre-pass, the lines
+ * that ended them, the extensions, callbacks and nesting limit of `md`,
+ * `render_flags` (the flags of the renderer, which `md` cannot see) and
+ * the references they use. HTML blocks and short blocks are always
+ * parsed. Nothing else about the renderer is in the key, and the
+ * callbacks are not called for a reused block, so the output is wrong
+ * for a renderer that keeps state across blocks or reads state other
+ * than its flags:
+ * - the header count of HTML_TOC, and the sdhtml_toc it fills;
+ * - the open quotes of HTML_SMARTYPANTS;
+ * - the link policy and the link_attributes callback of html_renderopt,
+ *   which would leak between sd_markdown sharing a cache;
+ * - the counters of sdtext_renderer.
+ * sdhtml_set_cache checks an html_renderopt before setting the cache */
+extern void
+sd_markdown_set_cache(struct sd_markdown *md, struct sd_block_cache *cache, unsigned int render_flags);
+
 extern void
 sd_version(int *major, int *minor, int *revision);
 
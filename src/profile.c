@@ -0,0 +1,526 @@
+#include "profile.h"
+#include "timer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* callbacks may re-enter the parser; deeper calls are only counted */
+#define PROFILE_MAX_DEPTH 64
+
+/* one slot per entry of struct sd_callbacks, in the same order */
+enum profile_slot {
+	PROF_BLOCKCODE,
+	PROF_BLOCKQUOTE,
+	PROF_BLOCKHTML,
+	PROF_HEADER,
+	PROF_HRULE,
+	PROF_LIST,
+	PROF_LISTITEM,
+	PROF_PARAGRAPH,
+	PROF_TABLE,
+	PROF_TABLE_ROW,
+	PROF_TABLE_CELL,
+	PROF_AUTOLINK,
+	PROF_CODESPAN,
+	PROF_DOUBLE_EMPHASIS,
+	PROF_EMPHASIS,
+	PROF_IMAGE,
+	PROF_LINEBREAK,
+	PROF_LINK,
+	PROF_RAW_HTML_TAG,
+	PROF_TRIPLE_EMPHASIS,
+	PROF_STRIKETHROUGH,
+	PROF_SUPERSCRIPT,
+	PROF_ENTITY,
+	PROF_NORMAL_TEXT,
+	PROF_DOC_HEADER,
+	PROF_DOC_FOOTER,
+	PROF_COUNT
+};
+
+static const char *profile_names[PROF_COUNT] = {
+	"blockcode",
+	"blockquote",
+	"blockhtml",
+	"header",
+	"hrule",
+	"list",
+	"listitem",
+	"paragraph",
+	"table",
+	"table_row",
+	"table_cell",
+	"autolink",
+	"codespan",
+	"double_emphasis",
+	"emphasis",
+	"image",
+	"linebreak",
+	"link",
+	"raw_html_tag",
+	"triple_emphasis",
+	"strikethrough",
+	"superscript",
+	"entity",
+	"normal_text",
+	"doc_header",
+	"doc_footer",
+};
+
+struct profile_entry {
+	size_t calls;
+	uint64_t inclusive_ns;
+	uint64_t exclusive_ns;
+	size_t bytes;
+};
+
+struct profile_frame {
+	uint64_t start;
+	uint64_t children;
+	size_t org;
+};
+
+struct sd_profile {
+	struct sd_callbacks cb;
+	void *opaque;
+
+	struct profile_entry entries[PROF_COUNT];
+	struct profile_frame frames[PROFILE_MAX_DEPTH];
+	size_t depth;
+
+	size_t renders;
+	uint64_t render_start;
+	uint64_t render_ns;
+};
+
+/* prof_enter • opens a timing frame for the callback about to run */
+static void
+prof_enter(struct sd_profile *prof, const struct buf *ob)
+{
+	if (prof->depth < PROFILE_MAX_DEPTH) {
+		struct profile_frame *frame = &prof->frames[prof->depth];
+
+		frame->org = ob->size;
+		frame->children = 0;
+		frame->start = sd_timer_ns();
+	}
+
+	prof->depth++;
+}
+
+/* prof_leave • closes the current frame and accounts it to `slot` */
+static void
+prof_leave(struct sd_profile *prof, int slot, const struct buf *ob)
+{
+	struct profile_entry *entry = &prof->entries[slot];
+	struct profile_frame *frame;
+	uint64_t elapsed;
+
+	entry->calls++;
+
+	if (--prof->depth >= PROFILE_MAX_DEPTH)
+		return;
+
+	frame = &prof->frames[prof->depth];
+	elapsed = sd_timer_ns() - frame->start;
+
+	entry->inclusive_ns += elapsed;
+	entry->exclusive_ns += elapsed - frame->children;
+
+	if (ob->size > frame->org)
+		entry->bytes += ob->size - frame->org;
+
+	if (prof->depth > 0)
+		prof->frames[prof->depth - 1].children += elapsed;
+}
+
+/***********************
+ * CALLBACK WRAPPERS *
+ ***********************/
+
+static void
+prof_blockcode(struct buf *ob, const struct buf *text, const struct buf *lang, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.blockcode(ob, text, lang, prof->opaque);
+	prof_leave(prof, PROF_BLOCKCODE, ob);
+}
+
+static void
+prof_blockquote(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.blockquote(ob, text, prof->opaque);
+	prof_leave(prof, PROF_BLOCKQUOTE, ob);
+}
+
+static void
+prof_blockhtml(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.blockhtml(ob, text, prof->opaque);
+	prof_leave(prof, PROF_BLOCKHTML, ob);
+}
+
+static void
+prof_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.header(ob, text, level, prof->opaque);
+	prof_leave(prof, PROF_HEADER, ob);
+}
+
+static void
+prof_hrule(struct buf *ob, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.hrule(ob, prof->opaque);
+	prof_leave(prof, PROF_HRULE, ob);
+}
+
+static void
+prof_list(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.list(ob, text, flags, prof->opaque);
+	prof_leave(prof, PROF_LIST, ob);
+}
+
+static void
+prof_listitem(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.listitem(ob, text, flags, prof->opaque);
+	prof_leave(prof, PROF_LISTITEM, ob);
+}
+
+static void
+prof_paragraph(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.paragraph(ob, text, prof->opaque);
+	prof_leave(prof, PROF_PARAGRAPH, ob);
+}
+
+static void
+prof_table(struct buf *ob, const struct buf *header, const struct buf *body, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.table(ob, header, body, prof->opaque);
+	prof_leave(prof, PROF_TABLE, ob);
+}
+
+static void
+prof_table_row(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.table_row(ob, text, prof->opaque);
+	prof_leave(prof, PROF_TABLE_ROW, ob);
+}
+
+static void
+prof_table_cell(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.table_cell(ob, text, flags, prof->opaque);
+	prof_leave(prof, PROF_TABLE_CELL, ob);
+}
+
+static int
+prof_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.autolink(ob, link, type, prof->opaque);
+	prof_leave(prof, PROF_AUTOLINK, ob);
+	return r;
+}
+
+static int
+prof_codespan(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.codespan(ob, text, prof->opaque);
+	prof_leave(prof, PROF_CODESPAN, ob);
+	return r;
+}
+
+static int
+prof_double_emphasis(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.double_emphasis(ob, text, prof->opaque);
+	prof_leave(prof, PROF_DOUBLE_EMPHASIS, ob);
+	return r;
+}
+
+static int
+prof_emphasis(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.emphasis(ob, text, prof->opaque);
+	prof_leave(prof, PROF_EMPHASIS, ob);
+	return r;
+}
+
+static int
+prof_image(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *alt, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.image(ob, link, title, alt, prof->opaque);
+	prof_leave(prof, PROF_IMAGE, ob);
+	return r;
+}
+
+static int
+prof_linebreak(struct buf *ob, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.linebreak(ob, prof->opaque);
+	prof_leave(prof, PROF_LINEBREAK, ob);
+	return r;
+}
+
+static int
+prof_link(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.link(ob, link, title, content, prof->opaque);
+	prof_leave(prof, PROF_LINK, ob);
+	return r;
+}
+
+static int
+prof_raw_html_tag(struct buf *ob, const struct buf *tag, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.raw_html_tag(ob, tag, prof->opaque);
+	prof_leave(prof, PROF_RAW_HTML_TAG, ob);
+	return r;
+}
+
+static int
+prof_triple_emphasis(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.triple_emphasis(ob, text, prof->opaque);
+	prof_leave(prof, PROF_TRIPLE_EMPHASIS, ob);
+	return r;
+}
+
+static int
+prof_strikethrough(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.strikethrough(ob, text, prof->opaque);
+	prof_leave(prof, PROF_STRIKETHROUGH, ob);
+	return r;
+}
+
+static int
+prof_superscript(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	int r;
+	prof_enter(prof, ob);
+	r = prof->cb.superscript(ob, text, prof->opaque);
+	prof_leave(prof, PROF_SUPERSCRIPT, ob);
+	return r;
+}
+
+static void
+prof_entity(struct buf *ob, const struct buf *entity, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.entity(ob, entity, prof->opaque);
+	prof_leave(prof, PROF_ENTITY, ob);
+}
+
+static void
+prof_normal_text(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+	prof_enter(prof, ob);
+	prof->cb.normal_text(ob, text, prof->opaque);
+	prof_leave(prof, PROF_NORMAL_TEXT, ob);
+}
+
+/* the document header and footer are always wrapped: they bracket the
+ * block parsing of every render */
+static void
+prof_doc_header(struct buf *ob, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+
+	prof->render_start = sd_timer_ns();
+
+	if (prof->cb.doc_header) {
+		prof_enter(prof, ob);
+		prof->cb.doc_header(ob, prof->opaque);
+		prof_leave(prof, PROF_DOC_HEADER, ob);
+	}
+}
+
+static void
+prof_doc_footer(struct buf *ob, void *opaque)
+{
+	struct sd_profile *prof = opaque;
+
+	if (prof->cb.doc_footer) {
+		prof_enter(prof, ob);
+		prof->cb.doc_footer(ob, prof->opaque);
+		prof_leave(prof, PROF_DOC_FOOTER, ob);
+	}
+
+	prof->render_ns += sd_timer_ns() - prof->render_start;
+	prof->renders++;
+}
+
+/**********************
+ * EXPORTED FUNCTIONS *
+ **********************/
+
+struct sd_profile *
+sd_profile_callbacks(const struct sd_callbacks *inner, void *inner_opaque, struct sd_callbacks *outer)
+{
+	struct sd_profile *prof;
+
+	prof = calloc(1, sizeof(struct sd_profile));
+	if (!prof)
+		return NULL;
+
+	memcpy(&prof->cb, inner, sizeof(struct sd_callbacks));
+	prof->opaque = inner_opaque;
+
+	/* only wrap the callbacks which are set: NULL callbacks
+	 * change the behavior of the parser */
+	outer->blockcode = inner->blockcode ? prof_blockcode : NULL;
+	outer->blockquote = inner->blockquote ? prof_blockquote : NULL;
+	outer->blockhtml = inner->blockhtml ? prof_blockhtml : NULL;
+	outer->header = inner->header ? prof_header : NULL;
+	outer->hrule = inner->hrule ? prof_hrule : NULL;
+	outer->list = inner->list ? prof_list : NULL;
+	outer->listitem = inner->listitem ? prof_listitem : NULL;
+	outer->paragraph = inner->paragraph ? prof_paragraph : NULL;
+	outer->table = inner->table ? prof_table : NULL;
+	outer->table_row = inner->table_row ? prof_table_row : NULL;
+	outer->table_cell = inner->table_cell ? prof_table_cell : NULL;
+	outer->autolink = inner->autolink ? prof_autolink : NULL;
+	outer->codespan = inner->codespan ? prof_codespan : NULL;
+	outer->double_emphasis = inner->double_emphasis ? prof_double_emphasis : NULL;
+	outer->emphasis = inner->emphasis ? prof_emphasis : NULL;
+	outer->image = inner->image ? prof_image : NULL;
+	outer->linebreak = inner->linebreak ? prof_linebreak : NULL;
+	outer->link = inner->link ? prof_link : NULL;
+	outer->raw_html_tag = inner->raw_html_tag ? prof_raw_html_tag : NULL;
+	outer->triple_emphasis = inner->triple_emphasis ? prof_triple_emphasis : NULL;
+	outer->strikethrough = inner->strikethrough ? prof_strikethrough : NULL;
+	outer->superscript = inner->superscript ? prof_superscript : NULL;
+	outer->entity = inner->entity ? prof_entity : NULL;
+	outer->normal_text = inner->normal_text ? prof_normal_text : NULL;
+	outer->doc_header = prof_doc_header;
+	outer->doc_footer = prof_doc_footer;
+
+	return prof;
+}
+
+void
+sd_profile_report(struct buf *ob, const struct sd_profile *prof, enum sd_profile_format format)
+{
+	uint64_t callbacks_ns = 0, parser_ns = 0;
+	size_t i, n = 0;
+
+	for (i = 0; i < PROF_COUNT; ++i)
+		callbacks_ns += prof->entries[i].exclusive_ns;
+
+	if (prof->render_ns > callbacks_ns)
+		parser_ns = prof->render_ns - callbacks_ns;
+
+	if (format == SD_PROFILE_JSON) {
+		bufprintf(ob, "{\"renders\":%lu,\"render_ns\":%llu,\"callbacks_ns\":%llu,\"parser_ns\":%llu,\"callbacks\":[",
+			(unsigned long)prof->renders, (unsigned long long)prof->render_ns,
+			(unsigned long long)callbacks_ns, (unsigned long long)parser_ns);
+
+		for (i = 0; i < PROF_COUNT; ++i) {
+			const struct profile_entry *entry = &prof->entries[i];
+
+			if (!entry->calls)
+				continue;
+
+			bufprintf(ob, "%s{\"name\":\"%s\",\"calls\":%lu,\"inclusive_ns\":%llu,\"exclusive_ns\":%llu,\"bytes\":%lu}",
+				n++ ? "," : "", profile_names[i], (unsigned long)entry->calls,
+				(unsigned long long)entry->inclusive_ns, (unsigned long long)entry->exclusive_ns,
+				(unsigned long)entry->bytes);
+		}
+
+		BUFPUTSL(ob, "]}\n");
+		return;
+	}
+
+	bufprintf(ob, "%lu renders: %llu ns total, %llu ns in callbacks, %llu ns in the parser\n\n",
+		(unsigned long)prof->renders, (unsigned long long)prof->render_ns,
+		(unsigned long long)callbacks_ns, (unsigned long long)parser_ns);
+
+	bufprintf(ob, "%-16s %10s %14s %14s %12s\n",
+		"callback", "calls", "inclusive ns", "exclusive ns", "bytes");
+
+	for (i = 0; i < PROF_COUNT; ++i) {
+		const struct profile_entry *entry = &prof->entries[i];
+
+		if (!entry->calls)
+			continue;
+
+		bufprintf(ob, "%-16s %10lu %14llu %14llu %12lu\n",
+			profile_names[i], (unsigned long)entry->calls,
+			(unsigned long long)entry->inclusive_ns, (unsigned long long)entry->exclusive_ns,
+			(unsigned long)entry->bytes);
+	}
+}
+
+void
+sd_profile_reset(struct sd_profile *prof)
+{
+	memset(prof->entries, 0x0, sizeof(prof->entries));
+	prof->depth = 0;
+	prof->renders = 0;
+	prof->render_ns = 0;
+}
+
+void
+sd_profile_free(struct sd_profile *prof)
+{
+	free(prof);
+}
+
+/* vim: set filetype=c: */
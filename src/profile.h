@@ -0,0 +1,40 @@
+#ifndef UPSKIRT_PROFILE_H
+#define UPSKIRT_PROFILE_H
+
+#include "markdown.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum sd_profile_format {
+	SD_PROFILE_TEXT,
+	SD_PROFILE_JSON,
+};
+
+struct sd_profile;
+
+/* sd_profile_callbacks • fills `outer` with timing wrappers around every
+ * callback of `inner`. The returned profile must be given as the opaque
+ * pointer of sd_markdown_new; `inner_opaque` is handed to the wrapped
+ * callbacks. NULL callbacks stay NULL, so parsing is not altered */
+extern struct sd_profile *
+sd_profile_callbacks(const struct sd_callbacks *inner, void *inner_opaque, struct sd_callbacks *outer);
+
+/* sd_profile_report • writes the collected counters as text or JSON */
+extern void
+sd_profile_report(struct buf *ob, const struct sd_profile *prof, enum sd_profile_format format);
+
+extern void
+sd_profile_reset(struct sd_profile *prof);
+
+extern void
+sd_profile_free(struct sd_profile *prof);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/* vim: set filetype=c: */
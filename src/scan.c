@@ -0,0 +1,282 @@
+#include "scan.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#	define SCAN_X86 1
+#	include <immintrin.h>
+#	define SCAN_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+/* vector kernels only pay off past a few words */
+#define SCAN_MIN_VECTOR 16
+
+static const char *level_names[SD_SCAN_LEVELS] = {
+	"scalar", "sse2", "sse4.2", "avx2"
+};
+
+/******************
+ * KERNELS        *
+ ******************/
+
+static size_t
+scan_scalar(const uint8_t *data, size_t size, const struct sd_charset *set)
+{
+	const uint8_t *table = set->table;
+	size_t i = 0;
+
+	while (i < size && table[data[i]] == 0)
+		i++;
+
+	return i;
+}
+
+#ifdef SCAN_X86
+/* SSE2: one compare per member, 16 bytes at a time */
+SCAN_TARGET("sse2")
+static size_t
+scan_sse2(const uint8_t *data, size_t size, const struct sd_charset *set)
+{
+	__m128i needles[SD_CHARSET_MAX];
+	size_t i = 0, k, count = set->count;
+
+	if (count == 0 || size < SCAN_MIN_VECTOR)
+		return scan_scalar(data, size, set);
+
+	for (k = 0; k < count; ++k)
+		needles[k] = _mm_set1_epi8((char)set->chars[k]);
+
+	for (; i + 16 <= size; i += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *)(data + i));
+		__m128i hit = _mm_cmpeq_epi8(chunk, needles[0]);
+		int mask;
+
+		for (k = 1; k < count; ++k)
+			hit = _mm_or_si128(hit, _mm_cmpeq_epi8(chunk, needles[k]));
+
+		mask = _mm_movemask_epi8(hit);
+		if (mask)
+			return i + __builtin_ctz((unsigned int)mask);
+	}
+
+	return i + scan_scalar(data + i, size - i, set);
+}
+
+/* SSE4.2: pcmpestri matches all the members in one instruction */
+SCAN_TARGET("sse4.2")
+static size_t
+scan_sse42(const uint8_t *data, size_t size, const struct sd_charset *set)
+{
+	__m128i needles;
+	size_t i = 0;
+	int count = (int)set->count;
+
+	if (count == 0 || size < SCAN_MIN_VECTOR)
+		return scan_scalar(data, size, set);
+
+	needles = _mm_loadu_si128((const __m128i *)set->chars);
+
+	for (; i + 16 <= size; i += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *)(data + i));
+		int idx = _mm_cmpestri(needles, count, chunk, 16,
+			_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT);
+
+		if (idx < 16)
+			return i + idx;
+	}
+
+	return i + scan_scalar(data + i, size - i, set);
+}
+
+/* AVX2: each byte is classified by two nibble lookups, so the cost does
+ * not grow with the number of members. lo[n] holds one bit per high
+ * nibble (0-7) among the members whose low nibble is n; sets reaching
+ * past ASCII fall back to one compare per member */
+SCAN_TARGET("avx2")
+static size_t
+scan_avx2(const uint8_t *data, size_t size, const struct sd_charset *set)
+{
+	uint8_t lo[16];
+	__m256i lo_tab, hi_tab, nibble;
+	size_t i = 0, k, count = set->count;
+
+	if (count == 0 || size < 32)
+		return scan_scalar(data, size, set);
+
+	memset(lo, 0x0, sizeof(lo));
+
+	for (k = 0; k < count; ++k) {
+		uint8_t c = set->chars[k];
+
+		if (c & 0x80)
+			return scan_sse2(data, size, set);
+
+		lo[c & 0xf] |= (uint8_t)(1 << (c >> 4));
+	}
+
+	lo_tab = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)lo));
+	hi_tab = _mm256_setr_epi8(
+		1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0,
+		1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+	nibble = _mm256_set1_epi8(0xf);
+
+	for (; i + 32 <= size; i += 32) {
+		__m256i chunk = _mm256_loadu_si256((const __m256i *)(data + i));
+		__m256i lo_bits = _mm256_shuffle_epi8(lo_tab, _mm256_and_si256(chunk, nibble));
+		__m256i hi_bits = _mm256_shuffle_epi8(hi_tab,
+			_mm256_and_si256(_mm256_srli_epi16(chunk, 4), nibble));
+		__m256i miss = _mm256_cmpeq_epi8(
+			_mm256_and_si256(lo_bits, hi_bits), _mm256_setzero_si256());
+		unsigned int mask = ~(unsigned int)_mm256_movemask_epi8(miss);
+
+		if (mask)
+			return i + __builtin_ctz(mask);
+	}
+
+	return i + scan_scalar(data + i, size - i, set);
+}
+#endif
+
+/******************
+ * DISPATCH       *
+ ******************/
+
+static size_t scan_resolve(const uint8_t *data, size_t size, const struct sd_charset *set);
+
+sd_scan_fn sd_scan_impl = scan_resolve;
+
+static enum sd_scan_level scan_bound = SD_SCAN_SCALAR;
+
+/* spans between markdown triggers are short, and pcmpestri wins on them:
+ * AVX2 only breaks even, so it is used when asked for by name */
+#define SCAN_DEFAULT_LEVEL SD_SCAN_SSE42
+
+/* env_level • cap requested through SUNDOWN_SIMD */
+static enum sd_scan_level
+env_level(void)
+{
+	const char *env = getenv("SUNDOWN_SIMD");
+	int level;
+
+	if (!env)
+		return SCAN_DEFAULT_LEVEL;
+
+	for (level = 0; level < SD_SCAN_LEVELS; ++level) {
+		if (strcmp(env, level_names[level]) == 0)
+			return (enum sd_scan_level)level;
+	}
+
+	if (strcmp(env, "sse42") == 0)
+		return SD_SCAN_SSE42;
+
+	if (strcmp(env, "0") == 0 || strcmp(env, "none") == 0)
+		return SD_SCAN_SCALAR;
+
+	return SCAN_DEFAULT_LEVEL;
+}
+
+/* scan_resolve • first call: binds the kernel, then scans */
+static size_t
+scan_resolve(const uint8_t *data, size_t size, const struct sd_charset *set)
+{
+	sd_scan_set_level(env_level());
+	return SD_SCAN_LOAD(sd_scan_impl)(data, size, set);
+}
+
+enum sd_scan_level
+sd_scan_detect(void)
+{
+#ifdef SCAN_X86
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2"))
+		return SD_SCAN_AVX2;
+
+	if (__builtin_cpu_supports("sse4.2"))
+		return SD_SCAN_SSE42;
+
+	if (__builtin_cpu_supports("sse2"))
+		return SD_SCAN_SSE2;
+#endif
+
+	return SD_SCAN_SCALAR;
+}
+
+sd_scan_fn
+sd_scan_kernel(enum sd_scan_level level)
+{
+	if (level > sd_scan_detect())
+		return NULL;
+
+	switch (level) {
+	case SD_SCAN_SCALAR:
+		return scan_scalar;
+#ifdef SCAN_X86
+	case SD_SCAN_SSE2:
+		return scan_sse2;
+	case SD_SCAN_SSE42:
+		return scan_sse42;
+	case SD_SCAN_AVX2:
+		return scan_avx2;
+#endif
+	default:
+		return NULL;
+	}
+}
+
+enum sd_scan_level
+sd_scan_set_level(enum sd_scan_level level)
+{
+	enum sd_scan_level best = sd_scan_detect();
+	sd_scan_fn kernel;
+
+	if (level > best)
+		level = best;
+
+	while ((kernel = sd_scan_kernel(level)) == NULL)
+		level = (enum sd_scan_level)(level - 1);
+
+	SD_SCAN_STORE(scan_bound, level);
+	SD_SCAN_STORE(sd_scan_impl, kernel);
+	return level;
+}
+
+enum sd_scan_level
+sd_scan_level(void)
+{
+	if (SD_SCAN_LOAD(sd_scan_impl) == scan_resolve)
+		sd_scan_set_level(env_level());
+
+	return SD_SCAN_LOAD(scan_bound);
+}
+
+const char *
+sd_scan_level_name(enum sd_scan_level level)
+{
+	return (level < SD_SCAN_LEVELS) ? level_names[level] : "unknown";
+}
+
+void
+sd_charset_init(struct sd_charset *set, const uint8_t *table)
+{
+	size_t c;
+
+	memset(set, 0x0, sizeof(*set));
+	set->table = table;
+
+	for (c = 0; c < 256; ++c) {
+		if (!table[c])
+			continue;
+
+		if (set->count == SD_CHARSET_MAX) {
+			memset(set->chars, 0x0, sizeof(set->chars));
+			set->count = 0;
+			return;
+		}
+
+		set->chars[set->count++] = (uint8_t)c;
+	}
+}
+
+/* vim: set filetype=c: */
@@ -0,0 +1,103 @@
+#ifndef UPSKIRT_SCAN_H
+#define UPSKIRT_SCAN_H
+
+#include "buffer.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SD_CHARSET_MAX 16
+
+/* sd_charset • a set of bytes to stop at. The table is what the scalar
+ * kernel reads; the vector kernels compare against the member list, so
+ * both must describe the same set. Sets with more than SD_CHARSET_MAX
+ * members have count = 0 and are always scanned by the scalar kernel */
+struct sd_charset {
+	const uint8_t *table;		/* 256 entries, nonzero for members */
+	uint8_t chars[SD_CHARSET_MAX];	/* members, zero padded */
+	size_t count;
+};
+
+enum sd_scan_level {
+	SD_SCAN_SCALAR,
+	SD_SCAN_SSE2,
+	SD_SCAN_SSE42,
+	SD_SCAN_AVX2,
+	SD_SCAN_LEVELS
+};
+
+typedef size_t (*sd_scan_fn)(const uint8_t *data, size_t size, const struct sd_charset *set);
+
+/* the kernel in use, bound on first call. Renders on other threads may
+ * bind it at the same time, so it is only read and written atomically */
+extern sd_scan_fn sd_scan_impl;
+
+#if defined(__GNUC__) || defined(__clang__)
+#	define SD_SCAN_LOAD(var) __atomic_load_n(&(var), __ATOMIC_RELAXED)
+#	define SD_SCAN_STORE(var, value) __atomic_store_n(&(var), (value), __ATOMIC_RELAXED)
+#else
+	/* aligned pointer-sized accesses do not tear on the other targets */
+#	define SD_SCAN_LOAD(var) (var)
+#	define SD_SCAN_STORE(var, value) ((var) = (value))
+#endif
+
+/* bytes checked inline before handing the rest to the kernel: most spans
+ * between markdown triggers are shorter than this */
+#define SD_SCAN_HEAD 16
+
+/* sd_scan • offset of the first member of `set` in data, or size */
+static inline size_t
+sd_scan(const uint8_t *data, size_t size, const struct sd_charset *set)
+{
+	size_t i = 0, head = size < SD_SCAN_HEAD ? size : SD_SCAN_HEAD;
+
+	while (i < head) {
+		if (set->table[data[i]])
+			return i;
+		i++;
+	}
+
+	if (i == size)
+		return i;
+
+	return i + SD_SCAN_LOAD(sd_scan_impl)(data + i, size - i, set);
+}
+
+/* sd_charset_init • fills the member list from a 256-entry table */
+extern void
+sd_charset_init(struct sd_charset *set, const uint8_t *table);
+
+/* sd_scan_detect • highest level supported by both the build and the CPU */
+extern enum sd_scan_level
+sd_scan_detect(void);
+
+/* sd_scan_level • level of the kernel in use */
+extern enum sd_scan_level
+sd_scan_level(void);
+
+/* sd_scan_set_level • binds the best kernel up to `level`; SD_SCAN_SCALAR
+ * forces the portable path. Returns the level bound. The SUNDOWN_SIMD
+ * environment variable ("scalar", "sse2", "sse4.2" or "avx2") sets the
+ * initial cap, which defaults to SD_SCAN_SSE42. Every kernel finds the
+ * same offsets, so renders on other threads may go on meanwhile */
+extern enum sd_scan_level
+sd_scan_set_level(enum sd_scan_level level);
+
+/* sd_scan_kernel • the kernel of one level, NULL when unavailable */
+extern sd_scan_fn
+sd_scan_kernel(enum sd_scan_level level);
+
+extern const char *
+sd_scan_level_name(enum sd_scan_level level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/* vim: set filetype=c: */
@@ -0,0 +1,38 @@
+#ifndef TIMER_H__
+#define TIMER_H__
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#	include <windows.h>
+#else
+#	include <time.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* sd_timer_ns • monotonic clock reading, in nanoseconds */
+static inline uint64_t
+sd_timer_ns(void)
+{
+#if defined(_WIN32)
+	LARGE_INTEGER freq, now;
+
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&now);
+	return (uint64_t)((double)now.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
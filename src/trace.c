@@ -0,0 +1,943 @@
+#include "trace.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TRACE_MAGIC "SDTRACE"
+#define TRACE_VERSION 1
+
+/* the parser only edits its buffers near their end: bytes further back
+ * than this from the last known size are assumed untouched */
+#define TRACE_WINDOW 4096
+
+/* upper bound on the live buffers of a single render */
+#define TRACE_MAX_SLOTS 4096
+
+/* opcodes below TRACE_CALLBACKS are callbacks, in sd_callbacks order */
+enum trace_op {
+	OP_BLOCKCODE,
+	OP_BLOCKQUOTE,
+	OP_BLOCKHTML,
+	OP_HEADER,
+	OP_HRULE,
+	OP_LIST,
+	OP_LISTITEM,
+	OP_PARAGRAPH,
+	OP_TABLE,
+	OP_TABLE_ROW,
+	OP_TABLE_CELL,
+	OP_AUTOLINK,
+	OP_CODESPAN,
+	OP_DOUBLE_EMPHASIS,
+	OP_EMPHASIS,
+	OP_IMAGE,
+	OP_LINEBREAK,
+	OP_LINK,
+	OP_RAW_HTML_TAG,
+	OP_TRIPLE_EMPHASIS,
+	OP_STRIKETHROUGH,
+	OP_SUPERSCRIPT,
+	OP_ENTITY,
+	OP_NORMAL_TEXT,
+	OP_DOC_HEADER,
+	OP_DOC_FOOTER,
+	TRACE_CALLBACKS,
+
+	OP_BEGIN = 0x40,	/* new render, slot 0 is the output */
+	OP_END,			/* end of render */
+	OP_CLEAR,		/* slot: empty the buffer */
+	OP_TRUNC,		/* slot, n: drop the last n bytes */
+	OP_RAW,			/* slot, n, bytes: append bytes written by the parser */
+};
+
+/* buffer arguments: NULL, a literal slice of the source, or a slot */
+enum trace_arg {
+	ARG_NULL,
+	ARG_LITERAL,
+	ARG_SLOT,
+};
+
+struct trace_slot {
+	const struct buf *buf;
+	struct buf *shadow;
+};
+
+struct sd_trace {
+	struct sd_callbacks cb;
+	void *opaque;
+	struct buf *out;
+
+	struct trace_slot *slots;
+	size_t slot_count;
+	size_t slot_size;
+};
+
+/********************
+ * RECORDING HELPERS *
+ ********************/
+
+static void
+put_varint(struct buf *out, size_t v)
+{
+	while (v >= 0x80) {
+		bufputc(out, (int)((v & 0x7f) | 0x80));
+		v >>= 7;
+	}
+
+	bufputc(out, (int)v);
+}
+
+/* trace_slot • returns the slot tracking `buf`, allocating it if needed */
+static size_t
+trace_slot(struct sd_trace *rec, const struct buf *buf)
+{
+	size_t i;
+
+	for (i = 0; i < rec->slot_count; ++i) {
+		if (rec->slots[i].buf == buf)
+			return i;
+	}
+
+	if (rec->slot_count == rec->slot_size) {
+		size_t new_size = rec->slot_size ? rec->slot_size * 2 : 16;
+		struct trace_slot *new_slots;
+
+		new_slots = realloc(rec->slots, new_size * sizeof(struct trace_slot));
+		if (!new_slots)
+			abort();
+
+		memset(new_slots + rec->slot_size, 0x0,
+			(new_size - rec->slot_size) * sizeof(struct trace_slot));
+
+		rec->slots = new_slots;
+		rec->slot_size = new_size;
+	}
+
+	/* shadows are kept across renders and reused */
+	if (!rec->slots[i].shadow)
+		rec->slots[i].shadow = bufnew(64);
+
+	rec->slots[i].buf = buf;
+	rec->slots[i].shadow->size = 0;
+	rec->slot_count++;
+
+	return i;
+}
+
+/* trace_sync • records what the parser wrote to `buf` since the trace
+ * last saw it, and returns its slot */
+static size_t
+trace_sync(struct sd_trace *rec, const struct buf *buf)
+{
+	size_t slot = trace_slot(rec, buf);
+	struct buf *shadow = rec->slots[slot].shadow;
+	size_t common, prefix;
+
+	common = buf->size < shadow->size ? buf->size : shadow->size;
+	prefix = common > TRACE_WINDOW ? common - TRACE_WINDOW : 0;
+
+	while (prefix < common && buf->data[prefix] == shadow->data[prefix])
+		prefix++;
+
+	if (prefix < shadow->size) {
+		if (prefix == 0) {
+			bufputc(rec->out, OP_CLEAR);
+			put_varint(rec->out, slot);
+		} else {
+			bufputc(rec->out, OP_TRUNC);
+			put_varint(rec->out, slot);
+			put_varint(rec->out, shadow->size - prefix);
+		}
+
+		shadow->size = prefix;
+	}
+
+	if (buf->size > prefix) {
+		bufputc(rec->out, OP_RAW);
+		put_varint(rec->out, slot);
+		put_varint(rec->out, buf->size - prefix);
+		bufput(rec->out, buf->data + prefix, buf->size - prefix);
+		bufput(shadow, buf->data + prefix, buf->size - prefix);
+	}
+
+	return slot;
+}
+
+/* trace_arg • records a buffer argument. Buffers which cannot grow are
+ * slices of the source and are stored inline */
+static void
+trace_arg(struct sd_trace *rec, const struct buf *buf)
+{
+	if (!buf) {
+		put_varint(rec->out, ARG_NULL);
+	} else if (buf->unit == 0) {
+		put_varint(rec->out, ARG_LITERAL);
+		put_varint(rec->out, buf->size);
+		bufput(rec->out, buf->data, buf->size);
+	} else {
+		put_varint(rec->out, ARG_SLOT + trace_slot(rec, buf));
+	}
+}
+
+/* trace_call • starts a callback record with its `argc` buffer arguments.
+ * All the buffers are synced first, so the record is contiguous */
+static void
+trace_call(struct sd_trace *rec, int op, const struct buf *ob, int argc,
+	const struct buf *a, const struct buf *b, const struct buf *c)
+{
+	const struct buf *args[3];
+	size_t slot;
+	int i;
+
+	args[0] = a;
+	args[1] = b;
+	args[2] = c;
+
+	slot = trace_sync(rec, ob);
+
+	for (i = 0; i < argc; ++i) {
+		if (args[i] && args[i]->unit != 0)
+			trace_sync(rec, args[i]);
+	}
+
+	bufputc(rec->out, op);
+	put_varint(rec->out, slot);
+
+	for (i = 0; i < argc; ++i)
+		trace_arg(rec, args[i]);
+}
+
+/* trace_done • takes in the bytes the renderer appended to `ob` */
+static void
+trace_done(struct sd_trace *rec, const struct buf *ob)
+{
+	struct buf *shadow = rec->slots[trace_slot(rec, ob)].shadow;
+
+	if (ob->size < shadow->size)
+		shadow->size = ob->size;
+	else
+		bufput(shadow, ob->data + shadow->size, ob->size - shadow->size);
+}
+
+/***********************
+ * CALLBACK WRAPPERS *
+ ***********************/
+
+static void
+trace_blockcode(struct buf *ob, const struct buf *text, const struct buf *lang, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_BLOCKCODE, ob, 2, text, lang, NULL);
+	rec->cb.blockcode(ob, text, lang, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_blockquote(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_BLOCKQUOTE, ob, 1, text, NULL, NULL);
+	rec->cb.blockquote(ob, text, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_blockhtml(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_BLOCKHTML, ob, 1, text, NULL, NULL);
+	rec->cb.blockhtml(ob, text, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_HEADER, ob, 1, text, NULL, NULL);
+	put_varint(rec->out, (size_t)level);
+	rec->cb.header(ob, text, level, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_hrule(struct buf *ob, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_HRULE, ob, 0, NULL, NULL, NULL);
+	rec->cb.hrule(ob, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_list(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_LIST, ob, 1, text, NULL, NULL);
+	put_varint(rec->out, (size_t)flags);
+	rec->cb.list(ob, text, flags, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_listitem(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_LISTITEM, ob, 1, text, NULL, NULL);
+	put_varint(rec->out, (size_t)flags);
+	rec->cb.listitem(ob, text, flags, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_paragraph(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_PARAGRAPH, ob, 1, text, NULL, NULL);
+	rec->cb.paragraph(ob, text, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_table(struct buf *ob, const struct buf *header, const struct buf *body, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_TABLE, ob, 2, header, body, NULL);
+	rec->cb.table(ob, header, body, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_table_row(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_TABLE_ROW, ob, 1, text, NULL, NULL);
+	rec->cb.table_row(ob, text, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_table_cell(struct buf *ob, const struct buf *text, int flags, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_TABLE_CELL, ob, 1, text, NULL, NULL);
+	put_varint(rec->out, (size_t)flags);
+	rec->cb.table_cell(ob, text, flags, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static int
+trace_autolink(struct buf *ob, const struct buf *link, enum mkd_autolink type, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_AUTOLINK, ob, 1, link, NULL, NULL);
+	put_varint(rec->out, (size_t)type);
+	r = rec->cb.autolink(ob, link, type, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_codespan(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_CODESPAN, ob, 1, text, NULL, NULL);
+	r = rec->cb.codespan(ob, text, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_double_emphasis(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_DOUBLE_EMPHASIS, ob, 1, text, NULL, NULL);
+	r = rec->cb.double_emphasis(ob, text, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_emphasis(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_EMPHASIS, ob, 1, text, NULL, NULL);
+	r = rec->cb.emphasis(ob, text, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_image(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *alt, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_IMAGE, ob, 3, link, title, alt);
+	r = rec->cb.image(ob, link, title, alt, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_linebreak(struct buf *ob, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_LINEBREAK, ob, 0, NULL, NULL, NULL);
+	r = rec->cb.linebreak(ob, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_link(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_LINK, ob, 3, link, title, content);
+	r = rec->cb.link(ob, link, title, content, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_raw_html_tag(struct buf *ob, const struct buf *tag, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_RAW_HTML_TAG, ob, 1, tag, NULL, NULL);
+	r = rec->cb.raw_html_tag(ob, tag, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_triple_emphasis(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_TRIPLE_EMPHASIS, ob, 1, text, NULL, NULL);
+	r = rec->cb.triple_emphasis(ob, text, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_strikethrough(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_STRIKETHROUGH, ob, 1, text, NULL, NULL);
+	r = rec->cb.strikethrough(ob, text, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static int
+trace_superscript(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	int r;
+	trace_call(rec, OP_SUPERSCRIPT, ob, 1, text, NULL, NULL);
+	r = rec->cb.superscript(ob, text, rec->opaque);
+	trace_done(rec, ob);
+	return r;
+}
+
+static void
+trace_entity(struct buf *ob, const struct buf *entity, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_ENTITY, ob, 1, entity, NULL, NULL);
+	rec->cb.entity(ob, entity, rec->opaque);
+	trace_done(rec, ob);
+}
+
+static void
+trace_normal_text(struct buf *ob, const struct buf *text, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+	trace_call(rec, OP_NORMAL_TEXT, ob, 1, text, NULL, NULL);
+	rec->cb.normal_text(ob, text, rec->opaque);
+	trace_done(rec, ob);
+}
+
+/* the document header and footer are always wrapped: they delimit each
+ * render in the trace, and the output buffer becomes slot 0 */
+static void
+trace_doc_header(struct buf *ob, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+
+	rec->slot_count = 0;
+	trace_slot(rec, ob);
+	if (ob->size)
+		bufput(rec->slots[0].shadow, ob->data, ob->size);
+
+	bufputc(rec->out, OP_BEGIN);
+
+	if (rec->cb.doc_header) {
+		trace_call(rec, OP_DOC_HEADER, ob, 0, NULL, NULL, NULL);
+		rec->cb.doc_header(ob, rec->opaque);
+		trace_done(rec, ob);
+	}
+}
+
+static void
+trace_doc_footer(struct buf *ob, void *opaque)
+{
+	struct sd_trace *rec = opaque;
+
+	if (rec->cb.doc_footer) {
+		trace_call(rec, OP_DOC_FOOTER, ob, 0, NULL, NULL, NULL);
+		rec->cb.doc_footer(ob, rec->opaque);
+		trace_done(rec, ob);
+	} else {
+		trace_sync(rec, ob);
+	}
+
+	bufputc(rec->out, OP_END);
+}
+
+/*********************
+ * REPLAY            *
+ *********************/
+
+struct trace_reader {
+	const uint8_t *data;
+	size_t size;
+	size_t pos;
+
+	struct buf **slots;
+	size_t slot_size;
+
+	/* inline arguments of the current call */
+	struct buf literals[3];
+	size_t literal_count;
+};
+
+static int
+get_varint(struct trace_reader *rd, size_t *v)
+{
+	size_t result = 0;
+	unsigned int shift = 0;
+
+	while (rd->pos < rd->size && shift < sizeof(size_t) * 8) {
+		uint8_t c = rd->data[rd->pos++];
+
+		result |= (size_t)(c & 0x7f) << shift;
+		if ((c & 0x80) == 0) {
+			*v = result;
+			return 0;
+		}
+
+		shift += 7;
+	}
+
+	return -1;
+}
+
+/* get_slot • resolves a slot index, allocating the buffer on first use */
+static struct buf *
+get_slot(struct trace_reader *rd, size_t slot)
+{
+	if (slot >= TRACE_MAX_SLOTS)
+		return NULL;
+
+	if (slot >= rd->slot_size) {
+		size_t new_size = rd->slot_size ? rd->slot_size * 2 : 16;
+		struct buf **new_slots;
+
+		while (new_size <= slot)
+			new_size *= 2;
+
+		new_slots = realloc(rd->slots, new_size * sizeof(struct buf *));
+		if (!new_slots)
+			return NULL;
+
+		memset(new_slots + rd->slot_size, 0x0,
+			(new_size - rd->slot_size) * sizeof(struct buf *));
+
+		rd->slots = new_slots;
+		rd->slot_size = new_size;
+	}
+
+	if (!rd->slots[slot])
+		rd->slots[slot] = bufnew(64);
+
+	return rd->slots[slot];
+}
+
+static int
+get_ob(struct trace_reader *rd, struct buf **ob)
+{
+	size_t slot;
+
+	if (get_varint(rd, &slot) < 0)
+		return -1;
+
+	*ob = get_slot(rd, slot);
+	return *ob ? 0 : -1;
+}
+
+/* get_arg • reads a buffer argument of a callback writing to `ob`. Only
+ * the arguments the parser may pass as NULL (`nullable`) accept
+ * ARG_NULL, and none may be `ob` itself: callbacks read their arguments
+ * while appending to it */
+static int
+get_arg(struct trace_reader *rd, const struct buf *ob, const struct buf **arg, int nullable)
+{
+	size_t tag, len;
+	struct buf *lit;
+
+	if (get_varint(rd, &tag) < 0)
+		return -1;
+
+	if (tag == ARG_NULL) {
+		*arg = NULL;
+		return nullable ? 0 : -1;
+	}
+
+	if (tag >= ARG_SLOT) {
+		*arg = get_slot(rd, tag - ARG_SLOT);
+		return (*arg && *arg != ob) ? 0 : -1;
+	}
+
+	if (get_varint(rd, &len) < 0 || len > rd->size - rd->pos ||
+		rd->literal_count == 3)
+		return -1;
+
+	lit = &rd->literals[rd->literal_count++];
+	lit->data = (uint8_t *)rd->data + rd->pos;
+	lit->size = len;
+	lit->asize = 0;
+	lit->unit = 1;	/* never grown, but bufprefix asserts a unit */
+
+	rd->pos += len;
+	*arg = lit;
+	return 0;
+}
+
+static int
+get_int(struct trace_reader *rd, int *v)
+{
+	size_t value;
+
+	if (get_varint(rd, &value) < 0)
+		return -1;
+
+	*v = (int)value;
+	return 0;
+}
+
+/* replay_call • reads the arguments of a callback record and invokes it */
+static int
+replay_call(struct trace_reader *rd, int op, const struct sd_callbacks *cb, void *opaque)
+{
+	const struct buf *a = NULL, *b = NULL, *c = NULL;
+	struct buf *ob;
+	int i = 0;
+
+	rd->literal_count = 0;
+
+	if (get_ob(rd, &ob) < 0)
+		return -1;
+
+	switch (op) {
+	case OP_BLOCKCODE:
+		if (get_arg(rd, ob, &a, 0) < 0 || get_arg(rd, ob, &b, 1) < 0) return -1;
+		if (cb->blockcode) cb->blockcode(ob, a, b, opaque);
+		break;
+
+	case OP_BLOCKQUOTE:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->blockquote) cb->blockquote(ob, a, opaque);
+		break;
+
+	case OP_BLOCKHTML:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->blockhtml) cb->blockhtml(ob, a, opaque);
+		break;
+
+	case OP_HEADER:
+		if (get_arg(rd, ob, &a, 0) < 0 || get_int(rd, &i) < 0) return -1;
+		if (cb->header) cb->header(ob, a, i, opaque);
+		break;
+
+	case OP_HRULE:
+		if (cb->hrule) cb->hrule(ob, opaque);
+		break;
+
+	case OP_LIST:
+		if (get_arg(rd, ob, &a, 0) < 0 || get_int(rd, &i) < 0) return -1;
+		if (cb->list) cb->list(ob, a, i, opaque);
+		break;
+
+	case OP_LISTITEM:
+		if (get_arg(rd, ob, &a, 0) < 0 || get_int(rd, &i) < 0) return -1;
+		if (cb->listitem) cb->listitem(ob, a, i, opaque);
+		break;
+
+	case OP_PARAGRAPH:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->paragraph) cb->paragraph(ob, a, opaque);
+		break;
+
+	case OP_TABLE:
+		if (get_arg(rd, ob, &a, 0) < 0 || get_arg(rd, ob, &b, 0) < 0) return -1;
+		if (cb->table) cb->table(ob, a, b, opaque);
+		break;
+
+	case OP_TABLE_ROW:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->table_row) cb->table_row(ob, a, opaque);
+		break;
+
+	case OP_TABLE_CELL:
+		if (get_arg(rd, ob, &a, 0) < 0 || get_int(rd, &i) < 0) return -1;
+		if (cb->table_cell) cb->table_cell(ob, a, i, opaque);
+		break;
+
+	case OP_AUTOLINK:
+		if (get_arg(rd, ob, &a, 0) < 0 || get_int(rd, &i) < 0) return -1;
+		if (cb->autolink) cb->autolink(ob, a, (enum mkd_autolink)i, opaque);
+		break;
+
+	case OP_CODESPAN:
+		if (get_arg(rd, ob, &a, 1) < 0) return -1;
+		if (cb->codespan) cb->codespan(ob, a, opaque);
+		break;
+
+	case OP_DOUBLE_EMPHASIS:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->double_emphasis) cb->double_emphasis(ob, a, opaque);
+		break;
+
+	case OP_EMPHASIS:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->emphasis) cb->emphasis(ob, a, opaque);
+		break;
+
+	case OP_IMAGE:
+		if (get_arg(rd, ob, &a, 1) < 0 || get_arg(rd, ob, &b, 1) < 0 || get_arg(rd, ob, &c, 1) < 0) return -1;
+		if (cb->image) cb->image(ob, a, b, c, opaque);
+		break;
+
+	case OP_LINEBREAK:
+		if (cb->linebreak) cb->linebreak(ob, opaque);
+		break;
+
+	case OP_LINK:
+		if (get_arg(rd, ob, &a, 1) < 0 || get_arg(rd, ob, &b, 1) < 0 || get_arg(rd, ob, &c, 1) < 0) return -1;
+		if (cb->link) cb->link(ob, a, b, c, opaque);
+		break;
+
+	case OP_RAW_HTML_TAG:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->raw_html_tag) cb->raw_html_tag(ob, a, opaque);
+		break;
+
+	case OP_TRIPLE_EMPHASIS:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->triple_emphasis) cb->triple_emphasis(ob, a, opaque);
+		break;
+
+	case OP_STRIKETHROUGH:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->strikethrough) cb->strikethrough(ob, a, opaque);
+		break;
+
+	case OP_SUPERSCRIPT:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->superscript) cb->superscript(ob, a, opaque);
+		break;
+
+	case OP_ENTITY:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->entity) cb->entity(ob, a, opaque);
+		break;
+
+	case OP_NORMAL_TEXT:
+		if (get_arg(rd, ob, &a, 0) < 0) return -1;
+		if (cb->normal_text) cb->normal_text(ob, a, opaque);
+		break;
+
+	case OP_DOC_HEADER:
+		if (cb->doc_header) cb->doc_header(ob, opaque);
+		break;
+
+	case OP_DOC_FOOTER:
+		if (cb->doc_footer) cb->doc_footer(ob, opaque);
+		break;
+
+	default:
+		return -1;
+	}
+
+	return 0;
+}
+
+/* replay_op • applies the next record of the trace */
+static int
+replay_op(struct trace_reader *rd, struct buf *ob, const struct sd_callbacks *cb, void *opaque)
+{
+	int op = rd->data[rd->pos++];
+	size_t slot, len, i;
+	struct buf *work;
+
+	if (op < TRACE_CALLBACKS)
+		return replay_call(rd, op, cb, opaque);
+
+	switch (op) {
+	case OP_BEGIN:
+		/* slot 0 is the caller's buffer, the others
+		 * start each render empty */
+		if (!get_slot(rd, 0))
+			return -1;
+
+		if (rd->slots[0] != ob) {
+			bufrelease(rd->slots[0]);
+			rd->slots[0] = ob;
+		}
+
+		for (i = 1; i < rd->slot_size; ++i) {
+			if (rd->slots[i])
+				rd->slots[i]->size = 0;
+		}
+		return 0;
+
+	case OP_END:
+		return 0;
+
+	case OP_CLEAR:
+		if (get_varint(rd, &slot) < 0 || (work = get_slot(rd, slot)) == NULL)
+			return -1;
+
+		work->size = 0;
+		return 0;
+
+	case OP_TRUNC:
+		if (get_varint(rd, &slot) < 0 || get_varint(rd, &len) < 0 ||
+			(work = get_slot(rd, slot)) == NULL)
+			return -1;
+
+		work->size = len < work->size ? work->size - len : 0;
+		return 0;
+
+	case OP_RAW:
+		if (get_varint(rd, &slot) < 0 || get_varint(rd, &len) < 0 ||
+			len > rd->size - rd->pos || (work = get_slot(rd, slot)) == NULL)
+			return -1;
+
+		bufput(work, rd->data + rd->pos, len);
+		rd->pos += len;
+		return 0;
+	}
+
+	return -1;
+}
+
+/**********************
+ * EXPORTED FUNCTIONS *
+ **********************/
+
+struct sd_trace *
+sd_trace_callbacks(const struct sd_callbacks *inner, void *inner_opaque, struct sd_callbacks *outer, struct buf *trace)
+{
+	struct sd_trace *rec;
+
+	rec = calloc(1, sizeof(struct sd_trace));
+	if (!rec)
+		return NULL;
+
+	memcpy(&rec->cb, inner, sizeof(struct sd_callbacks));
+	rec->opaque = inner_opaque;
+	rec->out = trace;
+
+	bufputs(trace, TRACE_MAGIC);
+	bufputc(trace, TRACE_VERSION);
+
+	/* only wrap the callbacks which are set: NULL callbacks
+	 * change the behavior of the parser */
+	outer->blockcode = inner->blockcode ? trace_blockcode : NULL;
+	outer->blockquote = inner->blockquote ? trace_blockquote : NULL;
+	outer->blockhtml = inner->blockhtml ? trace_blockhtml : NULL;
+	outer->header = inner->header ? trace_header : NULL;
+	outer->hrule = inner->hrule ? trace_hrule : NULL;
+	outer->list = inner->list ? trace_list : NULL;
+	outer->listitem = inner->listitem ? trace_listitem : NULL;
+	outer->paragraph = inner->paragraph ? trace_paragraph : NULL;
+	outer->table = inner->table ? trace_table : NULL;
+	outer->table_row = inner->table_row ? trace_table_row : NULL;
+	outer->table_cell = inner->table_cell ? trace_table_cell : NULL;
+	outer->autolink = inner->autolink ? trace_autolink : NULL;
+	outer->codespan = inner->codespan ? trace_codespan : NULL;
+	outer->double_emphasis = inner->double_emphasis ? trace_double_emphasis : NULL;
+	outer->emphasis = inner->emphasis ? trace_emphasis : NULL;
+	outer->image = inner->image ? trace_image : NULL;
+	outer->linebreak = inner->linebreak ? trace_linebreak : NULL;
+	outer->link = inner->link ? trace_link : NULL;
+	outer->raw_html_tag = inner->raw_html_tag ? trace_raw_html_tag : NULL;
+	outer->triple_emphasis = inner->triple_emphasis ? trace_triple_emphasis : NULL;
+	outer->strikethrough = inner->strikethrough ? trace_strikethrough : NULL;
+	outer->superscript = inner->superscript ? trace_superscript : NULL;
+	outer->entity = inner->entity ? trace_entity : NULL;
+	outer->normal_text = inner->normal_text ? trace_normal_text : NULL;
+	outer->doc_header = trace_doc_header;
+	outer->doc_footer = trace_doc_footer;
+
+	return rec;
+}
+
+void
+sd_trace_free(struct sd_trace *rec)
+{
+	size_t i;
+
+	for (i = 0; i < rec->slot_size; ++i)
+		bufrelease(rec->slots[i].shadow);
+
+	free(rec->slots);
+	free(rec);
+}
+
+int
+sd_trace_replay(struct buf *ob, const uint8_t *data, size_t size, const struct sd_callbacks *callbacks, void *opaque)
+{
+	static const size_t header_len = sizeof(TRACE_MAGIC);
+	struct trace_reader rd;
+	int status = SD_TRACE_OK;
+	size_t i;
+
+	if (size < header_len || memcmp(data, TRACE_MAGIC, header_len - 1) != 0)
+		return SD_TRACE_EINVAL;
+
+	if (data[header_len - 1] != TRACE_VERSION)
+		return SD_TRACE_EVERSION;
+
+	memset(&rd, 0x0, sizeof(rd));
+	rd.data = data;
+	rd.size = size;
+	rd.pos = header_len;
+
+	while (rd.pos < rd.size) {
+		if (replay_op(&rd, ob, callbacks, opaque) < 0) {
+			status = SD_TRACE_EINVAL;
+			break;
+		}
+	}
+
+	for (i = 0; i < rd.slot_size; ++i) {
+		if (rd.slots[i] != ob)
+			bufrelease(rd.slots[i]);
+	}
+
+	free(rd.slots);
+	return status;
+}
+
+/* vim: set filetype=c: */
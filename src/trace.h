@@ -0,0 +1,47 @@
+#ifndef UPSKIRT_TRACE_H
+#define UPSKIRT_TRACE_H
+
+#include "markdown.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum sd_trace_status {
+	SD_TRACE_OK = 0,
+	SD_TRACE_EINVAL = -1,
+	SD_TRACE_EVERSION = -2,
+};
+
+struct sd_trace;
+
+/* sd_trace_callbacks • fills `outer` with recording wrappers around every
+ * callback of `inner`. Each invocation, with its arguments and the bytes the
+ * parser wrote to its buffers in between, is appended to `trace`. The
+ * returned recorder must be given as the opaque pointer of sd_markdown_new;
+ * `inner_opaque` is handed to the wrapped callbacks */
+extern struct sd_trace *
+sd_trace_callbacks(const struct sd_callbacks *inner, void *inner_opaque, struct sd_callbacks *outer, struct buf *trace);
+
+extern void
+sd_trace_free(struct sd_trace *rec);
+
+/* sd_trace_replay • drives `callbacks` from a recorded trace, without
+ * running the parser. Callbacks missing from the table are skipped. The
+ * parse is fixed at record time: the output matches a real render only
+ * when the table sets the same callbacks as the recorded one and they
+ * accept the same spans. Malformed records are rejected, as are
+ * arguments the parser never passes: NULL where it always passes a
+ * buffer, or the buffer the callback writes to. Otherwise arguments are
+ * handed to the callbacks as recorded: only replay trusted traces.
+ * Returns SD_TRACE_OK or a negative status */
+extern int
+sd_trace_replay(struct buf *ob, const uint8_t *data, size_t size, const struct sd_callbacks *callbacks, void *opaque);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/* vim: set filetype=c: */
@@ -0,0 +1,594 @@
+/* check • regression checks for the library; exits non-zero on failure */
+
+#include "markdown.h"
+#include "html.h"
+#include "text.h"
+#include "timer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int failures;
+
+static void
+check(int ok, const char *name)
+{
+	if (!ok) {
+		fprintf(stderr, "FAIL %s\n", name);
+		failures++;
+	}
+}
+
+static int
+contains(const struct buf *ob, const char *needle)
+{
+	size_t n = strlen(needle), i;
+
+	for (i = 0; i + n <= ob->size; ++i)
+		if (memcmp(ob->data + i, needle, n) == 0)
+			return 1;
+
+	return 0;
+}
+
+/* repeat • `count` copies of `unit` */
+static struct buf *
+repeat(const char *unit, size_t count)
+{
+	struct buf *ib = bufnew(1024);
+
+	while (count--)
+		bufputs(ib, unit);
+
+	return ib;
+}
+
+/* budget_inline • a budget running out inside a span drops the rest of
+ * it instead of copying its markdown and HTML as they are */
+static void
+budget_inline(void)
+{
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_budget budget = { 64, 0, 0 };
+	struct sd_markdown *md;
+	struct buf *ib, *ob;
+	int pass, ret;
+
+	ib = repeat("*e* ", 200);
+	bufputs(ib, "<script>alert(1)</script> **end**\n");
+
+	for (pass = 0; pass < 2; ++pass) {
+		ob = bufnew(1024);
+		sdhtml_renderer(&callbacks, &options, 0);
+
+		/* without normal_text, text used to be copied as is */
+		if (pass)
+			callbacks.normal_text = NULL;
+
+		md = sd_markdown_new(0, 16, &callbacks, &options);
+		sd_markdown_set_budget(md, &budget);
+		ret = sd_markdown_render(ob, ib->data, ib->size, md);
+
+		check(ret == MKD_RENDER_TRUNCATED, "budget_inline: truncated");
+		check(!contains(ob, "<script>"), "budget_inline: raw HTML");
+		check(!contains(ob, "*e*"), "budget_inline: raw emphasis");
+		check(!contains(ob, "**end**"), "budget_inline: raw strong");
+
+		sd_markdown_free(md);
+		bufrelease(ob);
+	}
+
+	bufrelease(ib);
+}
+
+/* budget_output • max_output also holds within one large block, where
+ * the output stays in work buffers until the block closes */
+static void
+budget_output(void)
+{
+	static const char *units[] = { "*a* ", "> > > *a*\n", "* *a*\n  * *a*\n" };
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_budget budget = { 0, 4096, 0 };
+	struct sd_markdown *md;
+	struct buf *ib, *ob;
+	size_t i;
+	int ret;
+
+	sdhtml_renderer(&callbacks, &options, 0);
+	md = sd_markdown_new(0, 16, &callbacks, &options);
+	sd_markdown_set_budget(md, &budget);
+
+	for (i = 0; i < sizeof(units) / sizeof(units[0]); ++i) {
+		ib = repeat(units[i], 50000);
+		ob = bufnew(1024);
+		ret = sd_markdown_render(ob, ib->data, ib->size, md);
+
+		check(ret == MKD_RENDER_TRUNCATED, "budget_output: truncated");
+		check(ob->size < 4 * 4096, "budget_output: overshoot");
+
+		bufrelease(ob);
+		bufrelease(ib);
+	}
+
+	sd_markdown_free(md);
+}
+
+/* budget_time • the deadline holds when every step scans the rest of
+ * the document: 1.2MB of '*a ' or '[a ' used to return 0.6-1.6s after a
+ * 10ms deadline */
+static void
+budget_time(void)
+{
+	static const char *units[] = { "*a ", "[a ", "<div>\n\n" };
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_budget budget = { 0, 0, 10000 };
+	struct sd_markdown *md;
+	struct buf *ib, *ob;
+	uint64_t start;
+	size_t i;
+	int ret;
+
+	sdhtml_renderer(&callbacks, &options, 0);
+	md = sd_markdown_new(0, 16, &callbacks, &options);
+	sd_markdown_set_budget(md, &budget);
+
+	for (i = 0; i < sizeof(units) / sizeof(units[0]); ++i) {
+		ib = repeat(units[i], 1200000 / strlen(units[i]));
+		ob = bufnew(1024);
+
+		start = sd_timer_ns();
+		ret = sd_markdown_render(ob, ib->data, ib->size, md);
+
+		check(ret == MKD_RENDER_TRUNCATED, "budget_time: truncated");
+		check(sd_timer_ns() - start < 200 * 1000000ULL, "budget_time: overshoot");
+
+		bufrelease(ob);
+		bufrelease(ib);
+	}
+
+	sd_markdown_free(md);
+}
+
+/* policy_check • verdicts of a link policy allowing http(s) to good.com
+ * and the subdomains of example.com, and of the same policy accepting
+ * relative links */
+static void
+policy_check(void)
+{
+	static const struct {
+		const char *url;
+		enum sdhtml_link_verdict strict, relative;
+	} cases[] = {
+		{ "http://good.com/x", SDHTML_LINK_ALLOW, SDHTML_LINK_ALLOW },
+		{ "HTTPS://GOOD.COM:8080/", SDHTML_LINK_ALLOW, SDHTML_LINK_ALLOW },
+		{ "http://evil.com/", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+
+		/* userinfo, and '\' ending the authority as browsers do */
+		{ "http://good.com@evil.com/", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ "http://evil.com:80@good.com/", SDHTML_LINK_ALLOW, SDHTML_LINK_ALLOW },
+		{ "http://evil.com\\@good.com/", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ "http://good.com.evil.com/", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+
+		/* wildcards stop at a label boundary */
+		{ "http://a.example.com/", SDHTML_LINK_ALLOW, SDHTML_LINK_ALLOW },
+		{ "http://a.b.example.com/", SDHTML_LINK_ALLOW, SDHTML_LINK_ALLOW },
+		{ "http://example.com/", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ "http://evil-example.com/", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ "http://a.evil-example.com/", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+
+		/* protocol-relative links still have their host checked */
+		{ "//good.com/x", SDHTML_LINK_DENY, SDHTML_LINK_ALLOW },
+		{ "//evil.com/x", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ "/path", SDHTML_LINK_DENY, SDHTML_LINK_ALLOW },
+		{ "#top", SDHTML_LINK_DENY, SDHTML_LINK_ALLOW },
+
+		/* schemes */
+		{ "javascript:alert(1)", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ "JavaScript:alert(1)", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ "java\tscript:alert(1)", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ " javascript:alert(1)", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ "httpx://good.com/", SDHTML_LINK_DENY, SDHTML_LINK_DENY },
+		{ "http:", SDHTML_LINK_ALLOW, SDHTML_LINK_ALLOW },
+	};
+	struct sdhtml_policy *strict, *relative, *policy;
+	size_t i, k, size;
+
+	strict = sdhtml_policy_new(0);
+	relative = sdhtml_policy_new(SDHTML_POLICY_RELATIVE);
+
+	for (k = 0; k < 2; ++k) {
+		policy = k ? relative : strict;
+		sdhtml_policy_allow_scheme(policy, "http");
+		sdhtml_policy_allow_scheme(policy, "https");
+		sdhtml_policy_allow_host(policy, "good.com");
+		sdhtml_policy_allow_host(policy, "*.example.com");
+	}
+
+	for (i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i) {
+		size = strlen(cases[i].url);
+
+		if (sdhtml_policy_check(strict, (const uint8_t *)cases[i].url, size) != cases[i].strict ||
+			sdhtml_policy_check(relative, (const uint8_t *)cases[i].url, size) != cases[i].relative) {
+			fprintf(stderr, "FAIL policy_check: %s\n", cases[i].url);
+			failures++;
+		}
+	}
+
+	sdhtml_policy_free(relative);
+	sdhtml_policy_free(strict);
+}
+
+/* policy_render • the HTML renderer applies the policy to links, URL
+ * and email autolinks, rewrites the hosts outside the allowlist through
+ * the proxy, and keeps the text of denied autolinks */
+static void
+policy_render(void)
+{
+	static const char doc[] =
+		"<me@evil.com> [a](http://evil.com/a?x=1&y=2) [b](http://good.com/) "
+		"<http://evil.com/z> [c](javascript:alert(1))\n";
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sdhtml_policy *policy;
+	struct sd_markdown *md;
+	struct buf *ob;
+
+	policy = sdhtml_policy_new(0);
+	sdhtml_policy_allow_scheme(policy, "http");
+	sdhtml_policy_allow_host(policy, "good.com");
+
+	sdhtml_renderer(&callbacks, &options, 0);
+	options.link_policy = policy;
+	md = sd_markdown_new(MKDEXT_AUTOLINK, 16, &callbacks, &options);
+	ob = bufnew(256);
+
+	/* mailto refused: the address stays as text */
+	sd_markdown_render(ob, (const uint8_t *)doc, sizeof(doc) - 1, md);
+	check(!contains(ob, "mailto:") && contains(ob, "me@evil.com"), "policy_render: email denied");
+	check(!contains(ob, "href=\"http://evil.com"), "policy_render: host denied");
+	check(contains(ob, "http://evil.com/z"), "policy_render: denied autolink text");
+	check(contains(ob, "<a href=\"http://good.com/\">b</a>"), "policy_render: allowed");
+	check(!contains(ob, "href=\"javascript"), "policy_render: scheme denied");
+
+	/* email autolinks are checked as "mailto:", without a host */
+	sdhtml_policy_allow_scheme(policy, "mailto");
+	sdhtml_policy_set_proxy(policy, "https://proxy.test/?u=");
+	ob->size = 0;
+	sd_markdown_render(ob, (const uint8_t *)doc, sizeof(doc) - 1, md);
+	check(contains(ob, "<a href=\"mailto:me@evil.com\">"), "policy_render: email allowed");
+	check(contains(ob, "<a href=\"https://proxy.test/?u=http%3A%2F%2Fevil.com%2Fa%3Fx%3D1%26y%3D2\">a</a>"),
+		"policy_render: proxied link");
+	check(contains(ob, "<a href=\"https://proxy.test/?u=http%3A%2F%2Fevil.com%2Fz\">"),
+		"policy_render: proxied autolink");
+	check(contains(ob, "<a href=\"http://good.com/\">b</a>"), "policy_render: not proxied");
+	check(!contains(ob, "href=\"javascript") && !contains(ob, "javascript%3A"),
+		"policy_render: scheme still denied");
+
+	sd_markdown_free(md);
+	sdhtml_policy_free(policy);
+	bufrelease(ob);
+}
+
+/* link_nesting • the target and title of an inline link take span
+ * buffers, which count toward max_nesting: with 16, a link four lists
+ * deep loses its text */
+static void
+link_nesting(void)
+{
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_markdown *md;
+	struct buf *ib, *ob;
+	size_t depth, i;
+
+	ib = bufnew(256);
+	ob = bufnew(256);
+
+	for (depth = 0; depth < 4; ++depth) {
+		for (i = 0; i < depth; ++i)
+			bufputs(ib, "    ");
+		bufputs(ib, "* item\n");
+	}
+	bufputs(ib, "                * x [code](http://x) y\n");
+
+	sdhtml_renderer(&callbacks, &options, 0);
+	md = sd_markdown_new(0, 16, &callbacks, &options);
+	sd_markdown_render(ob, ib->data, ib->size, md);
+
+	check(contains(ob, "<a href=\"http://x\"></a>"), "link_nesting: cutoff");
+
+	sd_markdown_free(md);
+	bufrelease(ob);
+	bufrelease(ib);
+}
+
+/* links_nesting • links nested in link texts are looked for no deeper
+ * than max_nesting; 240KB of them used to overflow the stack */
+static void
+links_nesting(void)
+{
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_markdown *md;
+	struct sd_links *links;
+	struct buf *ib;
+	int ret;
+
+	ib = repeat("[", 48000);
+	bufputc(ib, 'x');
+	bufputs(ib, "](u)");
+	while (ib->size < 240000)
+		bufputs(ib, "](u)");
+	bufputc(ib, '\n');
+
+	sdhtml_renderer(&callbacks, &options, 0);
+	md = sd_markdown_new(0, 16, &callbacks, &options);
+	links = sd_links_new();
+
+	ret = sd_markdown_extract_links(links, ib->data, ib->size, md);
+
+	check(ret == 0, "links_nesting: status");
+	check(links->count > 0 && links->count <= 17, "links_nesting: depth");
+
+	sd_links_free(links);
+	sd_markdown_free(md);
+	bufrelease(ib);
+}
+
+/* links_table • link extraction takes table cells as source, without
+ * rendering them through the span callbacks of the caller */
+static int span_calls;
+
+static int
+count_link(struct buf *ob, const struct buf *link, const struct buf *title, const struct buf *content, void *opaque)
+{
+	span_calls++;
+	return 1;
+}
+
+static int
+count_emphasis(struct buf *ob, const struct buf *text, void *opaque)
+{
+	span_calls++;
+	return 1;
+}
+
+static void
+links_table(void)
+{
+	static const char doc[] = "| a | b |\n|---|---|\n| [x](http://x) | *y* |\n";
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_markdown *md;
+	struct sd_links *links;
+
+	sdhtml_renderer(&callbacks, &options, 0);
+	callbacks.link = count_link;
+	callbacks.emphasis = count_emphasis;
+	md = sd_markdown_new(MKDEXT_TABLES, 16, &callbacks, &options);
+	links = sd_links_new();
+
+	span_calls = 0;
+	sd_markdown_extract_links(links, (const uint8_t *)doc, sizeof(doc) - 1, md);
+
+	check(links->count == 1, "links_table: found");
+	check(span_calls == 0, "links_table: callbacks");
+
+	sd_links_free(links);
+	sd_markdown_free(md);
+}
+
+/* text_words • non-breaking spaces from entities separate words, in
+ * text and in HTML blocks alike */
+static void
+text_words(void)
+{
+	static const char doc[] = "a&nbsp;b&#160;c&#xA0;d\n\n<div>e&nbsp;f</div>\n";
+	struct sd_callbacks callbacks;
+	struct sdtext_renderopt options;
+	struct sd_markdown *md;
+	struct buf *ob;
+
+	sdtext_renderer(&callbacks, &options);
+	md = sd_markdown_new(0, 16, &callbacks, &options);
+	ob = bufnew(64);
+
+	sd_markdown_render(ob, (const uint8_t *)doc, sizeof(doc) - 1, md);
+
+	check(options.stats.words == 6, "text_words: count");
+	check(contains(ob, "a b c d") && contains(ob, "e f"), "text_words: text");
+
+	sd_markdown_free(md);
+	bufrelease(ob);
+}
+
+/* outline_fuzz • sd_markdown_outline finds the headers a render finds,
+ * with the same text, on documents made of random markdown pieces */
+static struct buf *rendered;
+
+static void
+record_header(struct buf *ob, const struct buf *text, int level, void *opaque)
+{
+	bufprintf(rendered, "%d|", level);
+	if (text)
+		bufput(rendered, text->data, text->size);
+	bufputc(rendered, '\n');
+}
+
+static void
+outline_fuzz(void)
+{
+	static const char *pieces[] = {
+		"# ", "#", "## x ##\n", "===\n", "---\n", "--\n", "=\n", "Title\n",
+		"foo *em* bar\n", "[a]", "[a]: /a\n", "\n", "\n\n", " ", "    ", "\t",
+		"> ", "* ", "1. ", "```\n", "~~~\n", "<div>\n", "</div>\n\n",
+		"<!-- c -->\n", "`", "x", "# h [l](/u)\n", "\r\n", "{#id}", "\\#",
+		"###### six\n", "####### seven\n", "<p>\n", "## \n", "| a | b |\n",
+		"|---|---|\n",
+	};
+	static const unsigned int extensions[] = {
+		0,
+		MKDEXT_TABLES | MKDEXT_FENCED_CODE | MKDEXT_AUTOLINK | MKDEXT_STRIKETHROUGH,
+		MKDEXT_FENCED_CODE | MKDEXT_SPACE_HEADERS | MKDEXT_LAX_SPACING,
+	};
+	struct sd_callbacks callbacks;
+	struct html_renderopt options;
+	struct sd_outline *outline;
+	struct sd_markdown *md;
+	struct buf *ib, *ob, *found;
+	unsigned int seed = 1;
+	size_t e, n, k, i;
+
+	ib = bufnew(256);
+	ob = bufnew(256);
+	found = bufnew(256);
+	rendered = bufnew(256);
+	outline = sd_outline_new(0);
+
+	for (e = 0; e < sizeof(extensions) / sizeof(extensions[0]); ++e) {
+		sdhtml_renderer(&callbacks, &options, 0);
+		callbacks.header = record_header;
+		md = sd_markdown_new(extensions[e], 16, &callbacks, &options);
+
+		for (n = 0; n < 600; ++n) {
+			ib->size = ob->size = found->size = rendered->size = 0;
+
+			seed = seed * 1103515245 + 12345;
+			for (k = (seed >> 16) % 40; k > 0; --k) {
+				seed = seed * 1103515245 + 12345;
+				bufputs(ib, pieces[(seed >> 16) % (sizeof(pieces) / sizeof(pieces[0]))]);
+			}
+
+			sd_markdown_render(ob, ib->data, ib->size, md);
+			check(sd_markdown_outline(outline, ib->data, ib->size, md) == MKD_RENDER_OK,
+				"outline_fuzz: status");
+
+			for (i = 0; i < outline->count; ++i) {
+				const struct sd_header *h = &outline->items[i];
+
+				bufprintf(found, "%d|", h->level);
+				bufput(found, outline->data->data + h->text, h->text_size);
+				bufputc(found, '\n');
+
+				check(h->offset + h->size <= ib->size, "outline_fuzz: offset");
+			}
+
+			check(found->size == rendered->size &&
+				memcmp(found->data, rendered->data, found->size) == 0,
+				"outline_fuzz: headers");
+		}
+
+		sd_markdown_free(md);
+	}
+
+	sd_outline_free(outline);
+	bufrelease(rendered);
+	bufrelease(found);
+	bufrelease(ob);
+	bufrelease(ib);
+}
+
+/* cache_fuzz • renders with a block cache match renders without one,
+ * with renderers the cache may serve and renderers it must refuse, all
+ * sharing one cache */
+static void
+cache_fuzz(void)
+{
+	static const char *pieces[] = {
+		"A \"quoted\" paragraph that is long enough to be cached, with 'single' quotes and an \"open one\n",
+		"and a [link](javascript:alert(1)) to a <http://example.com/> autolink in a block of its own.\n",
+		"# A header that comes back in many documents, with a \"quote\" and a [link](http://x/)\n",
+		"* a list item with \"quotes\" that goes on for quite a while before it ends\n"
+		"* and a second item, [linked](ftp://host/path), to reach the size of a cached block\n",
+		"> a blockquote with an 'open quote that the next block may close, long enough to be cached\n",
+		"\n", "\n\n", "\"\n", "short\n", "[ref]: http://ref/\n", "[ref]\n",
+	};
+	static const unsigned int flags[] = { 0, HTML_SMARTYPANTS, 0, HTML_TOC, HTML_ESCAPE };
+	struct sd_callbacks callbacks;
+	struct html_renderopt cached_opt, plain_opt;
+	struct sd_block_cache_stats stats;
+	struct sd_block_cache *cache;
+	struct sdhtml_policy *policy;
+	struct sd_markdown *cached, *plain;
+	struct buf *ib, *ob_cached, *ob_plain;
+	unsigned int seed = 7;
+	size_t f, n, k;
+	int ret;
+
+	ib = bufnew(1024);
+	ob_cached = bufnew(1024);
+	ob_plain = bufnew(1024);
+	cache = sd_block_cache_new(1 << 20);
+	policy = sdhtml_policy_new(0);
+	sdhtml_policy_allow_scheme(policy, "http");
+
+	for (f = 0; f < sizeof(flags) / sizeof(flags[0]); ++f) {
+		sdhtml_renderer(&callbacks, &cached_opt, flags[f]);
+		sdhtml_renderer(&callbacks, &plain_opt, flags[f]);
+
+		/* the third pass only differs from the first by its link policy */
+		if (f == 2)
+			cached_opt.link_policy = plain_opt.link_policy = policy;
+
+		cached = sd_markdown_new(MKDEXT_AUTOLINK, 16, &callbacks, &cached_opt);
+		plain = sd_markdown_new(MKDEXT_AUTOLINK, 16, &callbacks, &plain_opt);
+
+		ret = sdhtml_set_cache(cached, cache, &cached_opt);
+		check(ret == ((f == 0 || f == 4) ? 0 : -1), "cache_fuzz: refused");
+
+		for (n = 0; n < 300; ++n) {
+			ib->size = ob_cached->size = ob_plain->size = 0;
+
+			for (k = 0; k < 12; ++k) {
+				seed = seed * 1103515245 + 12345;
+				bufputs(ib, pieces[(seed >> 16) % (sizeof(pieces) / sizeof(pieces[0]))]);
+			}
+
+			sd_markdown_render(ob_cached, ib->data, ib->size, cached);
+			sd_markdown_render(ob_plain, ib->data, ib->size, plain);
+
+			check(ob_cached->size == ob_plain->size &&
+				memcmp(ob_cached->data, ob_plain->data, ob_plain->size) == 0,
+				"cache_fuzz: output");
+		}
+
+		sd_markdown_free(plain);
+		sd_markdown_free(cached);
+	}
+
+	sd_block_cache_stats(cache, &stats);
+	check(stats.hits > 0, "cache_fuzz: hits");
+
+	sdhtml_policy_free(policy);
+	sd_block_cache_free(cache);
+	bufrelease(ob_plain);
+	bufrelease(ob_cached);
+	bufrelease(ib);
+}
+
+int
+main(void)
+{
+	budget_inline();
+	budget_output();
+	budget_time();
+	policy_check();
+	policy_render();
+	link_nesting();
+	links_nesting();
+	links_table();
+	text_words();
+	outline_fuzz();
+	cache_fuzz();
+
+	if (failures)
+		fprintf(stderr, "%d failures\n", failures);
+
+	return failures ? 1 : 0;
+}
+
+/* vim: set filetype=c: */